@@ -93,7 +93,10 @@ const planning::SensorFusion DecodeSensorFusion(const json& msg)
 }  // namespace internal
 
 UdacitySimulator::UdacitySimulator(const std::string& map_file)
-    : map_file_{map_file}, data_source_{}, motion_planning_{std::make_unique<planning::MotionPlanning>(data_source_)}
+    : map_file_{map_file},
+      data_source_{},
+      watchdog_{std::make_unique<planning::PlanningWatchdog>(planning::MotionPlanningOptions{},
+                                                              planning::WatchdogOptions{})}
 {
 }
 
@@ -161,18 +164,19 @@ void UdacitySimulator::ReceiveCallback(uWS::WebSocket<uWS::SERVER> ws, char* dat
                 UpdateDataSource(j[1]);
 
                 const auto start = std::chrono::system_clock::now();
-                motion_planning_->GenerateTrajectories();
+                const auto trajectory = watchdog_->GetTrajectory(data_source_);
                 const auto elapsed_time =
                     std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start)
                         .count();
-                LOG(INFO) << "Time taken by GenerateTrajectories() is " << elapsed_time << "usec." << std::endl;
-
-                const auto trajectory = motion_planning_->GetSelectedTrajectory();
-                for (const auto& wp : trajectory.waypoints)
-                {
-                    next_x_vals.push_back(wp.x);
-                    next_y_vals.push_back(wp.y);
-                }
+                LOG(INFO) << "Time taken by GetTrajectory() is " << elapsed_time << "usec ("
+                          << watchdog_->GetStatistics() << ")." << std::endl;
+
+                planning::ForEachWaypoint(trajectory,
+                                          [&next_x_vals, &next_y_vals](const auto& wp)
+                                          {
+                                              next_x_vals.push_back(wp.x);
+                                              next_y_vals.push_back(wp.y);
+                                          });
                 // ##############################################################
                 // sequentially every .02 seconds
                 msgJson["next_x"] = next_x_vals;
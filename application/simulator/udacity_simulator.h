@@ -9,7 +9,7 @@
 #include "application/simulator/i_simulator.h"
 #include "planning/common/argument_parser.h"
 #include "planning/motion_planning/data_source.h"
-#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/planning_watchdog.h"
 
 #include <json.hpp>
 
@@ -68,8 +68,9 @@ class UdacitySimulator : public ISimulator
     /// @brief DataSource (contains information on Vehicle Dynamics, SensorFusion, etc.)
     planning::DataSource data_source_;
 
-    /// @brief Motion Planning Instance to be used to generate Trajectory and Select optimal trajectory for ego motion
-    std::unique_ptr<planning::MotionPlanning> motion_planning_;
+    /// @brief Planning Watchdog to be used to generate Trajectory and Select optimal trajectory for ego motion (answers
+    /// each frame within the response time, with a decelerating fallback trajectory on overrun)
+    std::unique_ptr<planning::PlanningWatchdog> watchdog_;
 };
 }  // namespace sim
 
@@ -14,7 +14,7 @@ class ITimer
 {
   public:
     /// @brief Destructor.
-    ~ITimer() = default;
+    virtual ~ITimer() = default;
 
     /// @brief Start of the Timer
     virtual void Start() = 0;
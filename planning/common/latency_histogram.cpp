@@ -0,0 +1,96 @@
+///
+/// @file
+/// @brief Contains Latency Histogram implementation
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/common/latency_histogram.h"
+
+#include "planning/common/logging.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace planning
+{
+LatencyHistogram::LatencyHistogram() : LatencyHistogram{std::chrono::microseconds{100}, 200U} {}
+
+LatencyHistogram::LatencyHistogram(const std::chrono::nanoseconds resolution, const std::size_t number_of_bins)
+    : resolution_{std::max(resolution, std::chrono::nanoseconds{1})},
+      counts_(number_of_bins + 1U, 0U),
+      count_{0U},
+      sum_{0},
+      max_{0}
+{
+}
+
+void LatencyHistogram::Add(const std::chrono::nanoseconds latency)
+{
+    const auto clamped_latency = std::max(latency, std::chrono::nanoseconds{0});
+    const auto bin = static_cast<std::size_t>(clamped_latency / resolution_);
+    ++counts_[std::min(bin, counts_.size() - 1U)];
+    ++count_;
+    sum_ += clamped_latency;
+    max_ = std::max(max_, clamped_latency);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other)
+{
+    if ((other.resolution_ != resolution_) || (other.counts_.size() != counts_.size()))
+    {
+        LOG(WARNING) << "Ignored merge of latency histogram with different layout (resolution: "
+                     << other.resolution_.count() << " ns vs " << resolution_.count()
+                     << " ns, bins: " << (other.counts_.size() - 1U) << " vs " << (counts_.size() - 1U) << ", dropped "
+                     << other.count_ << " samples)";
+        return;
+    }
+    std::transform(counts_.begin(), counts_.end(), other.counts_.begin(), counts_.begin(), std::plus<std::size_t>{});
+    count_ += other.count_;
+    sum_ += other.sum_;
+    max_ = std::max(max_, other.max_);
+}
+
+std::size_t LatencyHistogram::GetCount() const noexcept
+{
+    return count_;
+}
+
+std::size_t LatencyHistogram::GetOverflowCount() const noexcept
+{
+    return counts_.back();
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetMean() const noexcept
+{
+    return (count_ > 0U) ? (sum_ / static_cast<std::chrono::nanoseconds::rep>(count_)) : std::chrono::nanoseconds{0};
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetMax() const noexcept
+{
+    return max_;
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetPercentile(const double percentile) const
+{
+    if (count_ == 0U)
+    {
+        return std::chrono::nanoseconds{0};
+    }
+
+    // rank of the sample (1-based) not exceeded by the given share of all the samples
+    const auto share = std::min(std::max(percentile, 0.0), 100.0) / 100.0;
+    const auto rank =
+        std::max(static_cast<std::size_t>(std::ceil(share * static_cast<double>(count_))), std::size_t{1U});
+
+    std::size_t cumulative_count{0U};
+    for (std::size_t bin = 0U; (bin + 1U) < counts_.size(); ++bin)
+    {
+        cumulative_count += counts_[bin];
+        if (cumulative_count >= rank)
+        {
+            return std::min(resolution_ * static_cast<std::chrono::nanoseconds::rep>(bin + 1U), max_);
+        }
+    }
+    return max_;
+}
+}  // namespace planning
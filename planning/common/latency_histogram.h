@@ -0,0 +1,85 @@
+///
+/// @file
+/// @brief Contains Latency Histogram definitions
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_COMMON_LATENCY_HISTOGRAM_H
+#define PLANNING_COMMON_LATENCY_HISTOGRAM_H
+
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace planning
+{
+/// @brief Latency Histogram with bins of fixed width (resolution) and one overflow bin.
+///
+/// @details Memory is bounded by the number of bins (independent of the number of samples), hence each thread may
+/// record into its own histogram and histograms of the same layout are merged (added bin by bin) at the end.
+/// Percentiles are reported as upper bound of their bin (at most the maximum latency, e.g. for the overflow bin).
+/// Not thread safe.
+class LatencyHistogram
+{
+  public:
+    /// @brief Constructor. Bins of 100us up to 20ms (simulator tick).
+    LatencyHistogram();
+
+    /// @brief Constructor. Bins of given resolution (at least 1ns), latencies beyond the last bin overflow.
+    explicit LatencyHistogram(const std::chrono::nanoseconds resolution, const std::size_t number_of_bins);
+
+    /// @brief Record given latency (negative latencies are recorded as zero)
+    void Add(const std::chrono::nanoseconds latency);
+
+    /// @brief Add all the samples of given histogram
+    /// @note Histograms of a different layout (resolution or number of bins) are ignored (and reported as warning).
+    void Merge(const LatencyHistogram& other);
+
+    /// @brief Number of recorded latencies
+    std::size_t GetCount() const noexcept;
+
+    /// @brief Number of recorded latencies beyond the last bin
+    std::size_t GetOverflowCount() const noexcept;
+
+    /// @brief Mean latency (0 if nothing was recorded)
+    std::chrono::nanoseconds GetMean() const noexcept;
+
+    /// @brief Maximum latency (0 if nothing was recorded)
+    std::chrono::nanoseconds GetMax() const noexcept;
+
+    /// @brief Latency not exceeded by the given percentile (in [0, 100]) of the recorded latencies (0 if nothing was
+    /// recorded)
+    std::chrono::nanoseconds GetPercentile(const double percentile) const;
+
+  private:
+    /// @brief Width of each bin
+    std::chrono::nanoseconds resolution_;
+
+    /// @brief Number of latencies per bin (last bin counts overflows)
+    std::vector<std::size_t> counts_;
+
+    /// @brief Number of recorded latencies
+    std::size_t count_;
+
+    /// @brief Sum of recorded latencies
+    std::chrono::nanoseconds sum_;
+
+    /// @brief Maximum recorded latency
+    std::chrono::nanoseconds max_;
+};
+
+/// @brief String Stream for Latency Histogram summary (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const LatencyHistogram& histogram)
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    return out << "LatencyHistogram{count: " << histogram.GetCount()
+               << ", mean_us: " << duration_cast<microseconds>(histogram.GetMean()).count()
+               << ", p50_us: " << duration_cast<microseconds>(histogram.GetPercentile(50.0)).count()
+               << ", p99_us: " << duration_cast<microseconds>(histogram.GetPercentile(99.0)).count()
+               << ", max_us: " << duration_cast<microseconds>(histogram.GetMax()).count()
+               << ", overflows: " << histogram.GetOverflowCount() << "}";
+}
+}  // namespace planning
+
+#endif  /// PLANNING_COMMON_LATENCY_HISTOGRAM_H
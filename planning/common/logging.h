@@ -8,4 +8,14 @@
 #define GOOGLE_STRIP_LOG (WARNING)
 #include <glog/logging.h>
 
+namespace planning
+{
+/// @brief Whether INFO messages are emitted, i.e. whether verbose log blocks (built on a string stream each frame)
+/// are worth formatting at all
+inline bool IsInfoLogged()
+{
+    return FLAGS_minloglevel <= google::GLOG_INFO;
+}
+}  // namespace planning
+
 #endif  /// PLANNING_COMMON_LOGGING_LOGGING_H
@@ -0,0 +1,69 @@
+///
+/// @file
+/// @brief Contains Monotonic Arena (per frame allocator) implementation
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/common/monotonic_arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace planning
+{
+MonotonicArena::MonotonicArena(const std::size_t initial_capacity)
+    : chunks_{}, current_chunk_{0U}, offset_{0U}, used_before_current_{0U}, capacity_{0U}
+{
+    const auto size = std::max(initial_capacity, std::size_t{64U});
+    chunks_.push_back(Chunk{std::make_unique<unsigned char[]>(size), size});
+    capacity_ = size;
+}
+
+void* MonotonicArena::Allocate(const std::size_t size, const std::size_t alignment)
+{
+    // first fitting chunk, starting with the current one (skipped chunks stay unused until Reset)
+    while (true)
+    {
+        auto& chunk = chunks_[current_chunk_];
+        const auto address = reinterpret_cast<std::uintptr_t>(chunk.data.get()) + offset_;
+        const auto padding = (alignment - (address % alignment)) % alignment;
+        if ((offset_ + padding + size) <= chunk.size)
+        {
+            offset_ += padding + size;
+            return chunk.data.get() + (offset_ - size);
+        }
+
+        used_before_current_ += offset_;
+        offset_ = 0U;
+        if ((current_chunk_ + 1U) == chunks_.size())
+        {
+            const auto chunk_size = std::max(2U * chunks_.back().size, size + alignment);
+            chunks_.push_back(Chunk{std::make_unique<unsigned char[]>(chunk_size), chunk_size});
+            capacity_ += chunk_size;
+        }
+        ++current_chunk_;
+    }
+}
+
+void MonotonicArena::Reset() noexcept
+{
+    current_chunk_ = 0U;
+    offset_ = 0U;
+    used_before_current_ = 0U;
+}
+
+std::size_t MonotonicArena::GetUsedBytes() const noexcept
+{
+    return used_before_current_ + offset_;
+}
+
+std::size_t MonotonicArena::GetCapacity() const noexcept
+{
+    return capacity_;
+}
+
+std::size_t MonotonicArena::GetNumberOfChunks() const noexcept
+{
+    return chunks_.size();
+}
+
+}  // namespace planning
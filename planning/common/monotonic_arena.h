@@ -0,0 +1,138 @@
+///
+/// @file
+/// @brief Contains Monotonic Arena (per frame allocator) definitions
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_COMMON_MONOTONIC_ARENA_H
+#define PLANNING_COMMON_MONOTONIC_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace planning
+{
+/// @brief Monotonic Arena (bump allocator over retained chunks).
+///
+/// @details Allocations bump an offset within the current chunk, deallocations are no-ops. Once a chunk is exhausted,
+/// allocation continues in the next retained chunk, or a new chunk (twice the size of the last one) is added.
+/// Reset rewinds to the first chunk in O(1) and keeps all the chunks, hence after warm-up frames don't allocate from
+/// the heap at all. Not thread safe (owned by a single thread, e.g. per frame or per worker).
+class MonotonicArena
+{
+  public:
+    /// @brief Constructor. Allocates the first chunk of given capacity (in bytes).
+    explicit MonotonicArena(const std::size_t initial_capacity);
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /// @brief Allocate given number of bytes with given alignment (power of two)
+    void* Allocate(const std::size_t size, const std::size_t alignment);
+
+    /// @brief Release all the allocations at once (O(1), chunks are retained)
+    void Reset() noexcept;
+
+    /// @brief Bytes allocated since last Reset (including alignment padding)
+    std::size_t GetUsedBytes() const noexcept;
+
+    /// @brief Total capacity of the retained chunks (in bytes)
+    std::size_t GetCapacity() const noexcept;
+
+    /// @brief Number of chunks allocated from the heap (over the lifetime of the arena)
+    std::size_t GetNumberOfChunks() const noexcept;
+
+  private:
+    /// @brief Chunk of memory
+    struct Chunk
+    {
+        /// @brief Memory of the chunk
+        std::unique_ptr<unsigned char[]> data;
+
+        /// @brief Size of the chunk (in bytes)
+        std::size_t size;
+    };
+
+    /// @brief Retained chunks (in order of allocation)
+    std::vector<Chunk> chunks_;
+
+    /// @brief Chunk allocations are bumped from
+    std::size_t current_chunk_;
+
+    /// @brief Offset within the current chunk
+    std::size_t offset_;
+
+    /// @brief Bytes allocated in chunks preceding the current one (since last Reset)
+    std::size_t used_before_current_;
+
+    /// @brief Total capacity of the retained chunks
+    std::size_t capacity_;
+};
+
+/// @brief Standard allocator drawing from a Monotonic Arena (default heap allocation if no arena is given)
+template <typename T>
+class ArenaAllocator
+{
+  public:
+    using value_type = T;
+
+    /// @brief Constructor. Allocates from the heap.
+    ArenaAllocator() noexcept : arena_{nullptr} {}
+
+    /// @brief Constructor. Allocates from given arena (nullptr uses the heap).
+    explicit ArenaAllocator(MonotonicArena* arena) noexcept : arena_{arena} {}
+
+    /// @brief Converting Constructor (rebinding to other value types).
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_{other.GetArena()}
+    {
+    }
+
+    /// @brief Allocate memory for given number of values
+    T* allocate(const std::size_t count)
+    {
+        if (arena_ == nullptr)
+        {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+        return static_cast<T*>(arena_->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// @brief Deallocate memory (no-op for arena memory, released on Reset)
+    void deallocate(T* pointer, const std::size_t) noexcept
+    {
+        if (arena_ == nullptr)
+        {
+            ::operator delete(pointer);
+        }
+    }
+
+    /// @brief Arena allocations are drawn from (nullptr if the heap is used)
+    MonotonicArena* GetArena() const noexcept { return arena_; }
+
+  private:
+    /// @brief Arena (nullptr if the heap is used)
+    MonotonicArena* arena_;
+};
+
+/// @brief Allocators are equal if they draw from the same arena
+template <typename T, typename U>
+inline bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return lhs.GetArena() == rhs.GetArena();
+}
+
+/// @brief Allocators are not equal if they draw from different arenas
+template <typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+/// @brief Vector drawing from a Monotonic Arena
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+}  // namespace planning
+
+#endif  /// PLANNING_COMMON_MONOTONIC_ARENA_H
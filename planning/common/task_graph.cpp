@@ -0,0 +1,141 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/common/task_graph.h"
+
+#include <utility>
+
+namespace planning
+{
+TaskGraph::TaskGraph() : nodes_{}, timings_{}, start_{}, remaining_tasks_{0U}, mutex_{}, done_{}, is_done_{false} {}
+
+TaskGraph::TaskId TaskGraph::AddTask(const char* name, Task task)
+{
+    return AddTask(name, std::move(task), {});
+}
+
+TaskGraph::TaskId TaskGraph::AddTask(const char* name, Task task, const std::vector<TaskId>& dependencies)
+{
+    const auto task_id = nodes_.size();
+    auto node = std::make_unique<Node>();
+    node->name = name;
+    node->task = std::move(task);
+    node->number_of_dependencies = 0U;
+    node->remaining_dependencies.store(0U);
+    for (const auto dependency : dependencies)
+    {
+        // only previously added tasks, hence no cycles
+        if (dependency < task_id)
+        {
+            nodes_[dependency]->successors.push_back(task_id);
+            ++node->number_of_dependencies;
+        }
+    }
+    nodes_.push_back(std::move(node));
+    return task_id;
+}
+
+void TaskGraph::Clear()
+{
+    nodes_.clear();
+    timings_.clear();
+}
+
+std::size_t TaskGraph::GetNumberOfTasks() const
+{
+    return nodes_.size();
+}
+
+void TaskGraph::Run(ThreadPool& thread_pool)
+{
+    timings_.assign(nodes_.size(), TaskTiming{});
+    start_ = std::chrono::steady_clock::now();
+
+    if ((thread_pool.GetNumberOfThreads() == 0U) || nodes_.empty())
+    {
+        // order of insertion respects all the dependencies
+        for (TaskId task_id = 0U; task_id < nodes_.size(); ++task_id)
+        {
+            ExecuteTask(task_id);
+        }
+        return;
+    }
+
+    is_done_ = false;
+    remaining_tasks_.store(nodes_.size());
+    for (auto& node : nodes_)
+    {
+        node->remaining_dependencies.store(node->number_of_dependencies);
+    }
+    for (TaskId task_id = 0U; task_id < nodes_.size(); ++task_id)
+    {
+        if (nodes_[task_id]->number_of_dependencies == 0U)
+        {
+            thread_pool.Submit([this, &thread_pool, task_id]() { Execute(thread_pool, task_id); });
+        }
+    }
+
+    // participate until the last task signaled the end of the run (no thread accesses the graph afterwards)
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (!is_done_)
+    {
+        lock.unlock();
+        const auto has_run_task = thread_pool.TryRunPendingTask();
+        lock.lock();
+        if (!has_run_task)
+        {
+            done_.wait_for(lock, std::chrono::microseconds{50}, [this]() { return is_done_; });
+        }
+    }
+}
+
+const std::vector<TaskTiming>& TaskGraph::GetTimings() const
+{
+    return timings_;
+}
+
+void TaskGraph::Execute(ThreadPool& thread_pool, TaskId task_id)
+{
+    auto has_task = true;
+    while (has_task)
+    {
+        ExecuteTask(task_id);
+
+        // continue with the first ready dependent in this thread, submit the other ready ones
+        has_task = false;
+        for (const auto successor : nodes_[task_id]->successors)
+        {
+            if (nodes_[successor]->remaining_dependencies.fetch_sub(1U) != 1U)
+            {
+                continue;
+            }
+            if (!has_task)
+            {
+                task_id = successor;
+                has_task = true;
+            }
+            else
+            {
+                thread_pool.Submit([this, &thread_pool, successor]() { Execute(thread_pool, successor); });
+            }
+        }
+        if (remaining_tasks_.fetch_sub(1U) == 1U)
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            is_done_ = true;
+            done_.notify_all();
+        }
+    }
+}
+
+void TaskGraph::ExecuteTask(const TaskId task_id)
+{
+    const auto start = std::chrono::steady_clock::now();
+    nodes_[task_id]->task();
+    auto& timing = timings_[task_id];
+    timing.name = nodes_[task_id]->name;
+    timing.start = std::chrono::duration_cast<std::chrono::nanoseconds>(start - start_);
+    timing.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+}
+}  // namespace planning
@@ -0,0 +1,144 @@
+///
+/// @file
+/// @brief Contains Task Graph (dependency DAG executed on the Thread Pool) definitions
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_COMMON_TASK_GRAPH_H
+#define PLANNING_COMMON_TASK_GRAPH_H
+
+#include "planning/common/thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace planning
+{
+/// @brief Timing of a task (of the last run of its graph)
+struct TaskTiming
+{
+    /// @brief Task name (static string, i.e. not copied)
+    const char* name{""};
+
+    /// @brief Start of the task (relative to the start of the run)
+    std::chrono::nanoseconds start{0};
+
+    /// @brief Duration of the task
+    std::chrono::nanoseconds duration{0};
+};
+
+/// @brief Task Graph. Tasks with dependencies (DAG) executed on the Work Stealing Thread Pool.
+///
+/// @details A task is submitted once all of its dependencies finished, hence independent tasks (and branches) overlap
+/// automatically. A worker finishing a task continues with one of the tasks it made ready and submits the others to
+/// its own queue (stolen by idle workers). Dependencies refer to previously added tasks only, hence the graph is
+/// acyclic by construction and the order of insertion is a valid serial order. Pool with zero threads executes all the
+/// tasks in the calling thread in order of insertion (serial mode, e.g. for debugging).
+///
+/// @note Graph is built once and may be run repeatedly, it must not be modified while running.
+class TaskGraph
+{
+  public:
+    /// @brief Task identifier (index in order of insertion)
+    using TaskId = std::size_t;
+
+    /// @brief Task type
+    using Task = std::function<void()>;
+
+    /// @brief Constructor. Initializes empty graph.
+    TaskGraph();
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    /// @brief Add task without dependencies
+    TaskId AddTask(const char* name, Task task);
+
+    /// @brief Add task to be executed once all the given tasks finished
+    ///
+    /// @param name [in] - task name (used for timings, static string which outlives the graph)
+    /// @param task [in] - task function
+    /// @param dependencies [in] - previously added tasks (others are ignored)
+    ///
+    /// @return identifier of the added task
+    TaskId AddTask(const char* name, Task task, const std::vector<TaskId>& dependencies);
+
+    /// @brief Remove all the tasks (and their timings)
+    void Clear();
+
+    /// @brief Number of tasks
+    std::size_t GetNumberOfTasks() const;
+
+    /// @brief Execute all the tasks on provided Thread Pool (respecting dependencies) and wait for all of them.
+    ///
+    /// @note Calling thread participates in the execution, hence it is safe to call from within a pool task.
+    void Run(ThreadPool& thread_pool);
+
+    /// @brief Get timings of the last run (indexed by TaskId)
+    const std::vector<TaskTiming>& GetTimings() const;
+
+  private:
+    /// @brief Task with its dependents
+    struct Node
+    {
+        /// @brief Task name
+        const char* name;
+
+        /// @brief Task function
+        Task task;
+
+        /// @brief Tasks depending on this task
+        std::vector<TaskId> successors;
+
+        /// @brief Number of tasks this task depends on
+        std::size_t number_of_dependencies;
+
+        /// @brief Number of dependencies not yet finished (during a run)
+        std::atomic<std::size_t> remaining_dependencies;
+    };
+
+    /// @brief Execute given task, followed by the dependents it made ready (first one inline, others submitted)
+    void Execute(ThreadPool& thread_pool, TaskId task_id);
+
+    /// @brief Execute given task and record its timing
+    void ExecuteTask(const TaskId task_id);
+
+    /// @brief Tasks (in order of insertion)
+    std::vector<std::unique_ptr<Node>> nodes_;
+
+    /// @brief Task timings of the last run
+    std::vector<TaskTiming> timings_;
+
+    /// @brief Start of the last run
+    std::chrono::steady_clock::time_point start_;
+
+    /// @brief Number of tasks not yet finished (during a run)
+    std::atomic<std::size_t> remaining_tasks_;
+
+    /// @brief Guards waiting for the run to finish
+    std::mutex mutex_;
+
+    /// @brief Signals the run to be finished
+    std::condition_variable done_;
+
+    /// @brief Whether all the tasks of the run finished
+    bool is_done_;
+};
+
+/// @brief String Stream for Task Timing (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const TaskTiming& timing)
+{
+    return out << "Task{" << timing.name
+               << ", start: " << std::chrono::duration_cast<std::chrono::microseconds>(timing.start).count()
+               << " us, duration: " << std::chrono::duration_cast<std::chrono::microseconds>(timing.duration).count()
+               << " us}";
+}
+}  // namespace planning
+
+#endif  /// PLANNING_COMMON_TASK_GRAPH_H
@@ -0,0 +1,102 @@
+///
+/// @file
+/// @brief Contains unit tests for Latency Histogram.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/common/latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+namespace planning
+{
+namespace
+{
+using std::chrono::microseconds;
+
+TEST(LatencyHistogramTest, GetPercentile_GivenLatencies_ExpectUpperBoundOfBin)
+{
+    // Given
+    LatencyHistogram histogram{microseconds{100}, 10U};
+    for (const auto latency : {50, 150, 150, 250, 950})
+    {
+        histogram.Add(microseconds{latency});
+    }
+
+    // When
+    const auto median = histogram.GetPercentile(50.0);
+    const auto p80 = histogram.GetPercentile(80.0);
+
+    // Then
+    EXPECT_EQ(median, microseconds{200});
+    EXPECT_EQ(p80, microseconds{300});
+    EXPECT_EQ(histogram.GetPercentile(100.0), microseconds{950});
+    EXPECT_EQ(histogram.GetCount(), 5U);
+    EXPECT_EQ(histogram.GetMean(), microseconds{310});
+    EXPECT_EQ(histogram.GetMax(), microseconds{950});
+}
+
+TEST(LatencyHistogramTest, Add_GivenLatencyBeyondLastBin_ExpectOverflow)
+{
+    // Given
+    LatencyHistogram histogram{microseconds{100}, 10U};
+
+    // When
+    histogram.Add(microseconds{50});
+    histogram.Add(microseconds{5000});
+
+    // Then
+    EXPECT_EQ(histogram.GetOverflowCount(), 1U);
+    EXPECT_EQ(histogram.GetPercentile(99.0), microseconds{5000});
+}
+
+TEST(LatencyHistogramTest, Merge_GivenSameLayout_ExpectSameAsRecordedTogether)
+{
+    // Given
+    LatencyHistogram expected{microseconds{100}, 10U};
+    LatencyHistogram first{microseconds{100}, 10U};
+    LatencyHistogram second{microseconds{100}, 10U};
+    for (const auto latency : {50, 450, 2000})
+    {
+        first.Add(microseconds{latency});
+        expected.Add(microseconds{latency});
+    }
+    for (const auto latency : {150, 850})
+    {
+        second.Add(microseconds{latency});
+        expected.Add(microseconds{latency});
+    }
+
+    // When
+    first.Merge(second);
+
+    // Then
+    EXPECT_EQ(first.GetCount(), expected.GetCount());
+    EXPECT_EQ(first.GetOverflowCount(), expected.GetOverflowCount());
+    EXPECT_EQ(first.GetMean(), expected.GetMean());
+    EXPECT_EQ(first.GetMax(), expected.GetMax());
+    for (const auto percentile : {0.0, 25.0, 50.0, 75.0, 90.0, 100.0})
+    {
+        EXPECT_EQ(first.GetPercentile(percentile), expected.GetPercentile(percentile)) << percentile;
+    }
+}
+
+TEST(LatencyHistogramTest, Merge_GivenDifferentLayout_ExpectIgnored)
+{
+    // Given
+    LatencyHistogram histogram{microseconds{100}, 10U};
+    LatencyHistogram other{microseconds{10}, 10U};
+    other.Add(microseconds{50});
+
+    // When
+    histogram.Merge(other);
+
+    // Then
+    EXPECT_EQ(histogram.GetCount(), 0U);
+    EXPECT_EQ(histogram.GetPercentile(50.0), microseconds{0});
+    EXPECT_EQ(histogram.GetMean(), microseconds{0});
+}
+
+}  // namespace
+}  // namespace planning
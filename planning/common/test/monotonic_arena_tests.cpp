@@ -0,0 +1,104 @@
+///
+/// @file
+/// @brief Contains unit tests for Monotonic Arena.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/common/monotonic_arena.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+
+namespace planning
+{
+namespace
+{
+TEST(MonotonicArenaTest, Allocate_GivenAlignments_ExpectAlignedNonOverlappingMemory)
+{
+    // Given
+    MonotonicArena arena{1024U};
+
+    // When
+    auto* const first = arena.Allocate(3U, 1U);
+    auto* const second = arena.Allocate(sizeof(double), alignof(double));
+    auto* const third = arena.Allocate(16U, 16U);
+
+    // Then
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignof(double), 0U);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(third) % 16U, 0U);
+    EXPECT_GE(static_cast<unsigned char*>(second), static_cast<unsigned char*>(first) + 3U);
+    EXPECT_GE(static_cast<unsigned char*>(third), static_cast<unsigned char*>(second) + sizeof(double));
+    EXPECT_GE(arena.GetUsedBytes(), 3U + sizeof(double) + 16U);
+}
+
+TEST(MonotonicArenaTest, Allocate_GivenExhaustedChunk_ExpectNewChunk)
+{
+    // Given
+    MonotonicArena arena{128U};
+
+    // When
+    arena.Allocate(100U, 1U);
+    arena.Allocate(100U, 1U);
+    arena.Allocate(1000U, 8U);
+
+    // Then
+    EXPECT_EQ(arena.GetNumberOfChunks(), 3U);
+    EXPECT_GE(arena.GetCapacity(), 128U + 256U + 1000U);
+}
+
+TEST(MonotonicArenaTest, Reset_GivenWarmArena_ExpectMemoryReusedWithoutNewChunks)
+{
+    // Given
+    MonotonicArena arena{64U};
+    auto* const first = arena.Allocate(32U, 8U);
+    arena.Allocate(4096U, 8U);
+    const auto number_of_chunks = arena.GetNumberOfChunks();
+    const auto capacity = arena.GetCapacity();
+
+    // When
+    arena.Reset();
+    auto* const actual = arena.Allocate(32U, 8U);
+    arena.Allocate(4096U, 8U);
+
+    // Then
+    EXPECT_EQ(actual, first);
+    EXPECT_EQ(arena.GetNumberOfChunks(), number_of_chunks);
+    EXPECT_EQ(arena.GetCapacity(), capacity);
+}
+
+TEST(MonotonicArenaTest, ArenaVector_GivenArena_ExpectValuesInArena)
+{
+    // Given
+    MonotonicArena arena{1024U};
+    ArenaVector<std::int32_t> values{ArenaAllocator<std::int32_t>{&arena}};
+
+    // When
+    values.reserve(100U);
+    for (std::int32_t idx = 0; idx < 100; ++idx)
+    {
+        values.push_back(idx);
+    }
+
+    // Then
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 4950);
+    EXPECT_EQ(arena.GetUsedBytes(), 100U * sizeof(std::int32_t));
+    EXPECT_EQ(values.get_allocator().GetArena(), &arena);
+}
+
+TEST(MonotonicArenaTest, ArenaVector_GivenNoArena_ExpectHeapAllocation)
+{
+    // Given
+    ArenaVector<std::int32_t> values{};
+
+    // When
+    values.assign(100U, 1);
+
+    // Then
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 100);
+    EXPECT_EQ(values.get_allocator().GetArena(), nullptr);
+}
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,155 @@
+///
+/// @file
+/// @brief Contains unit tests for Task Graph.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/common/task_graph.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+class TaskGraphFixture : public ::testing::TestWithParam<std::size_t>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(TaskGraph, TaskGraphFixture, ::testing::Values(0U, 1U, 2U, 8U));
+
+TEST_P(TaskGraphFixture, Run_GivenDiamond_ExpectDependenciesFinishedFirst)
+{
+    // Given
+    ThreadPool thread_pool{GetParam()};
+    std::atomic<std::size_t> sequence{0U};
+    std::vector<std::size_t> finished(4U, 0U);
+    TaskGraph task_graph{};
+    const auto a = task_graph.AddTask("a", [&]() { finished[0U] = ++sequence; });
+    const auto b = task_graph.AddTask("b", [&]() { finished[1U] = ++sequence; }, {a});
+    const auto c = task_graph.AddTask("c", [&]() { finished[2U] = ++sequence; }, {a});
+    task_graph.AddTask("d", [&]() { finished[3U] = ++sequence; }, {b, c});
+
+    // When
+    task_graph.Run(thread_pool);
+
+    // Then
+    EXPECT_EQ(sequence.load(), 4U);
+    EXPECT_LT(finished[0U], finished[1U]);
+    EXPECT_LT(finished[0U], finished[2U]);
+    EXPECT_LT(finished[1U], finished[3U]);
+    EXPECT_LT(finished[2U], finished[3U]);
+}
+
+TEST_P(TaskGraphFixture, Run_GivenIndependentChains_ExpectEachTaskExecutedOnceInChainOrder)
+{
+    // Given
+    ThreadPool thread_pool{GetParam()};
+    constexpr std::size_t kNumberOfChains{100U};
+    std::vector<std::int32_t> stages(kNumberOfChains, 0);
+    std::vector<std::int32_t> violations(kNumberOfChains, 0);
+    TaskGraph task_graph{};
+    for (std::size_t chain = 0U; chain < kNumberOfChains; ++chain)
+    {
+        auto previous = task_graph.AddTask("chain", [&stages, chain]() { stages[chain] = 1; });
+        for (std::int32_t stage = 2; stage <= 3; ++stage)
+        {
+            previous = task_graph.AddTask(
+                "chain",
+                [&stages, &violations, chain, stage]()
+                {
+                    violations[chain] += (stages[chain] != (stage - 1)) ? 1 : 0;
+                    stages[chain] = stage;
+                },
+                {previous});
+        }
+    }
+
+    // When
+    task_graph.Run(thread_pool);
+    task_graph.Run(thread_pool);
+
+    // Then
+    EXPECT_EQ(task_graph.GetNumberOfTasks(), 3U * kNumberOfChains);
+    EXPECT_TRUE(std::all_of(stages.begin(), stages.end(), [](const auto stage) { return stage == 3; }));
+    EXPECT_TRUE(std::all_of(violations.begin(), violations.end(), [](const auto count) { return count == 0; }));
+}
+
+TEST_P(TaskGraphFixture, Run_GivenRunWithinPoolTask_ExpectNoDeadlock)
+{
+    // Given
+    ThreadPool thread_pool{GetParam()};
+    std::atomic<std::int32_t> executions{0};
+
+    // When
+    thread_pool.ParallelFor(4U,
+                            [&](const std::size_t)
+                            {
+                                TaskGraph task_graph{};
+                                const auto first = task_graph.AddTask("first", [&]() { executions.fetch_add(1); });
+                                task_graph.AddTask("second", [&]() { executions.fetch_add(1); }, {first});
+                                task_graph.Run(thread_pool);
+                            });
+
+    // Then
+    EXPECT_EQ(executions.load(), 8);
+}
+
+TEST_P(TaskGraphFixture, GetTimings_GivenRun_ExpectTimingOfEachTaskAfterItsDependency)
+{
+    // Given
+    ThreadPool thread_pool{GetParam()};
+    TaskGraph task_graph{};
+    const auto first = task_graph.AddTask("first", []() {});
+    task_graph.AddTask("second", []() {}, {first});
+
+    // When
+    task_graph.Run(thread_pool);
+
+    // Then
+    const auto& timings = task_graph.GetTimings();
+    ASSERT_EQ(timings.size(), 2U);
+    EXPECT_STREQ(timings[0U].name, "first");
+    EXPECT_STREQ(timings[1U].name, "second");
+    EXPECT_GE(timings[1U].start, timings[0U].start + timings[0U].duration);
+}
+
+TEST(TaskGraph, AddTask_GivenUnknownDependency_ExpectIgnored)
+{
+    // Given
+    ThreadPool thread_pool{2U};
+    std::atomic<std::int32_t> executions{0};
+    TaskGraph task_graph{};
+
+    // When
+    task_graph.AddTask("task", [&]() { executions.fetch_add(1); }, {1U});
+    task_graph.Run(thread_pool);
+
+    // Then
+    EXPECT_EQ(executions.load(), 1);
+}
+
+TEST(TaskGraph, Clear_GivenTasks_ExpectEmptyGraph)
+{
+    // Given
+    ThreadPool thread_pool{2U};
+    TaskGraph task_graph{};
+    task_graph.AddTask("task", []() {});
+    task_graph.Run(thread_pool);
+
+    // When
+    task_graph.Clear();
+    task_graph.Run(thread_pool);
+
+    // Then
+    EXPECT_EQ(task_graph.GetNumberOfTasks(), 0U);
+    EXPECT_TRUE(task_graph.GetTimings().empty());
+}
+}  // namespace
+}  // namespace planning
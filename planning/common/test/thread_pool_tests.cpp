@@ -0,0 +1,97 @@
+///
+/// @file
+/// @brief Contains unit tests for Thread Pool.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/common/thread_pool.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+class ThreadPoolFixture : public ::testing::TestWithParam<std::size_t>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(ThreadPool, ThreadPoolFixture, ::testing::Values(0U, 1U, 2U, 8U));
+
+TEST_P(ThreadPoolFixture, ParallelFor_GivenTypicalCount_ExpectEachIndexExecutedOnce)
+{
+    // Given
+    ThreadPool thread_pool{GetParam()};
+    std::vector<std::int32_t> executions(1000U, 0);
+
+    // When
+    thread_pool.ParallelFor(executions.size(), [&executions](const std::size_t idx) { ++executions[idx]; });
+
+    // Then
+    EXPECT_EQ(thread_pool.GetNumberOfThreads(), GetParam());
+    EXPECT_EQ(std::accumulate(executions.begin(), executions.end(), 0), 1000);
+    EXPECT_TRUE(std::all_of(executions.begin(), executions.end(), [](const auto count) { return count == 1; }));
+}
+
+TEST_P(ThreadPoolFixture, ParallelFor_GivenNestedParallelFor_ExpectNoDeadlock)
+{
+    // Given
+    ThreadPool thread_pool{GetParam()};
+    std::atomic<std::int32_t> executions{0};
+
+    // When
+    thread_pool.ParallelFor(8U,
+                            [&](const std::size_t)
+                            {
+                                thread_pool.ParallelFor(
+                                    8U, [&executions](const std::size_t) { executions.fetch_add(1); });
+                            });
+
+    // Then
+    EXPECT_EQ(executions.load(), 64);
+}
+
+TEST_P(ThreadPoolFixture, Submit_GivenTasks_ExpectAllTasksExecutedBeforeDestruction)
+{
+    // Given
+    std::atomic<std::int32_t> executions{0};
+
+    // When
+    {
+        ThreadPool thread_pool{GetParam()};
+        for (auto idx = 0; idx < 100; ++idx)
+        {
+            thread_pool.Submit([&executions]() { executions.fetch_add(1); });
+        }
+    }
+
+    // Then
+    EXPECT_EQ(executions.load(), 100);
+}
+
+TEST_P(ThreadPoolFixture, ParallelFor_GivenReusedPool_ExpectConsistentResults)
+{
+    // Given
+    ThreadPool thread_pool{GetParam()};
+
+    for (auto iteration = 0; iteration < 50; ++iteration)
+    {
+        // When
+        std::vector<std::size_t> results(64U, 0U);
+        thread_pool.ParallelFor(results.size(), [&results](const std::size_t idx) { results[idx] = idx * idx; });
+
+        // Then
+        for (std::size_t idx = 0U; idx < results.size(); ++idx)
+        {
+            ASSERT_EQ(results[idx], idx * idx);
+        }
+    }
+}
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,176 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/common/thread_pool.h"
+
+namespace planning
+{
+namespace
+{
+/// @brief Pool and queue index of the calling worker thread (nullptr if not called from a worker thread)
+thread_local const ThreadPool* tls_pool{nullptr};
+thread_local std::size_t tls_worker_index{0U};
+}  // namespace
+
+ThreadPool::ThreadPool(const std::size_t number_of_threads)
+    : queues_{}, workers_{}, pending_tasks_{0U}, next_queue_{0U}, mutex_{}, condition_{}, stop_{false}
+{
+    for (std::size_t idx = 0U; idx < number_of_threads; ++idx)
+    {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    for (std::size_t idx = 0U; idx < number_of_threads; ++idx)
+    {
+        workers_.emplace_back([this, idx]() { Run(idx); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+std::size_t ThreadPool::GetNumberOfThreads() const
+{
+    return workers_.size();
+}
+
+void ThreadPool::Submit(Task task)
+{
+    if (workers_.empty())
+    {
+        task();
+        return;
+    }
+
+    const auto queue_index =
+        (tls_pool == this) ? tls_worker_index : (next_queue_.fetch_add(1U) % queues_.size());
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        pending_tasks_.fetch_add(1U);
+    }
+    {
+        std::lock_guard<std::mutex> lock{queues_[queue_index]->mutex};
+        queues_[queue_index]->tasks.push_back(std::move(task));
+    }
+    condition_.notify_one();
+}
+
+void ThreadPool::ParallelFor(const std::size_t count, const std::function<void(std::size_t)>& function)
+{
+    if (workers_.empty() || (count <= 1U))
+    {
+        for (std::size_t idx = 0U; idx < count; ++idx)
+        {
+            function(idx);
+        }
+        return;
+    }
+
+    struct Batch
+    {
+        std::atomic<std::size_t> remaining;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->remaining.store(count);
+
+    for (std::size_t idx = 0U; idx < count; ++idx)
+    {
+        Submit(
+            [batch, &function, idx]()
+            {
+                function(idx);
+                if (batch->remaining.fetch_sub(1U) == 1U)
+                {
+                    std::lock_guard<std::mutex> lock{batch->mutex};
+                    batch->done.notify_all();
+                }
+            });
+    }
+
+    // participate until all the tasks of this batch are finished
+    while (batch->remaining.load() > 0U)
+    {
+        if (!TryRunPendingTask())
+        {
+            std::unique_lock<std::mutex> lock{batch->mutex};
+            batch->done.wait_for(lock, std::chrono::microseconds{50}, [&batch]() { return batch->remaining == 0U; });
+        }
+    }
+}
+
+void ThreadPool::Run(const std::size_t worker_index)
+{
+    tls_pool = this;
+    tls_worker_index = worker_index;
+    while (true)
+    {
+        Task task;
+        if (TryGetTask(worker_index, task))
+        {
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{mutex_};
+        condition_.wait(lock, [this]() { return stop_ || (pending_tasks_.load() > 0U); });
+        if (stop_ && (pending_tasks_.load() == 0U))
+        {
+            break;
+        }
+    }
+}
+
+bool ThreadPool::TryGetTask(const std::size_t worker_index, Task& task)
+{
+    {
+        auto& own_queue = *queues_[worker_index];
+        std::lock_guard<std::mutex> lock{own_queue.mutex};
+        if (!own_queue.tasks.empty())
+        {
+            task = std::move(own_queue.tasks.back());
+            own_queue.tasks.pop_back();
+            pending_tasks_.fetch_sub(1U);
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1U; offset < queues_.size(); ++offset)
+    {
+        auto& other_queue = *queues_[(worker_index + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock{other_queue.mutex};
+        if (!other_queue.tasks.empty())
+        {
+            task = std::move(other_queue.tasks.front());
+            other_queue.tasks.pop_front();
+            pending_tasks_.fetch_sub(1U);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::TryRunPendingTask()
+{
+    Task task;
+    const auto worker_index = (tls_pool == this) ? tls_worker_index : 0U;
+    if (TryGetTask(worker_index, task))
+    {
+        task();
+        return true;
+    }
+    return false;
+}
+
+}  // namespace planning
@@ -0,0 +1,99 @@
+///
+/// @file
+/// @brief Contains Work Stealing Thread Pool definitions
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_COMMON_THREAD_POOL_H
+#define PLANNING_COMMON_THREAD_POOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace planning
+{
+/// @brief Work Stealing Thread Pool.
+///
+/// @details Each worker owns a task queue. Workers execute tasks from the back of their own queue and steal from the
+/// front of other queues once their own queue is empty. Threads are created once (on construction) and reused for
+/// all submitted tasks. Pool with zero threads executes all the tasks in the calling thread (serial mode).
+class ThreadPool
+{
+  public:
+    /// @brief Task type
+    using Task = std::function<void()>;
+
+    /// @brief Constructor. Spawns requested number of worker threads (0 = serial mode).
+    explicit ThreadPool(const std::size_t number_of_threads);
+
+    /// @brief Destructor. Finishes pending tasks and joins all the worker threads.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// @brief Number of worker threads (0 = serial mode)
+    std::size_t GetNumberOfThreads() const;
+
+    /// @brief Submit task for asynchronous execution. In serial mode, task is executed immediately.
+    void Submit(Task task);
+
+    /// @brief Execute function for each index in [0, count) and wait for all of them to complete.
+    ///
+    /// @note Calling thread participates in the execution, hence it is safe to call from within a pool task.
+    void ParallelFor(const std::size_t count, const std::function<void(std::size_t)>& function);
+
+    /// @brief Execute one of the pending tasks (if any) in the calling thread (i.e. participate while waiting)
+    ///
+    /// @return true if a task was executed
+    bool TryRunPendingTask();
+
+  private:
+    /// @brief Task Queue owned by each worker
+    struct WorkQueue
+    {
+        /// @brief Guards tasks
+        std::mutex mutex;
+
+        /// @brief Queued tasks
+        std::deque<Task> tasks;
+    };
+
+    /// @brief Worker thread loop
+    void Run(const std::size_t worker_index);
+
+    /// @brief Pop task from own queue (back) or steal from other queues (front)
+    bool TryGetTask(const std::size_t worker_index, Task& task);
+
+    /// @brief Worker Task Queues
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+
+    /// @brief Worker Threads
+    std::vector<std::thread> workers_;
+
+    /// @brief Number of queued (not yet started) tasks
+    std::atomic<std::size_t> pending_tasks_;
+
+    /// @brief Round robin index for tasks submitted from outside of the pool
+    std::atomic<std::size_t> next_queue_;
+
+    /// @brief Guards sleeping workers
+    std::mutex mutex_;
+
+    /// @brief Wakes up sleeping workers
+    std::condition_variable condition_;
+
+    /// @brief Request workers to stop
+    bool stop_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_COMMON_THREAD_POOL_H
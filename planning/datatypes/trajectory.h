@@ -9,7 +9,9 @@
 
 #include <units.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace planning
@@ -20,7 +22,10 @@ struct Trajectory
     /// @brief Trajectory Id (unique). (default to Invalid Id -1)
     std::int32_t unique_id{-1};
 
-    /// @brief Trajectory Waypoints in Global Coordinates
+    /// @brief Previous Path Waypoints in Global Coordinates (immutable, shared by all trajectories of a frame)
+    std::shared_ptr<const PreviousPathGlobal> previous_path{};
+
+    /// @brief Trajectory Waypoints in Global Coordinates (continuing from the previous path)
     std::vector<GlobalCoordinates> waypoints;
 
     /// @brief Ego Vehicle Position in Global Coordinates
@@ -43,10 +48,40 @@ struct Trajectory
 
     /// @brief Velocity (mps) for Trajectory.
     units::velocity::meters_per_second_t velocity{0.0};
+
+    /// @brief Planning Horizon (longitudinal spacing of anchor waypoints) for Trajectory.
+    units::length::meter_t horizon{30.0};
 };
 
 using Trajectories = std::vector<Trajectory>;
 
+/// @brief Number of Previous Path Waypoints preceding the Trajectory Waypoints
+inline std::size_t GetPreviousPathSize(const Trajectory& trajectory) noexcept
+{
+    return (trajectory.previous_path != nullptr) ? trajectory.previous_path->size() : 0U;
+}
+
+/// @brief Apply function on all the waypoints of the Trajectory (previous path waypoints followed by trajectory
+/// waypoints) without building a combined copy.
+template <typename Function>
+inline void ForEachWaypoint(const Trajectory& trajectory, Function function)
+{
+    if (trajectory.previous_path != nullptr)
+    {
+        for (const auto& waypoint : *trajectory.previous_path)
+        {
+            function(waypoint);
+        }
+    }
+    for (const auto& waypoint : trajectory.waypoints)
+    {
+        function(waypoint);
+    }
+}
+
+/// @brief Maximum number of Trajectories printed in verbose information per stage (remaining ones are summarized)
+constexpr std::size_t kMaxLoggedTrajectories{10U};
+
 /// @brief Compare Trajectory based on Cost and Lane Assignments
 inline bool operator>(const Trajectory& lhs, const Trajectory& rhs) noexcept
 {
@@ -60,7 +95,8 @@ inline bool operator>(const Trajectory& lhs, const Trajectory& rhs) noexcept
 /// @brief String Stream for Trajectory information (used for printing verbose information)
 inline std::ostream& operator<<(std::ostream& out, const Trajectory& trajectory)
 {
-    return out << "Trajectory{id: " << trajectory.unique_id << ", wp: " << trajectory.waypoints.size()
+    return out << "Trajectory{id: " << trajectory.unique_id << ", wp: " << GetPreviousPathSize(trajectory) << "+"
+               << trajectory.waypoints.size()
                << ", lane: " << trajectory.lane_id << ", global_lane: " << trajectory.global_lane_id
                << ", drivable: " << std::boolalpha << trajectory.drivable << ", velocity: " << trajectory.velocity
                << ", cost: " << trajectory.cost << ", yaw: " << trajectory.yaw << "}";
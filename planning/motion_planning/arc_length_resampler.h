@@ -0,0 +1,150 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_ARC_LENGTH_RESAMPLER_H
+#define PLANNING_MOTION_PLANNING_ARC_LENGTH_RESAMPLER_H
+
+#include "planning/datatypes/vehicle_dynamics.h"
+
+#include <units.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace planning
+{
+/// @brief Total number of waypoints (previous path + new waypoints) of each path sent to the simulator, i.e. maximum
+/// number of waypoints produced by the resampler
+constexpr std::size_t kTotalWaypoints{50U};
+
+/// @brief Simulator tick duration (in seconds). Each waypoint is consumed once per tick.
+constexpr double kWaypointSamplingTime{0.02};
+
+/// @brief Per tick velocity (in meters per seconds) for the resampled waypoints
+using VelocityProfile = std::array<double, kTotalWaypoints>;
+
+/// @brief Cumulative Arc Length Table for a curve y = f(x) in local coordinates (starting at x = 0).
+///
+/// @details Table is built once by evaluating the curve at kTableSize uniformly spaced x values, afterwards
+/// x value for any arc length is looked up by linear interpolation in the table.
+///
+/// @tparam kTableSize - number of table segments
+template <std::size_t kTableSize>
+class ArcLengthTable
+{
+  public:
+    /// @brief Build table for the curve over x = [0, x_max]
+    ///
+    /// @tparam Curve - curve type providing `double operator()(double x) const` (i.e. spline)
+    template <typename Curve>
+    void Build(const Curve& curve, const double x_max) noexcept
+    {
+        const double dx = x_max / static_cast<double>(kTableSize);
+        for (std::size_t idx = 0U; idx <= kTableSize; ++idx)
+        {
+            x_[idx] = dx * static_cast<double>(idx);
+            y_[idx] = curve(x_[idx]);
+        }
+
+        s_[0U] = 0.0;
+        for (std::size_t idx = 1U; idx <= kTableSize; ++idx)
+        {
+            s_[idx] = s_[idx - 1U] + std::hypot(x_[idx] - x_[idx - 1U], y_[idx] - y_[idx - 1U]);
+        }
+    }
+
+    /// @brief Total arc length covered by the table
+    double GetLength() const noexcept { return s_[kTableSize]; }
+
+    /// @brief Look up x values for the given (sorted) arc lengths.
+    ///
+    /// @param arc_lengths [in] - arc lengths (ascending order)
+    /// @param count [in] - number of arc lengths to look up
+    /// @param x [out] - x values for each arc length
+    ///
+    /// @note Arc lengths beyond the table are extrapolated along the last table segment.
+    template <std::size_t N>
+    void GetX(const std::array<double, N>& arc_lengths,
+              const std::size_t count,
+              std::array<double, N>& x) const noexcept
+    {
+        std::size_t segment = 1U;
+        for (std::size_t idx = 0U; idx < count; ++idx)
+        {
+            while ((segment < kTableSize) && (s_[segment] < arc_lengths[idx]))
+            {
+                ++segment;
+            }
+            const double ds = s_[segment] - s_[segment - 1U];
+            const double ratio = (ds > 0.0) ? ((arc_lengths[idx] - s_[segment - 1U]) / ds) : 0.0;
+            x[idx] = x_[segment - 1U] + (ratio * (x_[segment] - x_[segment - 1U]));
+        }
+    }
+
+  private:
+    /// @brief Sampled x values
+    std::array<double, kTableSize + 1U> x_{};
+
+    /// @brief Sampled y values
+    std::array<double, kTableSize + 1U> y_{};
+
+    /// @brief Cumulative arc length at each sampled x
+    std::array<double, kTableSize + 1U> s_{};
+};
+
+/// @brief Resample waypoints along the curve (in local coordinates) at exact per tick travelled distances and
+/// transform them to global coordinates.
+///
+/// @tparam Curve - curve type providing `double operator()(double x) const` (i.e. spline)
+///
+/// @param curve [in] - curve in local coordinates (origin at position, x axis along yaw)
+/// @param velocity_profile [in] - velocity for each tick (in meters per seconds)
+/// @param count [in] - number of waypoints to be sampled (<= kTotalWaypoints)
+/// @param position [in] - origin of local coordinates in global coordinates
+/// @param yaw [in] - rotation of local coordinates
+/// @param waypoints [out] - resampled waypoints in global coordinates
+template <typename Curve>
+void ResampleByArcLength(const Curve& curve,
+                         const VelocityProfile& velocity_profile,
+                         const std::size_t count,
+                         const GlobalCoordinates& position,
+                         const units::angle::radian_t yaw,
+                         std::array<GlobalCoordinates, kTotalWaypoints>& waypoints) noexcept
+{
+    const auto n_waypoints = std::min(count, kTotalWaypoints);
+
+    std::array<double, kTotalWaypoints> distances{};
+    double distance = 0.0;
+    for (std::size_t idx = 0U; idx < n_waypoints; ++idx)
+    {
+        distance += velocity_profile[idx] * kWaypointSamplingTime;
+        distances[idx] = distance;
+    }
+
+    // arc length is never shorter than travelled x, hence table over [0, distance] covers all samples
+    ArcLengthTable<64U> table{};
+    table.Build(curve, std::max(distance, 1.0));
+
+    std::array<double, kTotalWaypoints> x{};
+    table.GetX(distances, n_waypoints, x);
+
+    std::array<double, kTotalWaypoints> y{};
+    for (std::size_t idx = 0U; idx < n_waypoints; ++idx)
+    {
+        y[idx] = curve(x[idx]);
+    }
+
+    const double cos_yaw = std::cos(yaw.value());
+    const double sin_yaw = std::sin(yaw.value());
+    for (std::size_t idx = 0U; idx < n_waypoints; ++idx)
+    {
+        waypoints[idx].x = position.x + (x[idx] * cos_yaw) - (y[idx] * sin_yaw);
+        waypoints[idx].y = position.y + (x[idx] * sin_yaw) + (y[idx] * cos_yaw);
+    }
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_ARC_LENGTH_RESAMPLER_H
@@ -0,0 +1,43 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/batch_planning.h"
+
+#include "planning/common/logging.h"
+
+namespace planning
+{
+BatchPlanning::BatchPlanning(const MotionPlanningOptions& options, const BatchPlanningOptions& batch_options)
+    : statistics_{}, planner_pool_{options, batch_options.number_of_threads}
+{
+}
+
+std::vector<Trajectory> BatchPlanning::GetSelectedTrajectories(const std::vector<DataSource>& data_sources)
+{
+    std::vector<Trajectory> selected_trajectories(data_sources.size());
+    planner_pool_.ForEach(data_sources.size(),
+                          [&](PooledPlanner& worker, const std::size_t frame)
+                          {
+                              worker.data_source = data_sources[frame];
+                              worker.motion_planning->Reset();
+                              worker.motion_planning->GenerateTrajectories();
+                              selected_trajectories[frame] = worker.motion_planning->GetSelectedTrajectory();
+                          });
+
+    ++statistics_.batches;
+    statistics_.frames += data_sources.size();
+    LOG(INFO) << "Planned batch of " << data_sources.size() << " frames (" << statistics_ << ")";
+    return selected_trajectories;
+}
+
+std::size_t BatchPlanning::GetNumberOfWorkers() const
+{
+    return planner_pool_.GetNumberOfPlanners();
+}
+
+BatchPlanningStatistics BatchPlanning::GetStatistics() const
+{
+    return statistics_;
+}
+}  // namespace planning
@@ -0,0 +1,75 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_BATCH_PLANNING_H
+#define PLANNING_MOTION_PLANNING_BATCH_PLANNING_H
+
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning_options.h"
+#include "planning/motion_planning/planner_pool.h"
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace planning
+{
+/// @brief Batch Planning counters
+struct BatchPlanningStatistics
+{
+    /// @brief Number of planned batches
+    std::size_t batches{0U};
+
+    /// @brief Number of planned frames (all the batches)
+    std::size_t frames{0U};
+};
+
+/// @brief Batch Planning. Plans many independent frames (e.g. scenarios of an offline evaluation) across worker
+/// threads and returns the selected trajectory of each frame.
+///
+/// @details Frames are planned on a Planner Pool, i.e. each worker owns a DataSource and a Motion Planning bound to it
+/// (stages, candidate buffers and per frame arena), reused for all the batches. Each frame is copied into the worker's
+/// DataSource and planned after resetting the state carried between frames (Motion Planning's Reset()).
+///
+/// @note Frames are unrelated, hence the selected trajectory of each frame matches a freshly constructed Motion
+/// Planning planning this frame only (independent of the number of threads and of the order of the frames).
+class BatchPlanning
+{
+  public:
+    /// @brief Constructor. Initializes one Motion Planning per worker for provided options.
+    explicit BatchPlanning(const MotionPlanningOptions& options, const BatchPlanningOptions& batch_options);
+
+    BatchPlanning(const BatchPlanning&) = delete;
+    BatchPlanning& operator=(const BatchPlanning&) = delete;
+
+    /// @brief Plan all the provided frames
+    ///
+    /// @param data_sources [in] - independent frames (snapshots of the environment)
+    ///
+    /// @return Selected trajectory of each frame (ordered as data_sources)
+    std::vector<Trajectory> GetSelectedTrajectories(const std::vector<DataSource>& data_sources);
+
+    /// @brief Get number of workers (each with its own Motion Planning)
+    std::size_t GetNumberOfWorkers() const;
+
+    /// @brief Get batch counters
+    BatchPlanningStatistics GetStatistics() const;
+
+  private:
+    /// @brief Batch counters
+    BatchPlanningStatistics statistics_;
+
+    /// @brief Workers (one Motion Planning per thread)
+    PlannerPool planner_pool_;
+};
+
+/// @brief String Stream for Batch Planning counters (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const BatchPlanningStatistics& statistics)
+{
+    return out << "BatchPlanning{batches: " << statistics.batches << ", frames: " << statistics.frames << "}";
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_BATCH_PLANNING_H
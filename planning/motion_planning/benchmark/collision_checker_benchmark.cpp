@@ -0,0 +1,98 @@
+///
+/// @file
+/// @brief Contains benchmarks for Collision Checker against the number of candidates and objects.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/collision_checker.h"
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/polynomial_trajectory_optimizer.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+#include "planning/motion_planning/test/support/sensor_fusion.h"
+#include "planning/motion_planning/trajectory_planner.h"
+
+#include <benchmark/benchmark.h>
+
+namespace planning
+{
+namespace
+{
+/// @brief Lattice with given number of velocities (3 lanes x velocities x 4 horizons)
+LatticeOptions GetLatticeOptions(const std::int64_t number_of_velocities)
+{
+    LatticeOptions options{};
+    options.number_of_velocities = static_cast<std::size_t>(number_of_velocities);
+    options.velocity_resolution = units::velocity::meters_per_second_t{0.5};
+    return options;
+}
+
+/// @brief Benchmark checking all candidates of a frame against all predicted objects (incl. per frame update)
+///
+/// Arguments: {number of velocities, number of objects}
+void BM_CollisionChecker_IsCollisionFree(benchmark::State& state)
+{
+    const auto data_source = DataSourceBuilder()
+                                 .WithPreviousPath(PreviousPathGlobal{})
+                                 .WithMapCoordinates(kHighwayMap)
+                                 .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+                                 .WithGlobalLaneId(GlobalLaneId::kCenter)
+                                 .WithSensorFusion(GetSensorFusion(state.range(1), 300))
+                                 .Build();
+    const auto lattice = LatticeManeuverGenerator{GetLatticeOptions(state.range(0))};
+    const auto maneuvers = lattice.Generate(units::velocity::meters_per_second_t{20.0});
+    const auto planned_trajectories = TrajectoryPlanner{data_source}.GetPlannedTrajectories(maneuvers);
+    const auto candidates = PolynomialTrajectoryOptimizer{data_source, lattice.GetHorizons()}.GetOptimizedTrajectories(
+        planned_trajectories);
+
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    CollisionChecker collision_checker{data_source, object_predictor};
+
+    std::size_t collision_free = 0U;
+    for (auto _ : state)
+    {
+        collision_checker.Update();
+        collision_free = 0U;
+        for (const auto& candidate : candidates)
+        {
+            collision_free += collision_checker.IsCollisionFree(candidate) ? 1U : 0U;
+        }
+        benchmark::DoNotOptimize(collision_free);
+    }
+    state.counters["candidates"] = static_cast<double>(candidates.size());
+    state.counters["collision_free"] = static_cast<double>(collision_free);
+}
+BENCHMARK(BM_CollisionChecker_IsCollisionFree)
+    ->ArgsProduct({{1, 7, 30}, {12, 64, 256}})
+    ->ArgNames({"velocities", "objects"})
+    ->Unit(benchmark::kMicrosecond);
+
+/// @brief Benchmark per frame update only (footprints of all predicted objects, sorted for the broad phase)
+///
+/// Arguments: {number of objects}
+void BM_CollisionChecker_Update(benchmark::State& state)
+{
+    const auto data_source = DataSourceBuilder()
+                                 .WithPreviousPath(PreviousPathGlobal{})
+                                 .WithMapCoordinates(kHighwayMap)
+                                 .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+                                 .WithSensorFusion(GetSensorFusion(state.range(0), 300))
+                                 .Build();
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    CollisionChecker collision_checker{data_source, object_predictor};
+
+    for (auto _ : state)
+    {
+        collision_checker.Update();
+    }
+}
+BENCHMARK(BM_CollisionChecker_Update)
+    ->RangeMultiplier(4)
+    ->Range(4, 1024)
+    ->ArgName("objects")
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,197 @@
+///
+/// @file
+/// @brief Contains benchmarks for Motion Planning latency against the number of planned candidates and for Batch and
+/// Replay Planning throughput against the number of threads.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/batch_planning.h"
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/replay_planning.h"
+#include "planning/motion_planning/static_motion_planning.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+/// @brief DataSource with ego in the center lane and an object in the left lane
+DataSource GetDataSource()
+{
+    return DataSourceBuilder()
+        .WithPreviousPath(PreviousPathGlobal{})
+        .WithMapCoordinates(kHighwayMap)
+        .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+        .WithGlobalLaneId(GlobalLaneId::kCenter)
+        .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+        .Build();
+}
+
+/// @brief Lattice options of size 3 x velocities x horizons
+MotionPlanningOptions GetLatticeOptions(const std::size_t number_of_velocities, const std::size_t number_of_horizons)
+{
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    options.lattice_options.number_of_velocities = number_of_velocities;
+    options.lattice_options.velocity_resolution = units::velocity::meters_per_second_t{0.5};
+    options.lattice_options.number_of_horizons = number_of_horizons;
+    options.lattice_options.horizon_resolution = units::length::meter_t{5.0};
+    return options;
+}
+
+/// @brief Benchmark full planning cycle (GenerateTrajectories) for lattice of size 3 x velocities x horizons
+///
+/// Arguments: {number of velocities, number of horizons, number of threads}
+void BM_MotionPlanning_GenerateTrajectories(benchmark::State& state)
+{
+    const auto data_source = GetDataSource();
+    auto options =
+        GetLatticeOptions(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    options.number_of_threads = static_cast<std::size_t>(state.range(2));
+    auto motion_planning = MotionPlanning{data_source, options};
+
+    for (auto _ : state)
+    {
+        motion_planning.GenerateTrajectories();
+        benchmark::DoNotOptimize(motion_planning.GetSelectedTrajectory());
+    }
+
+    const auto lattice_size = LatticeManeuverGenerator{options.lattice_options}.GetLatticeSize();
+    state.counters["candidates"] = static_cast<double>(lattice_size);
+    state.counters["candidates/s"] =
+        benchmark::Counter(static_cast<double>(lattice_size), benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MotionPlanning_GenerateTrajectories)
+    ->ArgNames({"velocities", "horizons", "threads"})
+    ->Args({1, 1, 0})
+    ->Args({7, 4, 0})
+    ->Args({10, 6, 0})
+    ->Args({10, 12, 0})
+    ->Args({10, 12, 4})
+    ->Unit(benchmark::kMicrosecond);
+
+/// @brief Benchmark full planning cycle of the stages composed at compile time (serial, same lattice as above)
+///
+/// Arguments: {number of velocities, number of horizons}
+void BM_StaticMotionPlanning_GenerateTrajectories(benchmark::State& state)
+{
+    const auto data_source = GetDataSource();
+    const auto options =
+        GetLatticeOptions(static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+    StaticMotionPlanning<VelocityPlanner, LatticeManeuverGenerator> motion_planning{data_source, options};
+
+    for (auto _ : state)
+    {
+        motion_planning.GenerateTrajectories();
+        benchmark::DoNotOptimize(motion_planning.GetSelectedTrajectory());
+    }
+
+    const auto lattice_size = LatticeManeuverGenerator{options.lattice_options}.GetLatticeSize();
+    state.counters["candidates"] = static_cast<double>(lattice_size);
+    state.counters["candidates/s"] =
+        benchmark::Counter(static_cast<double>(lattice_size), benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_StaticMotionPlanning_GenerateTrajectories)
+    ->ArgNames({"velocities", "horizons"})
+    ->Args({1, 1})
+    ->Args({7, 4})
+    ->Args({10, 6})
+    ->Args({10, 12})
+    ->Unit(benchmark::kMicrosecond);
+
+/// @brief Benchmark throughput of independent frames (ego at different positions along the highway) planned by a
+/// batch, lattice of size 3 x 7 x 4 per frame
+///
+/// Arguments: {number of threads}
+void BM_BatchPlanning_GetSelectedTrajectories(benchmark::State& state)
+{
+    constexpr std::size_t kNumberOfFrames{256U};
+    std::vector<DataSource> data_sources{};
+    data_sources.reserve(kNumberOfFrames);
+    for (std::size_t frame = 0U; frame < kNumberOfFrames; ++frame)
+    {
+        const auto s = 100.0 + (10.0 * static_cast<double>(frame));
+        data_sources.push_back(DataSourceBuilder()
+                                   .WithPreviousPath(PreviousPathGlobal{})
+                                   .WithMapCoordinates(kHighwayMap)
+                                   .WithFrenetCoordinates(FrenetCoordinates{s, 6.0, 0.0, 0.0})
+                                   .WithGlobalLaneId(GlobalLaneId::kCenter)
+                                   .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+                                   .Build());
+    }
+    BatchPlanningOptions batch_options{};
+    batch_options.number_of_threads = static_cast<std::size_t>(state.range(0));
+    BatchPlanning batch_planning{GetLatticeOptions(7U, 4U), batch_options};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(batch_planning.GetSelectedTrajectories(data_sources));
+    }
+
+    state.counters["frames/s"] =
+        benchmark::Counter(static_cast<double>(kNumberOfFrames), benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_BatchPlanning_GetSelectedTrajectories)
+    ->ArgNames({"threads"})
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+/// @brief Benchmark throughput of recorded drives (ego following the center lane, 50 frames each) replayed by shards,
+/// lattice of size 3 x 7 x 4 per frame
+///
+/// Arguments: {number of threads}
+void BM_ReplayPlanning_Replay(benchmark::State& state)
+{
+    constexpr std::size_t kNumberOfDrives{16U};
+    constexpr std::size_t kNumberOfFrames{50U};
+    std::vector<RecordedDrive> drives(kNumberOfDrives);
+    for (std::size_t drive = 0U; drive < kNumberOfDrives; ++drive)
+    {
+        for (std::size_t frame = 0U; frame < kNumberOfFrames; ++frame)
+        {
+            const auto s = 100.0 + (100.0 * static_cast<double>(drive)) + static_cast<double>(frame);
+            drives[drive].push_back(
+                DataSourceBuilder()
+                    .WithPreviousPath(PreviousPathGlobal{})
+                    .WithMapCoordinates(kHighwayMap)
+                    .WithFrenetCoordinates(FrenetCoordinates{s, 6.0, 0.0, 0.0})
+                    .WithGlobalLaneId(GlobalLaneId::kCenter)
+                    .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+                    .Build());
+        }
+    }
+    ReplayOptions replay_options{};
+    replay_options.number_of_threads = static_cast<std::size_t>(state.range(0));
+    ReplayPlanning replay_planning{GetLatticeOptions(7U, 4U), replay_options};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(replay_planning.Replay(drives));
+    }
+
+    state.counters["frames/s"] = benchmark::Counter(static_cast<double>(kNumberOfDrives * kNumberOfFrames),
+                                                    benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_ReplayPlanning_Replay)
+    ->ArgNames({"threads"})
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace planning
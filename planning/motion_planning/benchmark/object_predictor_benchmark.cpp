@@ -0,0 +1,68 @@
+///
+/// @file
+/// @brief Contains benchmarks for Object Prediction against the number of objects.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/lane_evaluator.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/sensor_fusion.h"
+
+#include <benchmark/benchmark.h>
+
+namespace planning
+{
+namespace
+{
+/// @brief Benchmark predicting all the objects of a frame over the planning horizon
+///
+/// Arguments: {number of objects, prediction model}
+void BM_ObjectPredictor_PredictObjects(benchmark::State& state)
+{
+    auto data_source = DataSourceBuilder()
+                           .WithFakePreviousPath(40)
+                           .WithFrenetCoordinates(FrenetCoordinates{150.0, 6.0, 0.0, 0.0})
+                           .WithSensorFusion(GetSensorFusion(state.range(0), 120))
+                           .Build();
+    PredictionOptions options{};
+    options.model = static_cast<PredictionModel>(state.range(1));
+    ObjectPredictor object_predictor{data_source, options};
+
+    for (auto _ : state)
+    {
+        object_predictor.PredictObjects();
+        benchmark::DoNotOptimize(object_predictor.GetPredictedObjects().GetStates(0U));
+    }
+    const auto& predicted_objects = object_predictor.GetPredictedObjects();
+    state.counters["states"] =
+        static_cast<double>(predicted_objects.GetNumberOfObjects() * predicted_objects.GetNumberOfSteps());
+    state.counters["bytes"] = static_cast<double>(predicted_objects.GetNumberOfObjects() *
+                                                  predicted_objects.GetNumberOfSteps() * sizeof(PredictedObjectState));
+}
+BENCHMARK(BM_ObjectPredictor_PredictObjects)
+    ->ArgsProduct({{1, 12, 64, 256, 1024}, {0, 1}})
+    ->ArgNames({"objects", "model"});
+
+/// @brief Benchmark evaluating all the lanes on the shared predicted objects (i.e. the per candidate work)
+///
+/// Arguments: {number of objects}
+void BM_LaneEvaluator_GetLaneEvaluation(benchmark::State& state)
+{
+    const auto data_source = DataSourceBuilder()
+                                 .WithFakePreviousPath(40)
+                                 .WithFrenetCoordinates(FrenetCoordinates{150.0, 6.0, 0.0, 0.0})
+                                 .WithSensorFusion(GetSensorFusion(state.range(0), 120))
+                                 .Build();
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    const LaneEvaluator lane_evaluator{data_source, object_predictor};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lane_evaluator.GetLaneEvaluation());
+    }
+}
+BENCHMARK(BM_LaneEvaluator_GetLaneEvaluation)->RangeMultiplier(4)->Range(1, 1024)->ArgName("objects");
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,92 @@
+///
+/// @file
+/// @brief Contains benchmarks for Occupancy Grid against the number of candidates and objects (dense traffic).
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/occupancy_grid.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+#include "planning/motion_planning/test/support/sensor_fusion.h"
+#include "planning/motion_planning/trajectory_planner.h"
+
+#include <benchmark/benchmark.h>
+
+namespace planning
+{
+namespace
+{
+/// @brief DataSource with given number of objects (ego at s=200 in center lane)
+DataSource GetDataSource(const std::int64_t number_of_objects)
+{
+    return DataSourceBuilder()
+        .WithPreviousPath(PreviousPathGlobal{})
+        .WithMapCoordinates(kHighwayMap)
+        .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+        .WithGlobalLaneId(GlobalLaneId::kCenter)
+        .WithSensorFusion(GetSensorFusion(number_of_objects, 300))
+        .Build();
+}
+
+/// @brief Benchmark querying the corridors of all candidates of a frame (incl. per frame update)
+///
+/// Arguments: {number of velocities, number of objects}
+void BM_OccupancyGrid_IsCorridorFree(benchmark::State& state)
+{
+    const auto data_source = GetDataSource(state.range(1));
+    LatticeOptions options{};
+    options.number_of_velocities = static_cast<std::size_t>(state.range(0));
+    options.velocity_resolution = units::velocity::meters_per_second_t{0.5};
+    const auto maneuvers = LatticeManeuverGenerator{options}.Generate(units::velocity::meters_per_second_t{20.0});
+    const auto candidates = TrajectoryPlanner{data_source}.GetPlannedTrajectories(maneuvers);
+
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    OccupancyGrid occupancy_grid{data_source, object_predictor};
+
+    std::size_t corridor_free = 0U;
+    for (auto _ : state)
+    {
+        occupancy_grid.Update();
+        corridor_free = 0U;
+        for (const auto& candidate : candidates)
+        {
+            corridor_free += occupancy_grid.IsCorridorFree(candidate) ? 1U : 0U;
+        }
+        benchmark::DoNotOptimize(corridor_free);
+    }
+    state.counters["candidates"] = static_cast<double>(candidates.size());
+    state.counters["corridor_free"] = static_cast<double>(corridor_free);
+}
+BENCHMARK(BM_OccupancyGrid_IsCorridorFree)
+    ->ArgsProduct({{1, 7, 30}, {12, 64, 256}})
+    ->ArgNames({"velocities", "objects"})
+    ->Unit(benchmark::kMicrosecond);
+
+/// @brief Benchmark per frame update only, reports memory (bounded by the grid options) and occupied cells
+///
+/// Arguments: {number of objects}
+void BM_OccupancyGrid_Update(benchmark::State& state)
+{
+    const auto data_source = GetDataSource(state.range(0));
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    OccupancyGrid occupancy_grid{data_source, object_predictor};
+
+    for (auto _ : state)
+    {
+        occupancy_grid.Update();
+    }
+    state.counters["memory_bytes"] = static_cast<double>(occupancy_grid.GetMemoryUsage());
+    state.counters["occupied_cells"] = static_cast<double>(occupancy_grid.GetNumberOfOccupiedCells());
+    state.counters["build_us"] = static_cast<double>(occupancy_grid.GetBuildDuration().count()) * 1e-3;
+}
+BENCHMARK(BM_OccupancyGrid_Update)
+    ->RangeMultiplier(4)
+    ->Range(4, 1024)
+    ->ArgName("objects")
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,246 @@
+///
+/// @file
+/// @brief Contains benchmarks for the heap volume of each Motion Planning stage, returning new trajectories (by value)
+/// against transforming reused candidate buffers in place.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+#include "planning/motion_planning/trajectory_evaluator.h"
+#include "planning/motion_planning/trajectory_optimizer.h"
+#include "planning/motion_planning/trajectory_planner.h"
+#include "planning/motion_planning/trajectory_prioritizer.h"
+#include "planning/motion_planning/trajectory_selector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace
+{
+/// @brief Number of bytes requested from the heap (by any thread) since program start
+std::atomic<std::size_t> allocated_bytes{0U};
+}  // namespace
+
+// replacements are not inlined, hence the compiler doesn't match malloc()/free() against new/delete expressions
+__attribute__((noinline)) void* operator new(std::size_t size)
+{
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc((size > 0U) ? size : 1U))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+__attribute__((noinline)) void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace planning
+{
+namespace
+{
+/// @brief Pipeline stages whose heap volume is measured
+enum class Stage : std::size_t
+{
+    kPlan = 0U,
+    kOptimize = 1U,
+    kRate = 2U,
+    kSelect = 3U,
+};
+
+/// @brief Names of the stage counters (indexed by Stage)
+const std::array<std::string, 4U> kStageCounters{"plan_kB", "optimize_kB", "rate_kB", "select_kB"};
+
+/// @brief Heap volume (in bytes) of each stage, accumulated over the benchmark iterations
+class StageVolumes
+{
+  public:
+    /// @brief Run given stage and accumulate the bytes it requested from the heap
+    template <typename Function>
+    void Measure(const Stage stage, Function&& function)
+    {
+        const auto before = allocated_bytes.load(std::memory_order_relaxed);
+        function();
+        volumes_[static_cast<std::size_t>(stage)] += allocated_bytes.load(std::memory_order_relaxed) - before;
+    }
+
+    /// @brief Report heap volume per frame (in kB) of each stage
+    void SetCounters(benchmark::State& state) const
+    {
+        for (std::size_t stage = 0U; stage < volumes_.size(); ++stage)
+        {
+            state.counters[kStageCounters[stage]] =
+                benchmark::Counter(static_cast<double>(volumes_[stage]) / 1024.0, benchmark::Counter::kAvgIterations);
+        }
+    }
+
+  private:
+    /// @brief Accumulated bytes (indexed by Stage)
+    std::array<std::size_t, 4U> volumes_{};
+};
+
+/// @brief Stages of the serial Motion Planning pipeline (without maneuver pruning and velocity planning)
+class Pipeline
+{
+  public:
+    /// @brief Constructor. Lattice of 3 lanes x number_of_velocities x number_of_horizons maneuvers
+    Pipeline(const std::size_t number_of_velocities, const std::size_t number_of_horizons)
+        : data_source_{DataSourceBuilder()
+                           .WithPreviousPath(PreviousPathGlobal{})
+                           .WithMapCoordinates(kHighwayMap)
+                           .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+                           .WithGlobalLaneId(GlobalLaneId::kCenter)
+                           .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+                           .Build()},
+          object_predictor_{data_source_},
+          trajectory_planner_{data_source_},
+          trajectory_optimizer_{data_source_},
+          trajectory_evaluator_{data_source_, object_predictor_, TrajectoryEvaluatorOptions{}},
+          trajectory_prioritizer_{},
+          trajectory_selector_{},
+          maneuvers_{}
+    {
+        LatticeOptions lattice_options{};
+        lattice_options.number_of_velocities = number_of_velocities;
+        lattice_options.number_of_horizons = number_of_horizons;
+        maneuvers_ = LatticeManeuverGenerator{lattice_options}.Generate(units::velocity::meters_per_second_t{20.0});
+        object_predictor_.PredictObjects();
+    }
+
+    /// @brief Number of planned candidates per frame
+    std::size_t GetNumberOfCandidates() const { return maneuvers_.size(); }
+
+    /// @brief Every stage returns new trajectories (copied from the previous stage's output)
+    Trajectory RunValueStages(StageVolumes& volumes) const
+    {
+        Trajectories planned_trajectories{};
+        Trajectories optimized_trajectories{};
+        Trajectories rated_trajectories{};
+        Trajectory selected_trajectory{};
+        volumes.Measure(Stage::kPlan,
+                        [&] { planned_trajectories = trajectory_planner_.GetPlannedTrajectories(maneuvers_); });
+        volumes.Measure(Stage::kOptimize,
+                        [&]
+                        {
+                            optimized_trajectories =
+                                trajectory_optimizer_.GetOptimizedTrajectories(planned_trajectories);
+                        });
+        volumes.Measure(Stage::kRate,
+                        [&]
+                        {
+                            EvaluationStatistics statistics{};
+                            rated_trajectories =
+                                trajectory_evaluator_.GetRatedTrajectories(optimized_trajectories, statistics);
+                        });
+        volumes.Measure(Stage::kSelect,
+                        [&]
+                        {
+                            selected_trajectory = trajectory_selector_.GetSelectedTrajectory(
+                                trajectory_prioritizer_.GetPrioritizedTrajectories(rated_trajectories));
+                        });
+        return selected_trajectory;
+    }
+
+    /// @brief Every stage transforms the candidates in place (buffers are reused across frames)
+    void RunInPlaceStages(StageVolumes& volumes, Trajectories& candidates, Trajectory& selected_trajectory) const
+    {
+        volumes.Measure(Stage::kPlan, [&] { trajectory_planner_.PlanTrajectories(maneuvers_, candidates); });
+        volumes.Measure(Stage::kOptimize, [&] { trajectory_optimizer_.OptimizeTrajectories(candidates); });
+        volumes.Measure(Stage::kRate,
+                        [&]
+                        {
+                            EvaluationStatistics statistics{};
+                            trajectory_evaluator_.RateTrajectories(candidates, statistics);
+                        });
+        volumes.Measure(Stage::kSelect,
+                        [&]
+                        {
+                            auto prioritized_trajectories =
+                                trajectory_prioritizer_.GetPrioritizedTrajectories(std::move(candidates));
+                            trajectory_selector_.SelectTrajectory(prioritized_trajectories, selected_trajectory);
+                            candidates = prioritized_trajectories.ReleaseTrajectories();
+                        });
+    }
+
+  private:
+    const DataSource data_source_;
+    ObjectPredictor object_predictor_;
+    const TrajectoryPlanner trajectory_planner_;
+    const TrajectoryOptimizer trajectory_optimizer_;
+    const TrajectoryEvaluator trajectory_evaluator_;
+    const TrajectoryPrioritizer trajectory_prioritizer_;
+    const TrajectorySelector trajectory_selector_;
+    std::vector<Maneuver> maneuvers_;
+};
+
+/// @brief Benchmark heap volume per frame and stage, each stage returning new trajectories
+///
+/// Arguments: {number of velocities, number of horizons}
+void BM_Pipeline_ValueStages(benchmark::State& state)
+{
+    const Pipeline pipeline{static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1))};
+    StageVolumes volumes{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(pipeline.RunValueStages(volumes));
+    }
+
+    volumes.SetCounters(state);
+    state.counters["candidates"] = static_cast<double>(pipeline.GetNumberOfCandidates());
+}
+BENCHMARK(BM_Pipeline_ValueStages)
+    ->ArgNames({"velocities", "horizons"})
+    ->Args({1, 1})
+    ->Args({7, 4})
+    ->Args({10, 12})
+    ->Unit(benchmark::kMicrosecond);
+
+/// @brief Benchmark heap volume per frame and stage, each stage transforming reused candidate buffers in place
+///
+/// Arguments: {number of velocities, number of horizons}
+void BM_Pipeline_InPlaceStages(benchmark::State& state)
+{
+    const Pipeline pipeline{static_cast<std::size_t>(state.range(0)), static_cast<std::size_t>(state.range(1))};
+    StageVolumes volumes{};
+    Trajectories candidates{};
+    Trajectory selected_trajectory{};
+
+    // warm up buffers (first frame allocates them)
+    StageVolumes warm_up{};
+    pipeline.RunInPlaceStages(warm_up, candidates, selected_trajectory);
+
+    for (auto _ : state)
+    {
+        pipeline.RunInPlaceStages(volumes, candidates, selected_trajectory);
+        benchmark::DoNotOptimize(selected_trajectory);
+    }
+
+    volumes.SetCounters(state);
+    state.counters["candidates"] = static_cast<double>(pipeline.GetNumberOfCandidates());
+}
+BENCHMARK(BM_Pipeline_InPlaceStages)
+    ->ArgNames({"velocities", "horizons"})
+    ->Args({1, 1})
+    ->Args({7, 4})
+    ->Args({10, 12})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace planning
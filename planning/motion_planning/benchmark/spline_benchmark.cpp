@@ -0,0 +1,58 @@
+///
+/// @file
+/// @brief Contains benchmarks for Spline implementations used by Trajectory Optimizer.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/fixed_size_spline.h"
+#include "planning/motion_planning/trajectory_optimizer.h"
+
+#include <benchmark/benchmark.h>
+#include <spline.h>
+
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+constexpr std::size_t kNumberOfSamples{50U};
+const FixedSizeSpline<kTrajectoryAnchorPoints>::Points kAnchorsX{-1.0, 0.0, 30.0, 60.0, 90.0};
+const FixedSizeSpline<kTrajectoryAnchorPoints>::Points kAnchorsY{-0.1, 0.0, 2.0, 4.0, 4.0};
+
+void BM_DynamicSpline(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::vector<double> points_x{kAnchorsX.begin(), kAnchorsX.end()};
+        std::vector<double> points_y{kAnchorsY.begin(), kAnchorsY.end()};
+        tk::spline spline;
+        spline.set_points(points_x, points_y);
+
+        double sum = 0.0;
+        for (std::size_t idx = 0U; idx < kNumberOfSamples; ++idx)
+        {
+            sum += spline(static_cast<double>(idx) * 0.6);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_DynamicSpline);
+
+void BM_FixedSizeSpline(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        const FixedSizeSpline<kTrajectoryAnchorPoints> spline{kAnchorsX, kAnchorsY};
+
+        double sum = 0.0;
+        for (std::size_t idx = 0U; idx < kNumberOfSamples; ++idx)
+        {
+            sum += spline(static_cast<double>(idx) * 0.6);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_FixedSizeSpline);
+
+}  // namespace
+}  // namespace planning
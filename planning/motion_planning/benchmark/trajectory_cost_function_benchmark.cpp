@@ -0,0 +1,138 @@
+///
+/// @file
+/// @brief Contains benchmarks for Trajectory Cost Function (per cost term) and its exhaustive or branch and bound
+/// evaluation against the number of candidates.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/collision_checker.h"
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/polynomial_trajectory_optimizer.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+#include "planning/motion_planning/test/support/sensor_fusion.h"
+#include "planning/motion_planning/trajectory_cost_function.h"
+#include "planning/motion_planning/trajectory_evaluator.h"
+#include "planning/motion_planning/trajectory_planner.h"
+
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+
+namespace planning
+{
+namespace
+{
+/// @brief Cost options with all the terms enabled (unit weights)
+CostOptions GetAllTermsOptions()
+{
+    CostOptions options{};
+    options.progress_weight = 1.0;
+    options.lateral_offset_weight = 1.0;
+    options.jerk_weight = 1.0;
+    options.acceleration_weight = 1.0;
+    options.curvature_weight = 1.0;
+    options.proximity_weight = 1.0;
+    options.lane_change_weight = 1.0;
+    return options;
+}
+
+/// @brief DataSource with ego at s=200 in center lane of the highway and given number of objects
+DataSource GetDataSource(const std::int64_t number_of_objects)
+{
+    return DataSourceBuilder()
+        .WithPreviousPath(PreviousPathGlobal{})
+        .WithMapCoordinates(kHighwayMap)
+        .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+        .WithGlobalLaneId(GlobalLaneId::kCenter)
+        .WithSensorFusion(GetSensorFusion(number_of_objects, 300))
+        .Build();
+}
+
+/// @brief Optimized lattice candidates with given number of velocities (spaced by 0.5 m/s)
+Trajectories GetCandidates(const IDataSource& data_source, const std::int64_t number_of_velocities)
+{
+    LatticeOptions lattice_options{};
+    lattice_options.number_of_velocities = static_cast<std::size_t>(number_of_velocities);
+    lattice_options.velocity_resolution = units::velocity::meters_per_second_t{0.5};
+    const auto lattice = LatticeManeuverGenerator{lattice_options};
+    const auto maneuvers = lattice.Generate(units::velocity::meters_per_second_t{20.0});
+    const auto planned_trajectories = TrajectoryPlanner{data_source}.GetPlannedTrajectories(maneuvers);
+    return PolynomialTrajectoryOptimizer{data_source, lattice.GetHorizons()}.GetOptimizedTrajectories(
+        planned_trajectories);
+}
+
+/// @brief Benchmark evaluating all the cost terms for all candidates of a frame (batched), reports the time spent
+/// per cost term (in microseconds, last iteration)
+///
+/// Arguments: {number of velocities, number of objects}
+void BM_TrajectoryCostFunction_Evaluate(benchmark::State& state)
+{
+    const auto data_source = GetDataSource(state.range(1));
+    const auto candidates = GetCandidates(data_source, state.range(0));
+
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    const TrajectoryCostFunction cost_function{data_source, &object_predictor, GetAllTermsOptions()};
+
+    CostEvaluation evaluation{};
+    for (auto _ : state)
+    {
+        evaluation = cost_function.Evaluate(candidates);
+        benchmark::DoNotOptimize(evaluation.costs.data());
+    }
+    state.counters["candidates"] = static_cast<double>(candidates.size());
+    state.counters["packing_us"] = static_cast<double>(evaluation.packing_duration.count()) * 1e-3;
+    for (std::size_t term = 0U; term < kNumberOfCostTerms; ++term)
+    {
+        std::stringstream name{};
+        name << static_cast<CostTerm>(term);
+        state.counters[name.str().substr(std::string{"CostTerm::k"}.size()) + "_us"] =
+            static_cast<double>(evaluation.durations[term].count()) * 1e-3;
+    }
+}
+BENCHMARK(BM_TrajectoryCostFunction_Evaluate)
+    ->ArgsProduct({{1, 7, 30}, {12, 64}})
+    ->ArgNames({"velocities", "objects"})
+    ->Unit(benchmark::kMicrosecond);
+
+/// @brief Benchmark rating all candidates of a frame (all cost terms and collision checking), exhaustive or by branch
+/// and bound, reports the number of pruned candidates
+///
+/// Arguments: {evaluation type, number of velocities, number of objects}
+void BM_TrajectoryEvaluator_GetRatedTrajectories(benchmark::State& state)
+{
+    const auto data_source = GetDataSource(state.range(2));
+    const auto candidates = GetCandidates(data_source, state.range(1));
+
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    CollisionChecker collision_checker{data_source, object_predictor};
+    collision_checker.Update();
+    TrajectoryEvaluatorOptions options{};
+    options.collision_checker = &collision_checker;
+    options.cost_options = GetAllTermsOptions();
+    options.evaluation_type = static_cast<EvaluationType>(state.range(0));
+    const TrajectoryEvaluator trajectory_evaluator{data_source, object_predictor, options};
+
+    EvaluationStatistics statistics{};
+    for (auto _ : state)
+    {
+        statistics = EvaluationStatistics{};
+        const auto rated_trajectories = trajectory_evaluator.GetRatedTrajectories(candidates, statistics);
+        benchmark::DoNotOptimize(rated_trajectories.data());
+    }
+    state.counters["candidates"] = static_cast<double>(statistics.candidates);
+    state.counters["evaluated"] = static_cast<double>(statistics.evaluated);
+    state.counters["pruned"] = static_cast<double>(statistics.GetPruned());
+}
+BENCHMARK(BM_TrajectoryEvaluator_GetRatedTrajectories)
+    ->ArgsProduct({{static_cast<std::int64_t>(EvaluationType::kExhaustive),
+                    static_cast<std::int64_t>(EvaluationType::kBranchAndBound)},
+                   {7, 30},
+                   {12, 64}})
+    ->ArgNames({"type", "velocities", "objects"})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace planning
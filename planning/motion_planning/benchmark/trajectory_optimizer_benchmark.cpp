@@ -0,0 +1,76 @@
+///
+/// @file
+/// @brief Contains benchmarks for Trajectory Optimizers against the number of candidates.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+#include "planning/motion_planning/polynomial_trajectory_optimizer.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+#include "planning/motion_planning/trajectory_optimizer.h"
+#include "planning/motion_planning/trajectory_planner.h"
+
+#include <benchmark/benchmark.h>
+
+namespace planning
+{
+namespace
+{
+/// @brief Lattice with given number of velocities (3 lanes x velocities x 4 horizons)
+LatticeOptions GetLatticeOptions(const std::int64_t number_of_velocities)
+{
+    LatticeOptions options{};
+    options.number_of_velocities = static_cast<std::size_t>(number_of_velocities);
+    options.velocity_resolution = units::velocity::meters_per_second_t{0.5};
+    return options;
+}
+
+/// @brief Benchmark optimizing all planned candidates of a frame with given optimizer
+///
+/// Arguments: {number of velocities}
+template <typename Optimizer>
+void BM_OptimizeTrajectories(benchmark::State& state)
+{
+    const auto data_source = DataSourceBuilder()
+                                 .WithPreviousPath(PreviousPathGlobal{})
+                                 .WithMapCoordinates(kHighwayMap)
+                                 .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+                                 .WithGlobalLaneId(GlobalLaneId::kCenter)
+                                 .Build();
+    const auto lattice = LatticeManeuverGenerator{GetLatticeOptions(state.range(0))};
+    const auto maneuvers = lattice.Generate(units::velocity::meters_per_second_t{20.0});
+    const auto planned_trajectories = TrajectoryPlanner{data_source}.GetPlannedTrajectories(maneuvers);
+    const auto optimizer = Optimizer{data_source, lattice.GetHorizons()};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(optimizer.GetOptimizedTrajectories(planned_trajectories));
+    }
+    state.counters["candidates"] = static_cast<double>(maneuvers.size());
+}
+
+/// @brief Spline Optimizer adapter (prepares nothing per horizon)
+class SplineOptimizer : public TrajectoryOptimizer
+{
+  public:
+    SplineOptimizer(const IDataSource& data_source, const std::vector<units::length::meter_t>& /*horizons*/)
+        : TrajectoryOptimizer{data_source}
+    {
+    }
+};
+
+BENCHMARK_TEMPLATE(BM_OptimizeTrajectories, SplineOptimizer)
+    ->ArgName("velocities")
+    ->Arg(1)
+    ->Arg(7)
+    ->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_OptimizeTrajectories, PolynomialTrajectoryOptimizer)
+    ->ArgName("velocities")
+    ->Arg(1)
+    ->Arg(7)
+    ->Arg(30)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace planning
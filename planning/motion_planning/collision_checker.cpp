@@ -0,0 +1,270 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/collision_checker.h"
+
+#include "planning/common/logging.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace planning
+{
+namespace
+{
+/// @brief Fields stored per unsorted footprint (x, y, cosine, sine, key)
+constexpr std::size_t kFootprintFields{5U};
+
+/// @brief Minimum distance (in meters) between consecutive waypoints to update the ego heading
+constexpr double kMinHeadingDistance{1e-6};
+
+/// @brief Count object footprints overlapping the ego footprint (separating axis test of oriented boxes).
+///
+/// @details Boxes are separated if the projections on any of the four box axes don't overlap. Loop body is branch
+/// free over structure of arrays, hence it is vectorized by the compiler.
+///
+/// @param ego_x [in] - ego center (x)
+/// @param ego_y [in] - ego center (y)
+/// @param ego_cos [in] - ego heading cosine
+/// @param ego_sin [in] - ego heading sine
+/// @param ego_half_length [in] - ego half length
+/// @param ego_half_width [in] - ego half width
+/// @param x [in] - object centers (x)
+/// @param y [in] - object centers (y)
+/// @param cos [in] - object heading cosines
+/// @param sin [in] - object heading sines
+/// @param count [in] - number of objects
+/// @param half_length [in] - object half length
+/// @param half_width [in] - object half width
+///
+/// @return number of overlapping objects
+inline std::size_t CountOverlaps(const double ego_x,
+                                 const double ego_y,
+                                 const double ego_cos,
+                                 const double ego_sin,
+                                 const double ego_half_length,
+                                 const double ego_half_width,
+                                 const double* const x,
+                                 const double* const y,
+                                 const double* const cos,
+                                 const double* const sin,
+                                 const std::size_t count,
+                                 const double half_length,
+                                 const double half_width) noexcept
+{
+    std::size_t overlaps = 0U;
+    for (std::size_t idx = 0U; idx < count; ++idx)
+    {
+        const double tx = x[idx] - ego_x;
+        const double ty = y[idx] - ego_y;
+
+        // relative orientation (cosine and sine of the heading difference)
+        const double abs_cos = std::fabs((ego_cos * cos[idx]) + (ego_sin * sin[idx]));
+        const double abs_sin = std::fabs((ego_cos * sin[idx]) - (ego_sin * cos[idx]));
+
+        const bool separated_ego_length = std::fabs((tx * ego_cos) + (ty * ego_sin)) >
+                                          (ego_half_length + (half_length * abs_cos) + (half_width * abs_sin));
+        const bool separated_ego_width = std::fabs((ty * ego_cos) - (tx * ego_sin)) >
+                                         (ego_half_width + (half_length * abs_sin) + (half_width * abs_cos));
+        const bool separated_length = std::fabs((tx * cos[idx]) + (ty * sin[idx])) >
+                                      ((ego_half_length * abs_cos) + (ego_half_width * abs_sin) + half_length);
+        const bool separated_width = std::fabs((ty * cos[idx]) - (tx * sin[idx])) >
+                                     ((ego_half_length * abs_sin) + (ego_half_width * abs_cos) + half_width);
+
+        overlaps += static_cast<std::size_t>(!(separated_ego_length | separated_ego_width | separated_length |
+                                               separated_width));
+    }
+    return overlaps;
+}
+}  // namespace
+
+CollisionChecker::CollisionChecker(const IDataSource& data_source, const IObjectPredictor& object_predictor)
+    : CollisionChecker{data_source, object_predictor, CollisionCheckerOptions{}}
+{
+}
+
+CollisionChecker::CollisionChecker(const IDataSource& data_source,
+                                   const IObjectPredictor& object_predictor,
+                                   const CollisionCheckerOptions& options)
+    : data_source_{data_source},
+      object_predictor_{object_predictor},
+      ego_half_length_{(0.5 * options.vehicle_length.value()) + options.safety_margin.value()},
+      ego_half_width_{(0.5 * options.vehicle_width.value()) + options.safety_margin.value()},
+      object_half_length_{0.5 * options.vehicle_length.value()},
+      object_half_width_{0.5 * options.vehicle_width.value()},
+      sweep_radius_{std::hypot(ego_half_length_, ego_half_width_) +
+                    std::hypot(object_half_length_, object_half_width_)},
+      number_of_objects_{0U},
+      number_of_steps_{0U},
+      time_step_{0.0},
+      axis_cos_{1.0},
+      axis_sin_{0.0},
+      keys_{},
+      x_{},
+      y_{},
+      cos_{},
+      sin_{},
+      unsorted_{},
+      order_{}
+{
+}
+
+void CollisionChecker::Update()
+{
+    const auto& predicted_objects = object_predictor_.GetPredictedObjects();
+    const auto map_coordinates = data_source_.GetMapCoordinates();
+    const auto yaw = data_source_.GetVehicleDynamics().yaw;
+
+    number_of_objects_ = (map_coordinates.size() < 2U) ? 0U : predicted_objects.GetNumberOfObjects();
+    number_of_steps_ = predicted_objects.GetNumberOfSteps();
+    time_step_ = predicted_objects.GetTimeStep().value();
+    axis_cos_ = std::cos(yaw.value());
+    axis_sin_ = std::sin(yaw.value());
+
+    const auto size = number_of_objects_ * number_of_steps_;
+    keys_.resize(size);
+    x_.resize(size);
+    y_.resize(size);
+    cos_.resize(size);
+    sin_.resize(size);
+    unsorted_.resize(size * kFootprintFields);
+    order_.resize(number_of_objects_);
+
+    // object by object, hence the map is searched forward along each object's (ascending) predicted positions
+    for (std::size_t object = 0U; object < number_of_objects_; ++object)
+    {
+        FrenetToGlobalConverter to_global{map_coordinates};
+        for (std::size_t step = 0U; step < number_of_steps_; ++step)
+        {
+            const auto& state = predicted_objects.GetState(step, object);
+            const auto position = to_global(state.s, state.d);
+            auto* const footprint = &unsorted_[((step * number_of_objects_) + object) * kFootprintFields];
+            footprint[0U] = position.x;
+            footprint[1U] = position.y;
+            footprint[2U] = to_global.GetCosHeading();
+            footprint[3U] = to_global.GetSinHeading();
+            footprint[4U] = (position.x * axis_cos_) + (position.y * axis_sin_);
+        }
+    }
+
+    // broad phase, sort each time step along the sweep axis. Order barely changes between consecutive time steps,
+    // hence each time step is insertion sorted starting from the order of the previous time step.
+    std::iota(order_.begin(), order_.end(), 0U);
+    for (std::size_t step = 0U; step < number_of_steps_; ++step)
+    {
+        const auto* const footprints = unsorted_.data() + (step * number_of_objects_ * kFootprintFields);
+        const auto get_key = [footprints](const std::size_t object)
+        { return footprints[(object * kFootprintFields) + 4U]; };
+        if (step == 0U)
+        {
+            std::sort(order_.begin(),
+                      order_.end(),
+                      [&get_key](const auto lhs, const auto rhs) { return get_key(lhs) < get_key(rhs); });
+        }
+        else
+        {
+            for (std::size_t idx = 1U; idx < number_of_objects_; ++idx)
+            {
+                const auto object = order_[idx];
+                const auto key = get_key(object);
+                auto position = idx;
+                while ((position > 0U) && (get_key(order_[position - 1U]) > key))
+                {
+                    order_[position] = order_[position - 1U];
+                    --position;
+                }
+                order_[position] = object;
+            }
+        }
+
+        const auto row = step * number_of_objects_;
+        for (std::size_t idx = 0U; idx < number_of_objects_; ++idx)
+        {
+            const auto* const footprint = &footprints[order_[idx] * kFootprintFields];
+            x_[row + idx] = footprint[0U];
+            y_[row + idx] = footprint[1U];
+            cos_[row + idx] = footprint[2U];
+            sin_[row + idx] = footprint[3U];
+            keys_[row + idx] = footprint[4U];
+        }
+    }
+
+    LOG(INFO) << "Collision checker footprints: " << number_of_objects_ << " x " << number_of_steps_ << " steps";
+}
+
+bool CollisionChecker::IsCollisionFree(const Trajectory& trajectory) const
+{
+    if ((number_of_objects_ == 0U) || (number_of_steps_ == 0U))
+    {
+        return true;
+    }
+
+    bool is_collision_free = true;
+    std::size_t tick = 0U;
+    GlobalCoordinates previous_waypoint{};
+    double cos_heading = axis_cos_;
+    double sin_heading = axis_sin_;
+    ForEachWaypoint(trajectory,
+                    [&](const GlobalCoordinates& waypoint)
+                    {
+                        ++tick;
+                        if (!is_collision_free)
+                        {
+                            return;
+                        }
+
+                        // ego heading along its path (initially vehicle heading)
+                        const double dx = waypoint.x - previous_waypoint.x;
+                        const double dy = waypoint.y - previous_waypoint.y;
+                        const double distance = std::sqrt((dx * dx) + (dy * dy));
+                        if ((tick > 1U) && (distance > kMinHeadingDistance))
+                        {
+                            cos_heading = dx / distance;
+                            sin_heading = dy / distance;
+                        }
+                        previous_waypoint = waypoint;
+
+                        const auto time = static_cast<double>(tick) * kWaypointSamplingTime;
+                        const auto step =
+                            std::min(static_cast<std::size_t>((time / time_step_) + 0.5), number_of_steps_ - 1U);
+                        is_collision_free = (GetNumberOfOverlaps(waypoint, cos_heading, sin_heading, step) == 0U);
+                    });
+    return is_collision_free;
+}
+
+std::size_t CollisionChecker::GetNumberOfOverlaps(const GlobalCoordinates& waypoint,
+                                                  const double cos_heading,
+                                                  const double sin_heading,
+                                                  const std::size_t step) const
+{
+    // broad phase, objects within sweep window around the waypoint's projection
+    const auto row = step * number_of_objects_;
+    const auto key = (waypoint.x * axis_cos_) + (waypoint.y * axis_sin_);
+    const auto keys_begin = keys_.begin() + static_cast<std::ptrdiff_t>(row);
+    const auto keys_end = keys_begin + static_cast<std::ptrdiff_t>(number_of_objects_);
+    const auto lower = std::lower_bound(keys_begin, keys_end, key - sweep_radius_);
+    const auto upper = std::upper_bound(lower, keys_end, key + sweep_radius_);
+
+    // narrow phase, oriented boxes
+    const auto first = row + static_cast<std::size_t>(std::distance(keys_begin, lower));
+    const auto count = static_cast<std::size_t>(std::distance(lower, upper));
+    return CountOverlaps(waypoint.x,
+                         waypoint.y,
+                         cos_heading,
+                         sin_heading,
+                         ego_half_length_,
+                         ego_half_width_,
+                         x_.data() + first,
+                         y_.data() + first,
+                         cos_.data() + first,
+                         sin_.data() + first,
+                         count,
+                         object_half_length_,
+                         object_half_width_);
+}
+
+}  // namespace planning
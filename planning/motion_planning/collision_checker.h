@@ -0,0 +1,113 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_COLLISION_CHECKER_H
+#define PLANNING_MOTION_PLANNING_COLLISION_CHECKER_H
+
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/i_collision_checker.h"
+#include "planning/motion_planning/i_data_source.h"
+#include "planning/motion_planning/i_object_predictor.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+/// @brief Checks trajectories against predicted object footprints at the waypoint timestamps.
+///
+/// @details Waypoint `i` (previous path followed by trajectory waypoints) is reached after `(i + 1)` simulator
+/// ticks and is checked against the objects predicted for that time. Ego and objects are oriented boxes (ego along
+/// its path, objects along the road).
+///
+/// Broad phase: per time step, objects are sorted by their projection onto the ego heading, hence only the objects
+/// within the sweep window (sum of both bounding radii) around the waypoint's projection are tested.
+/// Narrow phase: separating axis test of the oriented boxes, written branch free over structure of arrays
+/// (position and heading of the sorted objects) to let the compiler vectorize it.
+class CollisionChecker : public ICollisionChecker
+{
+  public:
+    /// @brief Constructor. Initializes with DataSource, Object Predictor and default footprints.
+    explicit CollisionChecker(const IDataSource& data_source, const IObjectPredictor& object_predictor);
+
+    /// @brief Constructor. Initializes with DataSource, Object Predictor and provided footprints.
+    explicit CollisionChecker(const IDataSource& data_source,
+                              const IObjectPredictor& object_predictor,
+                              const CollisionCheckerOptions& options);
+
+    /// @brief Convert predicted objects to footprints in Global Coordinates and sort them for the broad phase.
+    /// @note Without map (less than 2 map points) there are no footprints, i.e. every trajectory is collision free.
+    void Update() override;
+
+    /// @brief Check all the waypoints of the trajectory (at their timestamps) against predicted object footprints
+    bool IsCollisionFree(const Trajectory& trajectory) const override;
+
+  private:
+    /// @brief Number of object footprints overlapping the ego footprint at given waypoint and time step
+    std::size_t GetNumberOfOverlaps(const GlobalCoordinates& waypoint,
+                                    const double cos_heading,
+                                    const double sin_heading,
+                                    const std::size_t step) const;
+
+    /// @brief DataSource (contains information on Map Points, Vehicle Dynamics etc.)
+    const IDataSource& data_source_;
+
+    /// @brief Object Predictor (predicted once per frame)
+    const IObjectPredictor& object_predictor_;
+
+    /// @brief Ego footprint half length (including safety margin)
+    const double ego_half_length_;
+
+    /// @brief Ego footprint half width (including safety margin)
+    const double ego_half_width_;
+
+    /// @brief Object footprint half length
+    const double object_half_length_;
+
+    /// @brief Object footprint half width
+    const double object_half_width_;
+
+    /// @brief Sweep window (sum of ego and object bounding circle radii)
+    const double sweep_radius_;
+
+    /// @brief Number of objects (with footprints)
+    std::size_t number_of_objects_;
+
+    /// @brief Number of predicted time steps
+    std::size_t number_of_steps_;
+
+    /// @brief Duration between consecutive predicted time steps (in seconds)
+    double time_step_;
+
+    /// @brief Sweep axis (ego heading), cosine
+    double axis_cos_;
+
+    /// @brief Sweep axis (ego heading), sine
+    double axis_sin_;
+
+    /// @brief Projection of object positions onto sweep axis (time-major, ascending per time step)
+    std::vector<double> keys_;
+
+    /// @brief Object x positions (time-major, sorted as keys_)
+    std::vector<double> x_;
+
+    /// @brief Object y positions (time-major, sorted as keys_)
+    std::vector<double> y_;
+
+    /// @brief Object heading cosine (time-major, sorted as keys_)
+    std::vector<double> cos_;
+
+    /// @brief Object heading sine (time-major, sorted as keys_)
+    std::vector<double> sin_;
+
+    /// @brief Unsorted footprints (time-major, reused between frames), x, y, cosine, sine, key per object
+    std::vector<double> unsorted_;
+
+    /// @brief Sort order of the objects for a time step (reused between frames)
+    std::vector<std::size_t> order_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_COLLISION_CHECKER_H
@@ -28,7 +28,7 @@ inline constexpr bool IsInRangeExclusive(const T& value, const T& lower, const T
 DataSource::DataSource()
     : vehicle_dynamics_{},
       map_coordinates_{},
-      previous_path_global_{},
+      previous_path_global_{std::make_shared<const PreviousPathGlobal>()},
       previous_path_end_frenet_{},
       sensor_fusion_{},
       speed_limit_{kDefaultSpeedLimit}
@@ -47,7 +47,7 @@ void DataSource::SetMapCoordinates(const MapCoordinatesList& map_coordinates)
 
 void DataSource::SetPreviousPath(const PreviousPathGlobal& previous_path_global)
 {
-    previous_path_global_ = previous_path_global;
+    previous_path_global_ = std::make_shared<const PreviousPathGlobal>(previous_path_global);
 }
 
 void DataSource::SetPreviousPathEnd(const FrenetCoordinates& coords)
@@ -108,6 +108,11 @@ MapCoordinatesList DataSource::GetMapCoordinates() const
 }
 
 PreviousPathGlobal DataSource::GetPreviousPathInGlobalCoords() const
+{
+    return *previous_path_global_;
+}
+
+std::shared_ptr<const PreviousPathGlobal> DataSource::GetSharedPreviousPath() const
 {
     return previous_path_global_;
 }
@@ -52,6 +52,9 @@ class DataSource : public IDataSource
     /// @brief Get Previous Path Points in Global Coordinates
     PreviousPathGlobal GetPreviousPathInGlobalCoords() const override;
 
+    /// @brief Get Previous Path Points in Global Coordinates (shared, immutable until next SetPreviousPath)
+    std::shared_ptr<const PreviousPathGlobal> GetSharedPreviousPath() const override;
+
     /// @brief Get SensorFusion (Objects)
     SensorFusion GetSensorFusion() const override;
 
@@ -75,7 +78,7 @@ class DataSource : public IDataSource
     MapCoordinatesList map_coordinates_;
 
     /// @brief Previous Path Points (Global Coordinates)
-    PreviousPathGlobal previous_path_global_;
+    std::shared_ptr<const PreviousPathGlobal> previous_path_global_;
 
     /// @brief Previous Path End (previous trajectory end point in Frenet Coordinate)
     FrenetCoordinates previous_path_end_frenet_;
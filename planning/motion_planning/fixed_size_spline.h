@@ -0,0 +1,123 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_FIXED_SIZE_SPLINE_H
+#define PLANNING_MOTION_PLANNING_FIXED_SIZE_SPLINE_H
+
+#include <array>
+#include <cstddef>
+
+namespace planning
+{
+/// @brief Natural Cubic Spline with compile-time number of control points.
+///
+/// @details Solves the tridiagonal system for the second order coefficients on the stack (Thomas algorithm) and
+/// evaluates without any allocation. Outside of the control points the spline is extrapolated linearly (same as
+/// tk::spline with natural boundary conditions), hence both produce identical results for identical inputs.
+///
+/// @tparam N - number of control points (>= 3)
+template <std::size_t N>
+class FixedSizeSpline
+{
+  public:
+    static_assert(N >= 3U, "FixedSizeSpline requires at least 3 control points.");
+
+    /// @brief Container type for the control points (x or y values)
+    using Points = std::array<double, N>;
+
+    /// @brief Constructor. Initializes to zero valued spline.
+    constexpr FixedSizeSpline() : x_{}, y_{}, b_{}, c_{}, d_{} {}
+
+    /// @brief Constructor. Initializes spline through provided control points.
+    FixedSizeSpline(const Points& x, const Points& y) : FixedSizeSpline{} { SetPoints(x, y); }
+
+    /// @brief Set control points and calculate spline coefficients.
+    ///
+    /// @param x [in] - x values of control points (strictly increasing)
+    /// @param y [in] - y values of control points
+    void SetPoints(const Points& x, const Points& y) noexcept
+    {
+        x_ = x;
+        y_ = y;
+
+        std::array<double, N - 1U> h{};
+        for (std::size_t i = 0U; i < (N - 1U); ++i)
+        {
+            h[i] = x_[i + 1U] - x_[i];
+        }
+
+        // forward sweep on interior nodes (natural boundary: c[0] = c[N-1] = 0)
+        std::array<double, N> upper{};
+        std::array<double, N> rhs{};
+        for (std::size_t i = 1U; i < (N - 1U); ++i)
+        {
+            const double lower = h[i - 1U];
+            const double diagonal = 2.0 * (h[i - 1U] + h[i]) - (lower * upper[i - 1U]);
+            const double value = 3.0 * (((y_[i + 1U] - y_[i]) / h[i]) - ((y_[i] - y_[i - 1U]) / h[i - 1U]));
+            upper[i] = h[i] / diagonal;
+            rhs[i] = (value - (lower * rhs[i - 1U])) / diagonal;
+        }
+
+        // backward substitution
+        c_[N - 1U] = 0.0;
+        for (std::size_t i = N - 2U; i > 0U; --i)
+        {
+            c_[i] = rhs[i] - (upper[i] * c_[i + 1U]);
+        }
+        c_[0U] = 0.0;
+
+        for (std::size_t i = 0U; i < (N - 1U); ++i)
+        {
+            d_[i] = (c_[i + 1U] - c_[i]) / (3.0 * h[i]);
+            b_[i] = ((y_[i + 1U] - y_[i]) / h[i]) - ((h[i] / 3.0) * ((2.0 * c_[i]) + c_[i + 1U]));
+        }
+
+        // slope at last node is used for linear extrapolation
+        const double h_last = h[N - 2U];
+        d_[N - 1U] = 0.0;
+        b_[N - 1U] = (3.0 * d_[N - 2U] * h_last * h_last) + (2.0 * c_[N - 2U] * h_last) + b_[N - 2U];
+    }
+
+    /// @brief Evaluate spline at given x
+    double operator()(const double x) const noexcept
+    {
+        if (x <= x_[0U])
+        {
+            const double h = x - x_[0U];
+            return (b_[0U] * h) + y_[0U];
+        }
+
+        std::size_t idx = 0U;
+        for (std::size_t i = 1U; i < N; ++i)
+        {
+            idx += static_cast<std::size_t>(x_[i] <= x);
+        }
+
+        const double h = x - x_[idx];
+        if (idx == (N - 1U))
+        {
+            return (b_[idx] * h) + y_[idx];
+        }
+        return (((d_[idx] * h + c_[idx]) * h + b_[idx]) * h) + y_[idx];
+    }
+
+  private:
+    /// @brief Control points (x values)
+    Points x_;
+
+    /// @brief Control points (y values)
+    Points y_;
+
+    /// @brief First order coefficients
+    Points b_;
+
+    /// @brief Second order coefficients
+    Points c_;
+
+    /// @brief Third order coefficients
+    Points d_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_FIXED_SIZE_SPLINE_H
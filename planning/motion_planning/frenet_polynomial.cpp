@@ -0,0 +1,59 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/frenet_polynomial.h"
+
+namespace planning
+{
+FrenetPolynomialSolver::FrenetPolynomialSolver(const double duration) : duration_{duration}, quartic_{}, quintic_{}
+{
+    const double t = duration;
+    const double t2 = t * t;
+    const double t3 = t2 * t;
+    const double t4 = t3 * t;
+    const double t5 = t4 * t;
+
+    Matrix2 quartic{};
+    quartic << 3.0 * t2, 4.0 * t3,  //
+        6.0 * t, 12.0 * t2;
+    quartic_.compute(quartic);
+
+    Matrix3 quintic{};
+    quintic << t3, t4, t5,                //
+        3.0 * t2, 4.0 * t3, 5.0 * t4,     //
+        6.0 * t, 12.0 * t2, 20.0 * t3;
+    quintic_.compute(quintic);
+}
+
+double FrenetPolynomialSolver::GetDuration() const noexcept
+{
+    return duration_;
+}
+
+QuarticPolynomial FrenetPolynomialSolver::GetQuarticPolynomial(const FrenetState& start,
+                                                                const double end_velocity) const
+{
+    const double t = duration_;
+    const Eigen::Vector2d rhs{end_velocity - start.velocity - (start.acceleration * t), -start.acceleration};
+    const Eigen::Vector2d solution = quartic_.solve(rhs);
+
+    return QuarticPolynomial{
+        {start.position, start.velocity, 0.5 * start.acceleration, solution(0), solution(1)}, duration_};
+}
+
+QuinticPolynomial FrenetPolynomialSolver::GetQuinticPolynomial(const FrenetState& start,
+                                                                const double end_position) const
+{
+    const double t = duration_;
+    const double t2 = t * t;
+    const Eigen::Vector3d rhs{
+        end_position - (start.position + (start.velocity * t) + (0.5 * start.acceleration * t2)),
+        -(start.velocity + (start.acceleration * t)),
+        -start.acceleration};
+    const Eigen::Vector3d solution = quintic_.solve(rhs);
+
+    return QuinticPolynomial{
+        {start.position, start.velocity, 0.5 * start.acceleration, solution(0), solution(1), solution(2)}, duration_};
+}
+}  // namespace planning
@@ -0,0 +1,123 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_FRENET_POLYNOMIAL_H
+#define PLANNING_MOTION_PLANNING_FRENET_POLYNOMIAL_H
+
+#include <Eigen/Dense>
+
+#include <array>
+#include <cstddef>
+
+namespace planning
+{
+/// @brief One dimensional kinematic state (position, velocity and acceleration) along a Frenet axis
+struct FrenetState
+{
+    /// @brief Position (s or d)
+    double position{0.0};
+
+    /// @brief First derivative w.r.t. time
+    double velocity{0.0};
+
+    /// @brief Second derivative w.r.t. time
+    double acceleration{0.0};
+};
+
+/// @brief Polynomial p(t) = sum(coefficients[i] * t^i) over t = [0, duration], held constant in velocity afterwards
+///
+/// @tparam kOrder - polynomial order (4: quartic, 5: quintic)
+template <std::size_t kOrder>
+class Polynomial
+{
+  public:
+    /// @brief Coefficients in ascending powers of t
+    using Coefficients = std::array<double, kOrder + 1U>;
+
+    /// @brief Constructor. Initializes with coefficients valid until duration
+    Polynomial(const Coefficients& coefficients, const double duration) noexcept
+        : coefficients_{coefficients}, duration_{duration}, end_state_{Evaluate(duration)}
+    {
+    }
+
+    /// @brief Evaluate state at time t (t > duration continues with end velocity)
+    FrenetState operator()(const double t) const noexcept
+    {
+        if (t <= duration_)
+        {
+            return Evaluate(t);
+        }
+        return FrenetState{end_state_.position + (end_state_.velocity * (t - duration_)), end_state_.velocity, 0.0};
+    }
+
+    /// @brief Coefficients in ascending powers of t
+    const Coefficients& GetCoefficients() const noexcept { return coefficients_; }
+
+  private:
+    /// @brief Evaluate polynomial and its derivatives (Horner's method)
+    FrenetState Evaluate(const double t) const noexcept
+    {
+        FrenetState state{coefficients_[kOrder], 0.0, 0.0};
+        for (std::size_t idx = kOrder; idx > 0U; --idx)
+        {
+            state.acceleration = (state.acceleration * t) + state.velocity;
+            state.velocity = (state.velocity * t) + state.position;
+            state.position = (state.position * t) + coefficients_[idx - 1U];
+        }
+        state.acceleration *= 2.0;
+        return state;
+    }
+
+    /// @brief Coefficients in ascending powers of t
+    Coefficients coefficients_;
+
+    /// @brief Duration of the polynomial section
+    double duration_;
+
+    /// @brief State at the end of the polynomial section
+    FrenetState end_state_;
+};
+
+/// @brief Quartic Polynomial (longitudinal motion, velocity keeping)
+using QuarticPolynomial = Polynomial<4U>;
+
+/// @brief Quintic Polynomial (lateral motion, jerk minimal lane change)
+using QuinticPolynomial = Polynomial<5U>;
+
+/// @brief Solves jerk minimal quartic/quintic polynomials for a fixed duration.
+///
+/// @details Boundary condition matrices only depend on the duration, hence they are factored once on construction
+/// and every candidate (start/end state) afterwards costs a back substitution only.
+class FrenetPolynomialSolver
+{
+  public:
+    /// @brief Constructor. Factors boundary condition matrices for given duration (in seconds, > 0)
+    explicit FrenetPolynomialSolver(const double duration);
+
+    /// @brief Duration (in seconds) of the solved polynomials
+    double GetDuration() const noexcept;
+
+    /// @brief Quartic Polynomial from start state to end velocity (with zero end acceleration)
+    QuarticPolynomial GetQuarticPolynomial(const FrenetState& start, const double end_velocity) const;
+
+    /// @brief Quintic Polynomial from start state to end position (with zero end velocity and acceleration)
+    QuinticPolynomial GetQuinticPolynomial(const FrenetState& start, const double end_position) const;
+
+  private:
+    /// @brief Fixed size matrices are stored unaligned (members of classes kept in std::vector)
+    using Matrix2 = Eigen::Matrix<double, 2, 2, Eigen::DontAlign>;
+    using Matrix3 = Eigen::Matrix<double, 3, 3, Eigen::DontAlign>;
+
+    /// @brief Duration (in seconds)
+    double duration_;
+
+    /// @brief Factored boundary conditions for t^3, t^4 coefficients (end velocity, end acceleration)
+    Eigen::PartialPivLU<Matrix2> quartic_;
+
+    /// @brief Factored boundary conditions for t^3, t^4, t^5 coefficients (end position, velocity, acceleration)
+    Eigen::PartialPivLU<Matrix3> quintic_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_FRENET_POLYNOMIAL_H
@@ -0,0 +1,86 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_FRENET_TO_GLOBAL_CONVERTER_H
+#define PLANNING_MOTION_PLANNING_FRENET_TO_GLOBAL_CONVERTER_H
+
+#include "planning/datatypes/vehicle_dynamics.h"
+
+#include <cmath>
+#include <cstddef>
+
+namespace planning
+{
+/// @brief Converts Frenet Coordinates with ascending s to Global Coordinates (using map).
+///
+/// @details Map segment is searched forward from the previous query, hence converting a whole trajectory costs a
+/// single pass over the map instead of one search per waypoint.
+class FrenetToGlobalConverter
+{
+  public:
+    /// @brief Constructor. Initializes with map (at least 2 map points)
+    explicit FrenetToGlobalConverter(const MapCoordinatesList& map_coordinates)
+        : map_coordinates_{map_coordinates}, segment_{0U}, cos_heading_{1.0}, sin_heading_{0.0}
+    {
+        UpdateHeading();
+    }
+
+    /// @brief Convert Frenet Coordinates (s, d) to Global Coordinates
+    GlobalCoordinates operator()(const double s, const double d)
+    {
+        const auto last_segment = map_coordinates_.size() - 2U;
+        const auto previous_segment = segment_;
+        if (s < map_coordinates_[segment_].frenet_coords.s)
+        {
+            segment_ = 0U;
+        }
+        while ((segment_ < last_segment) && (map_coordinates_[segment_ + 1U].frenet_coords.s <= s))
+        {
+            ++segment_;
+        }
+        if (segment_ != previous_segment)
+        {
+            UpdateHeading();
+        }
+
+        const auto& start = map_coordinates_[segment_].global_coords;
+        const double segment_s = s - map_coordinates_[segment_].frenet_coords.s;
+
+        // d is measured to the right of the driving direction
+        return GlobalCoordinates{start.x + (segment_s * cos_heading_) + (d * sin_heading_),
+                                 start.y + (segment_s * sin_heading_) - (d * cos_heading_)};
+    }
+
+    /// @brief Cosine of the map heading at the last converted position
+    double GetCosHeading() const noexcept { return cos_heading_; }
+
+    /// @brief Sine of the map heading at the last converted position
+    double GetSinHeading() const noexcept { return sin_heading_; }
+
+  private:
+    /// @brief Update heading of the current map segment
+    void UpdateHeading()
+    {
+        const auto& start = map_coordinates_[segment_].global_coords;
+        const auto& end = map_coordinates_[segment_ + 1U].global_coords;
+        const double heading = std::atan2(end.y - start.y, end.x - start.x);
+        cos_heading_ = std::cos(heading);
+        sin_heading_ = std::sin(heading);
+    }
+
+    /// @brief Map Points
+    const MapCoordinatesList& map_coordinates_;
+
+    /// @brief Map segment (start point index) of the previous query
+    std::size_t segment_;
+
+    /// @brief Cosine of the current map segment heading
+    double cos_heading_;
+
+    /// @brief Sine of the current map segment heading
+    double sin_heading_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_FRENET_TO_GLOBAL_CONVERTER_H
@@ -0,0 +1,27 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_I_COLLISION_CHECKER_H
+#define PLANNING_MOTION_PLANNING_I_COLLISION_CHECKER_H
+
+#include "planning/datatypes/trajectory.h"
+
+namespace planning
+{
+/// @brief Interface for Collision Checker (trajectory against predicted objects over time)
+class ICollisionChecker
+{
+  public:
+    /// @brief Destructor
+    virtual ~ICollisionChecker() = default;
+
+    /// @brief Prepare predicted object footprints (to be called once per frame, after object prediction)
+    virtual void Update() = 0;
+
+    /// @brief Check all the waypoints of the trajectory (at their timestamps) against predicted object footprints
+    virtual bool IsCollisionFree(const Trajectory& trajectory) const = 0;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_I_COLLISION_CHECKER_H
@@ -10,6 +10,8 @@
 #include "planning/datatypes/trajectory.h"
 #include "planning/datatypes/vehicle_dynamics.h"
 
+#include <memory>
+
 namespace planning
 {
 using GlobalLaneId = LaneInformation::GlobalLaneId;
@@ -58,6 +60,9 @@ class IDataSource
     /// @brief Get Previous Path Points in Global Coordinates
     virtual PreviousPathGlobal GetPreviousPathInGlobalCoords() const = 0;
 
+    /// @brief Get Previous Path Points in Global Coordinates (shared, immutable until next SetPreviousPath)
+    virtual std::shared_ptr<const PreviousPathGlobal> GetSharedPreviousPath() const = 0;
+
     /// @brief Get SensorFusion (Objects)
     virtual SensorFusion GetSensorFusion() const = 0;
 
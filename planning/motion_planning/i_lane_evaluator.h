@@ -7,8 +7,28 @@
 
 #include "planning/datatypes/lane.h"
 
+#include <array>
+#include <cstddef>
+
 namespace planning
 {
+/// @brief Occupancy and Drivability summary for all local lanes (evaluated in a single pass over the objects)
+struct LaneEvaluation
+{
+    /// @brief Lane blocked by an object (indexed by LaneId: left, ego, right)
+    std::array<bool, 3U> occupied{};
+
+    /// @brief Lane drivable, i.e. valid and not blocked (indexed by LaneId: left, ego, right)
+    std::array<bool, 3U> drivable{};
+
+    /// @brief Drivability of given lane (false for invalid lane)
+    bool IsDrivable(const LaneInformation::LaneId lane_id) const noexcept
+    {
+        const auto lane = static_cast<std::size_t>(lane_id);
+        return (lane < drivable.size()) && drivable[lane];
+    }
+};
+
 /// @brief Evaluates given Lane to be collision free
 class ILaneEvaluator
 {
@@ -19,6 +39,9 @@ class ILaneEvaluator
     /// @brief Evaluates Lane to be drivable (collision free)
     virtual bool IsDrivableLane(const LaneId lane_id) const = 0;
 
+    /// @brief Evaluates Occupancy and Drivability of all the lanes at once
+    virtual LaneEvaluation GetLaneEvaluation() const = 0;
+
     /// @brief Evaluates Lane to be Valid Lane
     virtual bool IsValidLane(const LaneId lane_id) const = 0;
 };
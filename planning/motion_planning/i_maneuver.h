@@ -25,6 +25,9 @@ class IManeuver
 
     /// @brief Get Target Velocity for the Maneuver
     virtual units::velocity::meters_per_second_t GetVelocity() const = 0;
+
+    /// @brief Get Planning Horizon (longitudinal spacing of anchor waypoints) for the Maneuver
+    virtual units::length::meter_t GetHorizon() const = 0;
 };
 }  // namespace planning
 #endif  /// PLANNING_MOTION_PLANNING_I_MANEUVER_H
@@ -0,0 +1,136 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_I_OBJECT_PREDICTOR_H
+#define PLANNING_MOTION_PLANNING_I_OBJECT_PREDICTOR_H
+
+#include <units.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace planning
+{
+/// @brief Predicted Object State (in Frenet Coordinates) at a single time step
+struct PredictedObjectState
+{
+    /// @brief Longitudinal position (in meters)
+    double s;
+
+    /// @brief Lateral position (in meters)
+    double d;
+
+    /// @brief Longitudinal velocity (in meters per seconds)
+    double velocity;
+};
+
+/// @brief Predicted States of all the objects over the planning horizon.
+///
+/// @details Buffer is time-major, i.e. states of all the objects for a time step are stored contiguously
+/// (state of object `n` at step `k` is at `k * number_of_objects + n`). Time step `0` is the current object state.
+class PredictedObjects
+{
+  public:
+    /// @brief Resize buffer for given number of objects and time steps (keeps allocated memory)
+    void Resize(const std::size_t number_of_objects,
+                const std::size_t number_of_steps,
+                const units::time::second_t time_step)
+    {
+        number_of_objects_ = number_of_objects;
+        number_of_steps_ = number_of_steps;
+        time_step_ = time_step.value();
+        ids_.resize(number_of_objects);
+        states_.resize(number_of_objects * number_of_steps);
+    }
+
+    /// @brief Number of predicted objects
+    std::size_t GetNumberOfObjects() const noexcept { return number_of_objects_; }
+
+    /// @brief Number of predicted time steps (including current time step)
+    std::size_t GetNumberOfSteps() const noexcept { return number_of_steps_; }
+
+    /// @brief Duration between consecutive time steps
+    units::time::second_t GetTimeStep() const noexcept { return units::time::second_t{time_step_}; }
+
+    /// @brief Closest time step for given time (clamped to the prediction horizon)
+    std::size_t GetStep(const units::time::second_t time) const noexcept
+    {
+        if ((number_of_steps_ == 0U) || (time_step_ <= 0.0) || (time.value() <= 0.0))
+        {
+            return 0U;
+        }
+        const auto step = static_cast<std::size_t>(std::lround(time.value() / time_step_));
+        return std::min(step, number_of_steps_ - 1U);
+    }
+
+    /// @brief Object Id (from SensorFusion) for given object index
+    std::int32_t GetObjectId(const std::size_t object) const { return ids_[object]; }
+
+    /// @brief Set Object Id (from SensorFusion) for given object index
+    void SetObjectId(const std::size_t object, const std::int32_t id) { ids_[object] = id; }
+
+    /// @brief Predicted states of all the objects at given time step
+    const PredictedObjectState* GetStates(const std::size_t step) const
+    {
+        return states_.data() + (step * number_of_objects_);
+    }
+
+    /// @brief Predicted states of all the objects at given time step (mutable, used by the predictor)
+    PredictedObjectState* GetStates(const std::size_t step) { return states_.data() + (step * number_of_objects_); }
+
+    /// @brief Predicted state of given object at given time step
+    const PredictedObjectState& GetState(const std::size_t step, const std::size_t object) const
+    {
+        return states_[(step * number_of_objects_) + object];
+    }
+
+  private:
+    /// @brief Number of predicted objects
+    std::size_t number_of_objects_{0U};
+
+    /// @brief Number of predicted time steps
+    std::size_t number_of_steps_{0U};
+
+    /// @brief Duration between consecutive time steps (in seconds)
+    double time_step_{0.0};
+
+    /// @brief Object Ids (indexed by object)
+    std::vector<std::int32_t> ids_{};
+
+    /// @brief Predicted states (time-major)
+    std::vector<PredictedObjectState> states_{};
+};
+
+/// @brief Object velocities of the previous frame (by object id), used to estimate object accelerations
+using ObjectHistory = std::unordered_map<std::int32_t, double>;
+
+/// @brief Interface for Object Predictor
+class IObjectPredictor
+{
+  public:
+    /// @brief Destructor
+    virtual ~IObjectPredictor() = default;
+
+    /// @brief Predict all the objects over the planning horizon (to be called once per frame)
+    virtual void PredictObjects() = 0;
+
+    /// @brief Get Predicted Objects of the last prediction (shared by all the downstream stages)
+    virtual const PredictedObjects& GetPredictedObjects() const = 0;
+
+    /// @brief Forget object history of previous frames (e.g. before an unrelated scenario)
+    virtual void Reset() = 0;
+
+    /// @brief Get object history carried to the next frame
+    virtual const ObjectHistory& GetObjectHistory() const = 0;
+
+    /// @brief Set object history carried to the next frame (e.g. restored after planning a speculative frame)
+    virtual void SetObjectHistory(const ObjectHistory& object_history) = 0;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_I_OBJECT_PREDICTOR_H
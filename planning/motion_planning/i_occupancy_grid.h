@@ -0,0 +1,27 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_I_OCCUPANCY_GRID_H
+#define PLANNING_MOTION_PLANNING_I_OCCUPANCY_GRID_H
+
+#include "planning/datatypes/trajectory.h"
+
+namespace planning
+{
+/// @brief Interface for Occupancy Grid (Frenet space-time occupancy of predicted objects)
+class IOccupancyGrid
+{
+  public:
+    /// @brief Destructor
+    virtual ~IOccupancyGrid() = default;
+
+    /// @brief Fill occupancy from predicted objects (to be called once per frame, after object prediction)
+    virtual void Update() = 0;
+
+    /// @brief Check the corridor swept by the trajectory (lanes and longitudinal extent over time) to be unoccupied
+    virtual bool IsCorridorFree(const Trajectory& trajectory) const = 0;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_I_OCCUPANCY_GRID_H
@@ -7,12 +7,36 @@
 
 #include "planning/datatypes/sensor_fusion.h"
 #include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/i_lane_evaluator.h"
 #include "planning/motion_planning/i_trajectory_planner.h"
 
+#include <cstddef>
 #include <vector>
 
 namespace planning
 {
+/// @brief Evaluation counters of the rated candidates (accumulated over calls)
+struct EvaluationStatistics
+{
+    /// @brief Number of valid candidates
+    std::size_t candidates{0U};
+
+    /// @brief Number of candidates with all their cost terms evaluated
+    std::size_t evaluated{0U};
+
+    /// @brief Number of candidates pruned by their lower bound (no cost term evaluated)
+    std::size_t pruned_by_bound{0U};
+
+    /// @brief Number of candidates pruned once their partial cost exceeded the best cost
+    std::size_t pruned_by_partial_cost{0U};
+
+    /// @brief Number of pruned candidates (not rated)
+    std::size_t GetPruned() const noexcept
+    {
+        return pruned_by_bound + pruned_by_partial_cost;
+    }
+};
+
 /// @brief Interface for Trajectory Evaluator
 class ITrajectoryEvaluator
 {
@@ -23,6 +47,36 @@ class ITrajectoryEvaluator
     /// @brief Get Rated Trajectories for all the optimized trajectories.
     /// @note Invalid Trajectories will not be rated and are removed.
     virtual Trajectories GetRatedTrajectories(const Trajectories& optimized_trajectories) const = 0;
+
+    /// @brief Get Rated Trajectories for all the optimized trajectories and accumulate evaluation counters.
+    /// @note Invalid Trajectories will not be rated and are removed, so are candidates pruned by branch and bound
+    /// (i.e. which can't be the best one).
+    virtual Trajectories GetRatedTrajectories(const Trajectories& optimized_trajectories,
+                                              EvaluationStatistics& statistics) const = 0;
+
+    /// @brief Rate all the optimized trajectories in place and accumulate evaluation counters.
+    /// @note Invalid and pruned Trajectories are removed from provided trajectories (order of the rated ones is kept).
+    virtual void RateTrajectories(Trajectories& trajectories, EvaluationStatistics& statistics) const = 0;
+
+    /// @brief Rate all the optimized trajectories in place with already evaluated lanes and accumulate evaluation
+    /// counters.
+    /// @note Invalid and pruned Trajectories are removed from provided trajectories (order of the rated ones is kept).
+    virtual void RateTrajectories(Trajectories& trajectories,
+                                  const LaneEvaluation& lane_evaluation,
+                                  EvaluationStatistics& statistics) const = 0;
+
+    /// @brief Check whether optimized trajectory is valid (i.e. to be rated).
+    virtual bool IsValidTrajectory(const Trajectory& optimized_trajectory) const = 0;
+
+    /// @brief Get Rated Trajectory for a single (valid) optimized trajectory.
+    virtual Trajectory GetRatedTrajectory(const Trajectory& optimized_trajectory) const = 0;
+
+    /// @brief Evaluate all the lanes once (to be shared by rating any number of trajectories of the same frame).
+    virtual LaneEvaluation GetLaneEvaluation() const = 0;
+
+    /// @brief Get Rated Trajectory for a single (valid) optimized trajectory with already evaluated lanes.
+    virtual Trajectory GetRatedTrajectory(const Trajectory& optimized_trajectory,
+                                          const LaneEvaluation& lane_evaluation) const = 0;
 };
 }  // namespace planning
 #endif  /// PLANNING_MOTION_PLANNING_I_TRAJECTORY_EVALUATOR_H
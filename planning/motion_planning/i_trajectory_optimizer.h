@@ -20,6 +20,13 @@ class ITrajectoryOptimizer
 
     /// @brief Get Optimized Trajectories for all the trajectories provided.
     virtual Trajectories GetOptimizedTrajectories(const Trajectories& trajectories) const = 0;
+
+    /// @brief Get Optimized Trajectory for a single trajectory provided.
+    virtual Trajectory GetOptimizedTrajectory(const Trajectory& trajectory) const = 0;
+
+    /// @brief Optimize all the (planned) trajectories provided in place, i.e. their planned waypoints are replaced by
+    /// the optimized waypoints reusing the waypoints' capacity.
+    virtual void OptimizeTrajectories(Trajectories& trajectories) const = 0;
 };
 }  // namespace planning
 
@@ -22,6 +22,13 @@ class ITrajectoryPlanner
 
     /// @brief Get Planned Trajectories for each maneuvers provided.
     virtual Trajectories GetPlannedTrajectories(const std::vector<Maneuver>& maneuvers) const = 0;
+
+    /// @brief Plan Trajectories for each maneuver provided into given trajectories (reused across frames, i.e.
+    /// resized to the number of maneuvers and their waypoints' capacity is kept).
+    virtual void PlanTrajectories(const std::vector<Maneuver>& maneuvers, Trajectories& trajectories) const = 0;
+
+    /// @brief Get Planned Trajectory for a single maneuver (with provided unique id).
+    virtual Trajectory GetPlannedTrajectory(const Maneuver& maneuver, const std::int32_t unique_id) const = 0;
 };
 }  // namespace planning
 #endif  /// PLANNING_MOTION_PLANNING_I_TRAJECTORY_PLANNER_H
@@ -7,14 +7,10 @@
 
 #include "planning/datatypes/trajectory.h"
 #include "planning/motion_planning/i_trajectory_planner.h"
-
-#include <queue>
+#include "planning/motion_planning/prioritized_trajectories.h"
 
 namespace planning
 {
-/// @brief typename for prioritized queue.
-using PrioritizedTrajectories = std::priority_queue<Trajectory, std::vector<Trajectory>, std::greater<Trajectory>>;
-
 /// @brief Interface for Trajectory Prioritizer
 class ITrajectoryPrioritizer
 {
@@ -23,7 +19,8 @@ class ITrajectoryPrioritizer
     virtual ~ITrajectoryPrioritizer() = default;
 
     /// @brief Get Prioritized Trajectories for rated trajectories provided.
-    virtual PrioritizedTrajectories GetPrioritizedTrajectories(const Trajectories& trajectories) const = 0;
+    /// @note Trajectories are taken over by the prioritized trajectories (move them in to avoid copies).
+    virtual PrioritizedTrajectories GetPrioritizedTrajectories(Trajectories trajectories) const = 0;
 };
 }  // namespace planning
 #endif  /// PLANNING_MOTION_PLANNING_I_TRAJECTORY_PRIORITIZER_H
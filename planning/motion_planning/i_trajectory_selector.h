@@ -18,7 +18,14 @@ class ITrajectorySelector
     virtual ~ITrajectorySelector() = default;
 
     /// @brief Get Selected Trajectory from the prioritized trajectories provided.
-    virtual Trajectory GetSelectedTrajectory(const PrioritizedTrajectories& prioritized_trajectories) const = 0;
+    /// @note Only the selected trajectory is moved out (move the prioritized trajectories in to avoid copies).
+    virtual Trajectory GetSelectedTrajectory(PrioritizedTrajectories prioritized_trajectories) const = 0;
+
+    /// @brief Select Trajectory from the prioritized trajectories provided into given selected trajectory.
+    /// @note Prioritized trajectories are kept (e.g. to be reused), the selected one is copied into
+    /// selected_trajectory reusing its waypoints' capacity.
+    virtual void SelectTrajectory(const PrioritizedTrajectories& prioritized_trajectories,
+                                  Trajectory& selected_trajectory) const = 0;
 };
 }  // namespace planning
 #endif  /// PLANNING_MOTION_PLANNING_I_TRAJECTORY_SELECTOR_H
@@ -21,6 +21,12 @@ class IVelocityPlanner
 
     /// @brief Get Calculated Target Velocity
     virtual units::velocity::meters_per_second_t GetTargetVelocity() const = 0;
+
+    /// @brief Reset Target Velocity to its initial value (i.e. forget previous frames)
+    virtual void Reset() = 0;
+
+    /// @brief Set Target Velocity carried to the next frame (e.g. restored after planning a speculative frame)
+    virtual void SetTargetVelocity(const units::velocity::meters_per_second_t target_velocity) = 0;
 };
 }  // namespace planning
 
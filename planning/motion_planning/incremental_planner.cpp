@@ -0,0 +1,194 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/incremental_planner.h"
+
+#include "planning/common/logging.h"
+#include "planning/datatypes/sensor_fusion.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace planning
+{
+namespace
+{
+/// @brief Target velocity change (in meters per seconds) tolerated before replanning
+constexpr double kVelocityTolerance{1e-3};
+
+/// @brief Distance (in meters) between previous path end and last sent waypoint tolerated before replanning
+constexpr double kPathTolerance{1e-2};
+}  // namespace
+
+IncrementalPlanner::IncrementalPlanner(const IDataSource& data_source)
+    : data_source_{data_source},
+      has_selected_trajectory_{false},
+      selected_trajectory_{},
+      spline_{},
+      arc_length_table_{},
+      arc_length_{0.0},
+      path_size_{0U},
+      last_waypoint_{},
+      relevant_objects_{},
+      statistics_{}
+{
+}
+
+ReplanningTrigger IncrementalPlanner::GetReplanningTrigger(
+    const units::velocity::meters_per_second_t target_velocity) const
+{
+    if (!has_selected_trajectory_)
+    {
+        return ReplanningTrigger::kNoPreviousPlan;
+    }
+
+    if ((selected_trajectory_.lane_id != LaneId::kEgo) ||
+        (data_source_.GetGlobalLaneId() != selected_trajectory_.global_lane_id))
+    {
+        return ReplanningTrigger::kLaneChange;
+    }
+
+    if (std::fabs((target_velocity - selected_trajectory_.velocity).value()) > kVelocityTolerance)
+    {
+        return ReplanningTrigger::kVelocityChange;
+    }
+
+    const auto relevant_objects = GetRelevantObjects();
+    if (!std::includes(
+            relevant_objects_.begin(), relevant_objects_.end(), relevant_objects.begin(), relevant_objects.end()))
+    {
+        return ReplanningTrigger::kNewObject;
+    }
+
+    const auto previous_path = data_source_.GetSharedPreviousPath();
+    if (previous_path->empty() || (previous_path->size() > path_size_) ||
+        ((path_size_ - previous_path->size()) > kTotalWaypoints) ||
+        (std::hypot(previous_path->back().x - last_waypoint_.x, previous_path->back().y - last_waypoint_.y) >
+         kPathTolerance))
+    {
+        return ReplanningTrigger::kPathDiverged;
+    }
+
+    const auto required_arc_length =
+        arc_length_ + (static_cast<double>(GetConsumedWaypoints()) * selected_trajectory_.velocity.value() *
+                       kWaypointSamplingTime);
+    if (required_arc_length > arc_length_table_.GetLength())
+    {
+        return ReplanningTrigger::kSplineExhausted;
+    }
+
+    return ReplanningTrigger::kNone;
+}
+
+Trajectory IncrementalPlanner::GetExtendedTrajectory()
+{
+    const auto n_waypoints = GetConsumedWaypoints();
+
+    std::array<double, kTotalWaypoints> arc_lengths{};
+    for (std::size_t idx = 0U; idx < n_waypoints; ++idx)
+    {
+        arc_lengths[idx] = arc_length_ + (static_cast<double>(idx + 1U) * selected_trajectory_.velocity.value() *
+                                          kWaypointSamplingTime);
+    }
+    std::array<double, kTotalWaypoints> x{};
+    arc_length_table_.GetX(arc_lengths, n_waypoints, x);
+
+    auto extended_trajectory = selected_trajectory_;
+    extended_trajectory.previous_path = data_source_.GetSharedPreviousPath();
+    extended_trajectory.waypoints.reserve(n_waypoints);
+
+    const double cos_yaw = std::cos(selected_trajectory_.yaw.value());
+    const double sin_yaw = std::sin(selected_trajectory_.yaw.value());
+    for (std::size_t idx = 0U; idx < n_waypoints; ++idx)
+    {
+        const double y = spline_(x[idx]);
+        extended_trajectory.waypoints.push_back(
+            GlobalCoordinates{selected_trajectory_.position.x + (x[idx] * cos_yaw) - (y * sin_yaw),
+                              selected_trajectory_.position.y + (x[idx] * sin_yaw) + (y * cos_yaw)});
+    }
+
+    if (n_waypoints > 0U)
+    {
+        arc_length_ = arc_lengths[n_waypoints - 1U];
+        last_waypoint_ = extended_trajectory.waypoints.back();
+    }
+    relevant_objects_ = GetRelevantObjects();
+    ++statistics_.extended_frames;
+
+    LOG(INFO) << "Extended selected trajectory by " << n_waypoints << " waypoints. " << statistics_;
+    return extended_trajectory;
+}
+
+void IncrementalPlanner::SetSelectedTrajectory(const Trajectory& planned_trajectory,
+                                               const Trajectory& selected_trajectory,
+                                               const ReplanningTrigger trigger)
+{
+    ++statistics_.replanned_frames;
+    ++statistics_.triggers[static_cast<std::size_t>(trigger)];
+
+    // anchor waypoints (in local coordinates) define the spline the selected trajectory was sampled on
+    const auto& anchors = planned_trajectory.waypoints;
+    has_selected_trajectory_ = (anchors.size() == kTrajectoryAnchorPoints) && !selected_trajectory.waypoints.empty();
+    if (has_selected_trajectory_)
+    {
+        FixedSizeSpline<kTrajectoryAnchorPoints>::Points points_x{};
+        FixedSizeSpline<kTrajectoryAnchorPoints>::Points points_y{};
+        for (std::size_t idx = 0U; idx < kTrajectoryAnchorPoints; ++idx)
+        {
+            points_x[idx] = anchors[idx].x;
+            points_y[idx] = anchors[idx].y;
+        }
+        spline_.SetPoints(points_x, points_y);
+        arc_length_table_.Build(spline_, points_x.back());
+
+        arc_length_ = static_cast<double>(selected_trajectory.waypoints.size()) *
+                      selected_trajectory.velocity.value() * kWaypointSamplingTime;
+        path_size_ = GetPreviousPathSize(selected_trajectory) + selected_trajectory.waypoints.size();
+        last_waypoint_ = selected_trajectory.waypoints.back();
+        relevant_objects_ = GetRelevantObjects();
+
+        selected_trajectory_ = selected_trajectory;
+        selected_trajectory_.previous_path = nullptr;
+        selected_trajectory_.waypoints.clear();
+    }
+
+    LOG(INFO) << "Replanned all trajectories (trigger: " << trigger << "). " << statistics_;
+}
+
+void IncrementalPlanner::Reset()
+{
+    has_selected_trajectory_ = false;
+    arc_length_ = 0.0;
+    path_size_ = 0U;
+    relevant_objects_.clear();
+}
+
+const IncrementalPlanningStatistics& IncrementalPlanner::GetStatistics() const
+{
+    return statistics_;
+}
+
+std::vector<std::int32_t> IncrementalPlanner::GetRelevantObjects() const
+{
+    const auto ego_position = data_source_.GetVehicleDynamics().frenet_coords;
+    const auto sensor_fusion = data_source_.GetSensorFusion();
+
+    std::vector<std::int32_t> relevant_objects{};
+    for (const auto& obj : sensor_fusion.objs)
+    {
+        if (std::fabs(obj.frenet_coords.s - ego_position.s) < gkFarDistanceThreshold.value())
+        {
+            relevant_objects.push_back(obj.idx);
+        }
+    }
+    std::sort(relevant_objects.begin(), relevant_objects.end());
+    return relevant_objects;
+}
+
+std::size_t IncrementalPlanner::GetConsumedWaypoints() const
+{
+    const auto previous_path_size = data_source_.GetSharedPreviousPath()->size();
+    return (previous_path_size < path_size_) ? (path_size_ - previous_path_size) : 0U;
+}
+}  // namespace planning
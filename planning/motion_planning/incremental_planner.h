@@ -0,0 +1,162 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_INCREMENTAL_PLANNER_H
+#define PLANNING_MOTION_PLANNING_INCREMENTAL_PLANNER_H
+
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/fixed_size_spline.h"
+#include "planning/motion_planning/i_data_source.h"
+#include "planning/motion_planning/trajectory_optimizer.h"
+
+#include <units.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace planning
+{
+/// @brief Reason for full replanning in incremental mode
+enum class ReplanningTrigger : std::uint8_t
+{
+    kNone = 0U,              ///< steady state, previous selected trajectory is extended
+    kNoPreviousPlan = 1U,    ///< no (extendable) selected trajectory from previous frame
+    kLaneChange = 2U,        ///< selected trajectory changes lane or ego changed lane
+    kNewObject = 3U,         ///< new object entered the relevance window
+    kVelocityChange = 4U,    ///< target velocity differs from selected trajectory's velocity
+    kPathDiverged = 5U,      ///< previous path doesn't continue the previously sent waypoints
+    kSplineExhausted = 6U,   ///< extension would leave the spline's anchor waypoints
+};
+
+/// @brief Incremental planning counters (hit rate of steady state frames)
+struct IncrementalPlanningStatistics
+{
+    /// @brief Number of frames extending the previous selected trajectory
+    std::size_t extended_frames{0U};
+
+    /// @brief Number of frames with full replanning (any trigger)
+    std::size_t replanned_frames{0U};
+
+    /// @brief Number of full replanning per trigger (indexed by ReplanningTrigger)
+    std::array<std::size_t, 7U> triggers{};
+
+    /// @brief Ratio of extended frames to all frames (0 if no frame was planned)
+    double GetHitRate() const noexcept
+    {
+        const auto frames = extended_frames + replanned_frames;
+        return (frames > 0U) ? (static_cast<double>(extended_frames) / static_cast<double>(frames)) : 0.0;
+    }
+};
+
+/// @brief Incremental Planner. Keeps the selected trajectory (with its spline) and, in steady state, extends its
+/// tail by the waypoints consumed since the previous frame instead of replanning all candidates.
+///
+/// @note Extension follows the spline through the planned anchor waypoints with arc length resampling, hence it
+/// matches trajectories produced by TrajectoryOptimizer (SplineType::kFixedSize, ResamplingType::kArcLength).
+class IncrementalPlanner
+{
+  public:
+    /// @brief Constructor. Initializes with provided DataSource
+    explicit IncrementalPlanner(const IDataSource& data_source);
+
+    /// @brief Evaluate whether the current frame requires full replanning.
+    ///
+    /// @param target_velocity [in] - current target velocity (from Velocity Planner)
+    ///
+    /// @return ReplanningTrigger::kNone if the previous selected trajectory can be extended
+    ReplanningTrigger GetReplanningTrigger(const units::velocity::meters_per_second_t target_velocity) const;
+
+    /// @brief Extend previous selected trajectory by the consumed waypoints (steady state).
+    /// @note Requires GetReplanningTrigger() == ReplanningTrigger::kNone for the current frame.
+    Trajectory GetExtendedTrajectory();
+
+    /// @brief Store the (fully replanned) selected trajectory of the current frame.
+    ///
+    /// @param planned_trajectory [in] - planned trajectory (anchor waypoints) of the selected trajectory
+    /// @param selected_trajectory [in] - selected trajectory (optimized waypoints)
+    /// @param trigger [in] - reason for the replanning
+    void SetSelectedTrajectory(const Trajectory& planned_trajectory,
+                               const Trajectory& selected_trajectory,
+                               const ReplanningTrigger trigger);
+
+    /// @brief Forget the stored selected trajectory, i.e. the next frame is fully replanned (counters are kept)
+    void Reset();
+
+    /// @brief Get incremental planning counters
+    const IncrementalPlanningStatistics& GetStatistics() const;
+
+  private:
+    /// @brief Ids (ascending) of objects within relevance window around ego
+    std::vector<std::int32_t> GetRelevantObjects() const;
+
+    /// @brief Number of waypoints consumed (by the simulator) since the previous frame
+    std::size_t GetConsumedWaypoints() const;
+
+    /// @brief DataSource (contains information on VehicleDynamics, SensorFusion, etc.)
+    const IDataSource& data_source_;
+
+    /// @brief Whether an extendable selected trajectory is stored
+    bool has_selected_trajectory_;
+
+    /// @brief Selected trajectory (last sent waypoints without previous path)
+    Trajectory selected_trajectory_;
+
+    /// @brief Spline through anchor waypoints (in local coordinates of selected trajectory)
+    FixedSizeSpline<kTrajectoryAnchorPoints> spline_;
+
+    /// @brief Arc length table of the spline (up to the last anchor waypoint)
+    ArcLengthTable<64U> arc_length_table_;
+
+    /// @brief Arc length of the last sent waypoint along the spline
+    double arc_length_;
+
+    /// @brief Total number of sent waypoints (previous path + trajectory waypoints)
+    std::size_t path_size_;
+
+    /// @brief Last sent waypoint
+    GlobalCoordinates last_waypoint_;
+
+    /// @brief Objects within relevance window at the last frame
+    std::vector<std::int32_t> relevant_objects_;
+
+    /// @brief Incremental planning counters
+    IncrementalPlanningStatistics statistics_;
+};
+
+/// @brief String Stream for Replanning Trigger (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const ReplanningTrigger trigger)
+{
+    switch (trigger)
+    {
+        case ReplanningTrigger::kNone:
+            return out << "ReplanningTrigger::kNone";
+        case ReplanningTrigger::kNoPreviousPlan:
+            return out << "ReplanningTrigger::kNoPreviousPlan";
+        case ReplanningTrigger::kLaneChange:
+            return out << "ReplanningTrigger::kLaneChange";
+        case ReplanningTrigger::kNewObject:
+            return out << "ReplanningTrigger::kNewObject";
+        case ReplanningTrigger::kVelocityChange:
+            return out << "ReplanningTrigger::kVelocityChange";
+        case ReplanningTrigger::kPathDiverged:
+            return out << "ReplanningTrigger::kPathDiverged";
+        case ReplanningTrigger::kSplineExhausted:
+        default:
+            return out << "ReplanningTrigger::kSplineExhausted";
+    }
+}
+
+/// @brief String Stream for Incremental Planning counters (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const IncrementalPlanningStatistics& statistics)
+{
+    return out << "IncrementalPlanning{extended: " << statistics.extended_frames
+               << ", replanned: " << statistics.replanned_frames << ", hit_rate: " << statistics.GetHitRate() << "}";
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_INCREMENTAL_PLANNER_H
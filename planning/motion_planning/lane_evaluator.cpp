@@ -5,6 +5,8 @@
 #include "planning/motion_planning/lane_evaluator.h"
 
 #include "planning/common/logging.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/object_predictor.h"
 
 namespace planning
 {
@@ -23,11 +25,17 @@ inline bool IsObjectNear(const FrenetCoordinates& ego_position, const FrenetCoor
 }
 }  // namespace
 
-LaneEvaluator::LaneEvaluator(const IDataSource& data_source) : data_source_{data_source} {}
+LaneEvaluator::LaneEvaluator(const IDataSource& data_source) : data_source_{data_source}, object_predictor_{nullptr}
+{
+}
 
-LaneId LaneEvaluator::GetLocalLaneId(const GlobalLaneId global_lane_id) const
+LaneEvaluator::LaneEvaluator(const IDataSource& data_source, const IObjectPredictor& object_predictor)
+    : data_source_{data_source}, object_predictor_{&object_predictor}
+{
+}
+
+LaneId LaneEvaluator::GetLocalLaneId(const GlobalLaneId global_lane_id, const GlobalLaneId ego_global_lane_id)
 {
-    const auto ego_global_lane_id = data_source_.GetGlobalLaneId();
     LaneId lane_id{LaneId::kInvalid};
 
     if (ego_global_lane_id == global_lane_id)
@@ -46,12 +54,31 @@ LaneId LaneEvaluator::GetLocalLaneId(const GlobalLaneId global_lane_id) const
 }
 
 bool LaneEvaluator::IsDrivableLane(const LaneId lane_id) const
+{
+    const auto is_drivable = GetLaneEvaluation().IsDrivable(lane_id);
+
+    // LOG(INFO) << "Is {" << lane_id << "} drivable? " << std::boolalpha << is_drivable;
+    return is_drivable;
+}
+
+LaneEvaluation LaneEvaluator::GetLaneEvaluation() const
+{
+    if (object_predictor_ != nullptr)
+    {
+        return EvaluateLanes(object_predictor_->GetPredictedObjects());
+    }
+
+    ObjectPredictor object_predictor{data_source_};
+    object_predictor.PredictObjects();
+    return EvaluateLanes(object_predictor.GetPredictedObjects());
+}
+
+LaneEvaluation LaneEvaluator::EvaluateLanes(const PredictedObjects& predicted_objects) const
 {
     bool car_in_front = false;
     bool car_to_left = false;
     bool car_to_right = false;
-    const auto sensor_fusion = data_source_.GetSensorFusion();
-    const auto previous_path_size = data_source_.GetPreviousPathInGlobalCoords().size();
+    const auto previous_path_size = data_source_.GetSharedPreviousPath()->size();
 
     // Ego Properties
     const auto ego_velocity = data_source_.GetVehicleDynamics().velocity;
@@ -60,15 +87,17 @@ bool LaneEvaluator::IsDrivableLane(const LaneId lane_id) const
     const auto ego_position_predicted =
         FrenetCoordinates{ego_position.s + (previous_path_size * 0.02 * ego_velocity.value()), ego_position.d};
 
-    for (const auto& obj : sensor_fusion.objs)
+    // Objects predicted to the time ego reaches previous path end
+    const auto step = predicted_objects.GetStep(
+        units::time::second_t{static_cast<double>(previous_path_size) * kWaypointSamplingTime});
+    const auto* const predicted_states = predicted_objects.GetStates(step);
+    for (std::size_t object = 0U; object < predicted_objects.GetNumberOfObjects(); ++object)
     {
         // Object Properties
-        const auto obj_velocity = obj.velocity;
-        const auto obj_position = obj.frenet_coords;
-        const auto obj_global_lane_id = data_source_.GetGlobalLaneId(obj_position);
-        const auto obj_lane_id = GetLocalLaneId(obj_global_lane_id);
-        const auto obj_position_predicted =
-            FrenetCoordinates{obj_position.s + (previous_path_size * 0.02 * obj_velocity.value()), obj_position.d};
+        const auto& predicted_state = predicted_states[object];
+        const auto obj_position_predicted = FrenetCoordinates{predicted_state.s, predicted_state.d};
+        const auto obj_global_lane_id = data_source_.GetGlobalLaneId(obj_position_predicted);
+        const auto obj_lane_id = GetLocalLaneId(obj_global_lane_id, ego_global_lane_id);
 
         // Object is in query lane
         if (obj_lane_id == LaneId::kEgo)
@@ -91,32 +120,39 @@ bool LaneEvaluator::IsDrivableLane(const LaneId lane_id) const
             /* do nothing */
         }
     }
+
     const auto is_ego_in_valid_lane = (ego_global_lane_id != GlobalLaneId::kInvalid);
-    bool is_drivable = false;
-    switch (lane_id)
+    LaneEvaluation lane_evaluation{};
+    lane_evaluation.occupied = {car_to_left, car_in_front, car_to_right};
+    for (const auto lane_id : {LaneId::kLeft, LaneId::kEgo, LaneId::kRight})
     {
-        case LaneId::kEgo:
-            is_drivable = IsValidLane(LaneId::kEgo) && is_ego_in_valid_lane && !car_in_front;
-            break;
-        case LaneId::kLeft:
-            is_drivable = IsValidLane(LaneId::kLeft) && is_ego_in_valid_lane && !car_to_left;
-            break;
-        case LaneId::kRight:
-            is_drivable = IsValidLane(LaneId::kRight) && is_ego_in_valid_lane && !car_to_right;
-            break;
-        case LaneId::kInvalid:
-        default:
-            is_drivable = false;
-            break;
+        const auto lane = static_cast<std::size_t>(lane_id);
+        lane_evaluation.drivable[lane] =
+            IsValidLane(lane_id, ego_global_lane_id) && is_ego_in_valid_lane && !lane_evaluation.occupied[lane];
     }
-
-    // LOG(INFO) << "Is {" << lane_id << "} drivable? " << std::boolalpha << is_drivable;
-    return is_drivable;
+    return lane_evaluation;
 }
 
 bool LaneEvaluator::IsValidLane(const LaneId lane_id) const
+{
+    return IsValidLane(lane_id, data_source_.GetGlobalLaneId());
+}
+
+LaneEvaluation LaneEvaluator::GetLaneValidity() const
 {
     const auto ego_global_lane_id = data_source_.GetGlobalLaneId();
+    const auto is_ego_in_valid_lane = (ego_global_lane_id != GlobalLaneId::kInvalid);
+    LaneEvaluation lane_evaluation{};
+    for (const auto lane_id : {LaneId::kLeft, LaneId::kEgo, LaneId::kRight})
+    {
+        const auto lane = static_cast<std::size_t>(lane_id);
+        lane_evaluation.drivable[lane] = IsValidLane(lane_id, ego_global_lane_id) && is_ego_in_valid_lane;
+    }
+    return lane_evaluation;
+}
+
+bool LaneEvaluator::IsValidLane(const LaneId lane_id, const GlobalLaneId ego_global_lane_id)
+{
     bool result{false};
     switch (lane_id)
     {
@@ -10,6 +10,7 @@
 #include "planning/datatypes/trajectory.h"
 #include "planning/motion_planning/data_source.h"
 #include "planning/motion_planning/i_lane_evaluator.h"
+#include "planning/motion_planning/i_object_predictor.h"
 
 #include <memory>
 
@@ -20,20 +21,39 @@ class LaneEvaluator : public ILaneEvaluator
 {
   public:
     /// @brief Constructor. Initializes based on provided DataSource
+    /// @note Objects are predicted (constant velocity) on each evaluation.
     explicit LaneEvaluator(const IDataSource& data_source);
 
+    /// @brief Constructor. Initializes based on provided DataSource and Object Predictor (predicted once per frame).
+    explicit LaneEvaluator(const IDataSource& data_source, const IObjectPredictor& object_predictor);
+
     /// @brief Evaluates Lane to be drivable (collision free)
     bool IsDrivableLane(const LaneId lane_id) const override;
 
+    /// @brief Evaluates Occupancy and Drivability of all the lanes in a single pass over the objects
+    LaneEvaluation GetLaneEvaluation() const override;
+
     /// @brief Evaluates Lane to be Valid Lane
     bool IsValidLane(const LaneId lane_id) const override;
 
+    /// @brief Evaluates Validity of all the lanes, without occupancy (i.e. drivable if valid)
+    LaneEvaluation GetLaneValidity() const;
+
   private:
+    /// @brief Evaluates Occupancy and Drivability of all the lanes based on the predicted objects
+    LaneEvaluation EvaluateLanes(const PredictedObjects& predicted_objects) const;
+
     /// @brief Converts Global Lane Id to Local Lane Id based on Ego Position
-    LaneId GetLocalLaneId(const GlobalLaneId global_lane_id) const;
+    static LaneId GetLocalLaneId(const GlobalLaneId global_lane_id, const GlobalLaneId ego_global_lane_id);
+
+    /// @brief Evaluates Lane to be Valid Lane based on Ego Position
+    static bool IsValidLane(const LaneId lane_id, const GlobalLaneId ego_global_lane_id);
 
     /// @brief DataSource (contains information on VehicleDynamics, SensorFusion, etc.)
     const IDataSource& data_source_;
+
+    /// @brief Object Predictor shared with other stages (nullptr if objects are predicted on each evaluation)
+    const IObjectPredictor* object_predictor_;
 };
 }  // namespace planning
 #endif  /// PLANNING_MOTION_PLANNING_LANE_EVALUATOR_H
@@ -0,0 +1,76 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+
+#include "planning/common/logging.h"
+
+#include <array>
+#include <sstream>
+
+namespace planning
+{
+namespace
+{
+/// @brief Lowest velocity sampled on the lattice (standstill maneuvers can't be optimized)
+constexpr units::velocity::meters_per_second_t kMinLatticeVelocity{1.0};
+
+/// @brief Lanes sampled on the lattice
+constexpr std::array<LaneId, 3U> kLatticeLanes{LaneId::kLeft, LaneId::kEgo, LaneId::kRight};
+}  // namespace
+
+LatticeManeuverGenerator::LatticeManeuverGenerator() : LatticeManeuverGenerator{LatticeOptions{}} {}
+
+LatticeManeuverGenerator::LatticeManeuverGenerator(const LatticeOptions& options) : options_{options} {}
+
+std::vector<Maneuver> LatticeManeuverGenerator::Generate(
+    const units::velocity::meters_per_second_t target_velocity) const
+{
+    std::vector<Maneuver> maneuvers{};
+    maneuvers.reserve(GetLatticeSize());
+
+    // lane-major order, hence maneuvers for the same lane and horizon share anchor waypoints in the planner
+    const auto horizons = GetHorizons();
+    for (const auto lane_id : kLatticeLanes)
+    {
+        for (const auto horizon : horizons)
+        {
+            for (std::size_t velocity_idx = 0U; velocity_idx < options_.number_of_velocities; ++velocity_idx)
+            {
+                const auto velocity =
+                    target_velocity - (options_.velocity_resolution * static_cast<double>(velocity_idx));
+                if (velocity < kMinLatticeVelocity)
+                {
+                    break;
+                }
+                maneuvers.emplace_back(lane_id, velocity, horizon);
+            }
+        }
+    }
+
+    if (IsInfoLogged())
+    {
+        std::stringstream log_stream;
+        log_stream << "Generated Lattice Maneuvers: " << maneuvers.size() << "/" << GetLatticeSize() << std::endl;
+        LOG(INFO) << log_stream.str();
+    }
+    return maneuvers;
+}
+
+std::vector<units::length::meter_t> LatticeManeuverGenerator::GetHorizons() const
+{
+    std::vector<units::length::meter_t> horizons{};
+    horizons.reserve(options_.number_of_horizons);
+    for (std::size_t horizon_idx = 0U; horizon_idx < options_.number_of_horizons; ++horizon_idx)
+    {
+        horizons.push_back(options_.min_horizon + (options_.horizon_resolution * static_cast<double>(horizon_idx)));
+    }
+    return horizons;
+}
+
+std::size_t LatticeManeuverGenerator::GetLatticeSize() const
+{
+    return kLatticeLanes.size() * options_.number_of_velocities * options_.number_of_horizons;
+}
+}  // namespace planning
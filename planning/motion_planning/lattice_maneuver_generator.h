@@ -0,0 +1,46 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_LATTICE_MANEUVER_GENERATOR_H
+#define PLANNING_MOTION_PLANNING_LATTICE_MANEUVER_GENERATOR_H
+
+#include "planning/motion_planning/i_maneuver_generator.h"
+#include "planning/motion_planning/maneuver.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <units.h>
+
+#include <cstddef>
+
+namespace planning
+{
+/// @brief Frenet Lattice Maneuver Generator
+///
+/// @details Samples the Frenet state space on a regular lattice: lanes (left, ego, right) x velocities (target
+/// velocity and below) x planning horizons. i.e. default options produce 3 x 7 x 4 = 84 maneuvers per frame.
+class LatticeManeuverGenerator : public IManeuverGenerator
+{
+  public:
+    /// @brief Constructor. Initializes with default lattice options
+    LatticeManeuverGenerator();
+
+    /// @brief Constructor. Initializes with provided lattice options
+    explicit LatticeManeuverGenerator(const LatticeOptions& options);
+
+    /// @brief Generate Maneuvers on the lattice for given target velocity
+    /// @note Velocity samples below kMinLatticeVelocity are skipped.
+    std::vector<Maneuver> Generate(const units::velocity::meters_per_second_t target_velocity) const override;
+
+    /// @brief Planning horizons sampled on the lattice (ascending)
+    std::vector<units::length::meter_t> GetHorizons() const;
+
+    /// @brief Maximum number of Maneuvers generated per frame (lattice size)
+    std::size_t GetLatticeSize() const;
+
+  private:
+    /// @brief Lattice sampling options
+    LatticeOptions options_;
+};
+}  // namespace planning
+#endif  /// PLANNING_MOTION_PLANNING_LATTICE_MANEUVER_GENERATOR_H
@@ -6,10 +6,17 @@
 
 namespace planning
 {
-Maneuver::Maneuver() : lane_id_{LaneId::kEgo}, velocity_{units::velocity::meters_per_second_t{0.0}} {}
+Maneuver::Maneuver() : Maneuver{LaneId::kEgo, units::velocity::meters_per_second_t{0.0}} {}
 
 Maneuver::Maneuver(const LaneId lane_id, const units::velocity::meters_per_second_t velocity)
-    : lane_id_{lane_id}, velocity_{velocity}
+    : Maneuver{lane_id, velocity, kDefaultManeuverHorizon}
+{
+}
+
+Maneuver::Maneuver(const LaneId lane_id,
+                   const units::velocity::meters_per_second_t velocity,
+                   const units::length::meter_t horizon)
+    : lane_id_{lane_id}, velocity_{velocity}, horizon_{horizon}
 {
 }
 
@@ -23,4 +30,9 @@ units::velocity::meters_per_second_t Maneuver::GetVelocity() const
     return velocity_;
 }
 
+units::length::meter_t Maneuver::GetHorizon() const
+{
+    return horizon_;
+}
+
 }  // namespace planning
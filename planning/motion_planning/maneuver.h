@@ -9,6 +9,9 @@
 
 namespace planning
 {
+/// @brief Default Planning Horizon (longitudinal spacing of anchor waypoints)
+constexpr units::length::meter_t kDefaultManeuverHorizon{30.0};
+
 /// @brief Maneuver
 class Maneuver : public IManeuver
 {
@@ -19,30 +22,43 @@ class Maneuver : public IManeuver
     /// @brief Constructor. Initialize Maneuver with LaneId and target velocity
     explicit Maneuver(const LaneId lane_id, const units::velocity::meters_per_second_t velocity);
 
+    /// @brief Constructor. Initialize Maneuver with LaneId, target velocity and planning horizon
+    explicit Maneuver(const LaneId lane_id,
+                      const units::velocity::meters_per_second_t velocity,
+                      const units::length::meter_t horizon);
+
     /// @brief Get LaneId for Maneuver
     LaneId GetLaneId() const override;
 
     /// @brief Get Target Velocity for Maneuver
     units::velocity::meters_per_second_t GetVelocity() const override;
 
+    /// @brief Get Planning Horizon for Maneuver
+    units::length::meter_t GetHorizon() const override;
+
   private:
     /// @brief Maneuver LaneId
     LaneId lane_id_;
 
     /// @brief Maneuver Target Velocity
     units::velocity::meters_per_second_t velocity_;
+
+    /// @brief Maneuver Planning Horizon
+    units::length::meter_t horizon_;
 };
 
 /// @brief Comparator for Maneuvers
 inline bool operator==(const Maneuver& lhs, const Maneuver& rhs) noexcept
 {
-    return ((lhs.GetLaneId() == rhs.GetLaneId()) && (lhs.GetVelocity() == rhs.GetVelocity()));
+    return ((lhs.GetLaneId() == rhs.GetLaneId()) && (lhs.GetVelocity() == rhs.GetVelocity()) &&
+            (lhs.GetHorizon() == rhs.GetHorizon()));
 }
 
 /// @brief String Stream for Maneuver information (used for printing verbose information)
 inline std::ostream& operator<<(std::ostream& out, const Maneuver& maneuver)
 {
-    return out << "Maneuver{lane: " << maneuver.GetLaneId() << ", velocity: " << maneuver.GetVelocity() << "}";
+    return out << "Maneuver{lane: " << maneuver.GetLaneId() << ", velocity: " << maneuver.GetVelocity()
+               << ", horizon: " << maneuver.GetHorizon() << "}";
 }
 }  // namespace planning
 #endif  /// PLANNING_MOTION_PLANNING_MANEUVER_H
@@ -17,12 +17,15 @@ std::vector<Maneuver> ManeuverGenerator::Generate(const units::velocity::meters_
                                            Maneuver{LaneId::kEgo, target_velocity},
                                            Maneuver{LaneId::kRight, target_velocity}};
 
-    std::stringstream log_stream;
-    log_stream << "Generated Maneuvers:" << std::endl;
-    std::for_each(maneuvers.begin(),
-                  maneuvers.end(),
-                  [&](const auto& maneuver) { log_stream << " (+) " << maneuver << std::endl; });
-    LOG(INFO) << log_stream.str();
+    if (IsInfoLogged())
+    {
+        std::stringstream log_stream;
+        log_stream << "Generated Maneuvers:" << std::endl;
+        std::for_each(maneuvers.begin(),
+                      maneuvers.end(),
+                      [&](const auto& maneuver) { log_stream << " (+) " << maneuver << std::endl; });
+        LOG(INFO) << log_stream.str();
+    }
     return maneuvers;
 }
 }  // namespace planning
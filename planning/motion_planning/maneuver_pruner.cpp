@@ -0,0 +1,100 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/maneuver_pruner.h"
+
+#include "planning/common/logging.h"
+
+namespace planning
+{
+ManeuverPruner::ManeuverPruner(const IDataSource& data_source)
+    : data_source_{data_source}, target_global_lane_id_{GlobalLaneId::kInvalid}, statistics_{}
+{
+}
+
+std::vector<Maneuver> ManeuverPruner::Prune(const std::vector<Maneuver>& maneuvers,
+                                            const LaneEvaluation& lane_evaluation)
+{
+    std::vector<Maneuver> pruned_maneuvers{};
+    pruned_maneuvers.reserve(maneuvers.size());
+
+    std::size_t invalid_lane{0U};
+    std::size_t blocked_lane{0U};
+    std::size_t off_target_lane{0U};
+    for (const auto& maneuver : maneuvers)
+    {
+        const auto lane_id = maneuver.GetLaneId();
+        if (!IsValidLane(lane_id))
+        {
+            ++invalid_lane;
+        }
+        else if ((lane_id != LaneId::kEgo) && !lane_evaluation.IsDrivable(lane_id))
+        {
+            ++blocked_lane;
+        }
+        else if (!IsTowardsTargetLane(lane_id))
+        {
+            ++off_target_lane;
+        }
+        else
+        {
+            pruned_maneuvers.push_back(maneuver);
+        }
+    }
+
+    statistics_.maneuvers += maneuvers.size();
+    statistics_.invalid_lane += invalid_lane;
+    statistics_.blocked_lane += blocked_lane;
+    statistics_.off_target_lane += off_target_lane;
+
+    LOG(INFO) << "Pruned maneuvers: " << pruned_maneuvers.size() << "/" << maneuvers.size()
+              << " (invalid lane: " << invalid_lane << ", blocked lane: " << blocked_lane
+              << ", off target lane: " << off_target_lane << ")";
+    return pruned_maneuvers;
+}
+
+void ManeuverPruner::SetTargetLane(const GlobalLaneId target_global_lane_id)
+{
+    target_global_lane_id_ = target_global_lane_id;
+}
+
+ManeuverPruningStatistics ManeuverPruner::GetStatistics() const
+{
+    return statistics_;
+}
+
+bool ManeuverPruner::IsValidLane(const LaneInformation::LaneId lane_id) const
+{
+    const auto ego_global_lane_id = data_source_.GetGlobalLaneId();
+    if (ego_global_lane_id == GlobalLaneId::kInvalid)
+    {
+        return false;
+    }
+    switch (lane_id)
+    {
+        case LaneId::kEgo:
+            return true;
+        case LaneId::kLeft:
+            return (ego_global_lane_id - 1) != GlobalLaneId::kInvalid;
+        case LaneId::kRight:
+            return (ego_global_lane_id + 1) != GlobalLaneId::kInvalid;
+        case LaneId::kInvalid:
+        default:
+            return false;
+    }
+}
+
+bool ManeuverPruner::IsTowardsTargetLane(const LaneInformation::LaneId lane_id) const
+{
+    if ((target_global_lane_id_ == GlobalLaneId::kInvalid) || (lane_id == LaneId::kEgo))
+    {
+        return true;
+    }
+    // lanes are numbered from left, hence left lane change approaches a target lane left of ego (and vice versa)
+    const auto ego_global_lane_id = data_source_.GetGlobalLaneId();
+    return (lane_id == LaneId::kLeft) ? (target_global_lane_id_ < ego_global_lane_id)
+                                      : (target_global_lane_id_ > ego_global_lane_id);
+}
+
+}  // namespace planning
@@ -0,0 +1,83 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_MANEUVER_PRUNER_H
+#define PLANNING_MOTION_PLANNING_MANEUVER_PRUNER_H
+
+#include "planning/datatypes/lane.h"
+#include "planning/motion_planning/i_data_source.h"
+#include "planning/motion_planning/i_lane_evaluator.h"
+#include "planning/motion_planning/maneuver.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+/// @brief Maneuver pruning counters (accumulated over all the frames)
+struct ManeuverPruningStatistics
+{
+    /// @brief Number of generated maneuvers
+    std::size_t maneuvers{0U};
+
+    /// @brief Number of maneuvers rejected for an invalid target lane (e.g. left of the leftmost lane)
+    std::size_t invalid_lane{0U};
+
+    /// @brief Number of maneuvers rejected for a blocked target lane (lane changes only)
+    std::size_t blocked_lane{0U};
+
+    /// @brief Number of maneuvers rejected for changing lanes away from the strategic target lane
+    std::size_t off_target_lane{0U};
+
+    /// @brief Number of rejected maneuvers
+    std::size_t GetRejected() const noexcept
+    {
+        return invalid_lane + blocked_lane + off_target_lane;
+    }
+};
+
+/// @brief Maneuver Pruner. Rejects maneuvers before planning (i.e. before any waypoint or spline is computed) which
+/// would be discarded or rated not drivable anyway.
+///
+/// @note Maneuvers keeping the ego lane are never rejected for a blocked lane, hence a (valid) ego lane always
+/// keeps a candidate to fall back to.
+class ManeuverPruner
+{
+  public:
+    /// @brief Constructor. Initializes with provided DataSource
+    explicit ManeuverPruner(const IDataSource& data_source);
+
+    /// @brief Remove maneuvers with invalid or blocked target lane (keeps order of the remaining ones).
+    ///
+    /// @param maneuvers [in] - generated maneuvers
+    /// @param lane_evaluation [in] - lanes evaluated once for the current frame (same as used for rating)
+    ///
+    /// @return maneuvers to be planned
+    std::vector<Maneuver> Prune(const std::vector<Maneuver>& maneuvers, const LaneEvaluation& lane_evaluation);
+
+    /// @brief Set strategic target lane. Lane changes not approaching it are rejected (kInvalid disables).
+    void SetTargetLane(const GlobalLaneId target_global_lane_id);
+
+    /// @brief Get pruning counters
+    ManeuverPruningStatistics GetStatistics() const;
+
+  private:
+    /// @brief Check target lane of the maneuver to exist (relative to ego global lane)
+    bool IsValidLane(const LaneInformation::LaneId lane_id) const;
+
+    /// @brief Check lane change of the maneuver to approach the target lane (always true without target lane)
+    bool IsTowardsTargetLane(const LaneInformation::LaneId lane_id) const;
+
+    /// @brief DataSource (contains information on Ego Global Lane)
+    const IDataSource& data_source_;
+
+    /// @brief Strategic target lane (kInvalid if lane changes are not restricted)
+    GlobalLaneId target_global_lane_id_;
+
+    /// @brief Pruning counters
+    ManeuverPruningStatistics statistics_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_MANEUVER_PRUNER_H
@@ -4,9 +4,15 @@
 ///
 #include "planning/motion_planning/motion_planning.h"
 
+#include "planning/common/chrono_timer.h"
 #include "planning/common/logging.h"
+#include "planning/motion_planning/collision_checker.h"
+#include "planning/motion_planning/lattice_maneuver_generator.h"
 #include "planning/motion_planning/maneuver.h"
 #include "planning/motion_planning/maneuver_generator.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/occupancy_grid.h"
+#include "planning/motion_planning/polynomial_trajectory_optimizer.h"
 #include "planning/motion_planning/trajectory_evaluator.h"
 #include "planning/motion_planning/trajectory_optimizer.h"
 #include "planning/motion_planning/trajectory_planner.h"
@@ -14,37 +20,455 @@
 #include "planning/motion_planning/trajectory_selector.h"
 #include "planning/motion_planning/velocity_planner.h"
 
+#include <algorithm>
+#include <array>
+#include <utility>
+
 namespace planning
 {
-MotionPlanning::MotionPlanning(const IDataSource& data_source)
-    : velocity_planner_{std::make_unique<VelocityPlanner>(data_source)},
-      maneuver_generator_{std::make_unique<ManeuverGenerator>()},
+namespace
+{
+/// @brief Create Maneuver Generator for provided options
+std::unique_ptr<IManeuverGenerator> GetManeuverGenerator(const MotionPlanningOptions& options)
+{
+    if (options.maneuver_generator_type == ManeuverGeneratorType::kLattice)
+    {
+        return std::make_unique<LatticeManeuverGenerator>(options.lattice_options);
+    }
+    return std::make_unique<ManeuverGenerator>();
+}
+
+/// @brief Create Trajectory Optimizer for provided options
+std::unique_ptr<ITrajectoryOptimizer> GetTrajectoryOptimizer(const IDataSource& data_source,
+                                                             const MotionPlanningOptions& options)
+{
+    if (options.trajectory_optimizer_type == TrajectoryOptimizerType::kFrenetPolynomial)
+    {
+        // prepare solvers for every horizon the maneuver generator produces
+        const auto horizons = (options.maneuver_generator_type == ManeuverGeneratorType::kLattice)
+                                  ? LatticeManeuverGenerator{options.lattice_options}.GetHorizons()
+                                  : std::vector<units::length::meter_t>{kDefaultManeuverHorizon};
+        return std::make_unique<PolynomialTrajectoryOptimizer>(data_source, horizons);
+    }
+    return std::make_unique<TrajectoryOptimizer>(data_source);
+}
+
+/// @brief Create Occupancy Grid for provided options (nullptr if lane level occupancy is evaluated)
+std::unique_ptr<IOccupancyGrid> GetOccupancyGrid(const IDataSource& data_source,
+                                                 const IObjectPredictor& object_predictor,
+                                                 const MotionPlanningOptions& options)
+{
+    if (options.occupancy_evaluation_type == OccupancyEvaluationType::kOccupancyGrid)
+    {
+        return std::make_unique<OccupancyGrid>(
+            data_source, object_predictor, options.occupancy_grid_options, options.collision_checker_options);
+    }
+    return nullptr;
+}
+
+/// @brief Get Trajectory Evaluator options for provided options and collaborators (nullptr if not used)
+TrajectoryEvaluatorOptions GetTrajectoryEvaluatorOptions(const MotionPlanningOptions& options,
+                                                         const ICollisionChecker* collision_checker,
+                                                         const IOccupancyGrid* occupancy_grid,
+                                                         MonotonicArena* arena)
+{
+    TrajectoryEvaluatorOptions evaluator_options{};
+    evaluator_options.collision_checker = collision_checker;
+    evaluator_options.occupancy_grid = occupancy_grid;
+    evaluator_options.cost_options = options.cost_options;
+    evaluator_options.evaluation_type = options.evaluation_type;
+    evaluator_options.arena = arena;
+    return evaluator_options;
+}
+
+/// @brief Stages of each candidate branch (task names, in order of the branch's tasks)
+constexpr std::array<const char*, 3U> kCandidateStages{
+    {"plan_trajectories", "optimize_trajectories", "rate_trajectories"}};
+}  // namespace
+
+MotionPlanning::MotionPlanning(const IDataSource& data_source) : MotionPlanning{data_source, MotionPlanningOptions{}}
+{
+}
+
+MotionPlanning::MotionPlanning(const IDataSource& data_source, const MotionPlanningOptions& options)
+    : MotionPlanning{data_source, options, std::make_unique<timer::ChronoTimer>()}
+{
+}
+
+MotionPlanning::MotionPlanning(const IDataSource& data_source,
+                               const MotionPlanningOptions& options,
+                               std::unique_ptr<timer::ITimer> timer)
+    : timer_{std::move(timer)},
+      frame_arena_{std::make_unique<MonotonicArena>(options.frame_arena_capacity)},
+      thread_pool_{((options.number_of_threads > 0U) || (options.execution_type == ExecutionType::kTaskGraph))
+                       ? std::make_unique<ThreadPool>(options.number_of_threads)
+                       : nullptr},
+      frame_graph_{(options.execution_type == ExecutionType::kTaskGraph) ? std::make_unique<TaskGraph>() : nullptr},
+      candidate_graph_{(options.execution_type == ExecutionType::kTaskGraph) ? std::make_unique<TaskGraph>()
+                                                                            : nullptr},
+      candidate_branches_{},
+      task_timings_{},
+      object_predictor_{std::make_unique<ObjectPredictor>(data_source, options.prediction_options)},
+      collision_checker_{options.collision_checking
+                             ? std::make_unique<CollisionChecker>(
+                                   data_source, *object_predictor_, options.collision_checker_options)
+                             : nullptr},
+      occupancy_grid_{GetOccupancyGrid(data_source, *object_predictor_, options)},
+      velocity_planner_{std::make_unique<VelocityPlanner>(data_source, *object_predictor_)},
+      maneuver_generator_{GetManeuverGenerator(options)},
+      maneuver_pruner_{std::make_unique<ManeuverPruner>(data_source)},
       trajectory_planner_{std::make_unique<TrajectoryPlanner>(data_source)},
-      trajectory_optimizer_{std::make_unique<TrajectoryOptimizer>(data_source)},
-      trajectory_evaluator_{std::make_unique<TrajectoryEvaluator>(data_source)},
-      trajectory_prioritizer_{std::make_unique<TrajectoryPrioritizer>()},
+      trajectory_optimizer_{GetTrajectoryOptimizer(data_source, options)},
+      trajectory_evaluator_{std::make_unique<TrajectoryEvaluator>(
+          data_source,
+          *object_predictor_,
+          GetTrajectoryEvaluatorOptions(
+              options, collision_checker_.get(), occupancy_grid_.get(), frame_arena_.get()))},
+      trajectory_prioritizer_{std::make_unique<TrajectoryPrioritizer>(kMaxLoggedTrajectories, frame_arena_.get())},
       trajectory_selector_{std::make_unique<TrajectorySelector>()},
+      incremental_planner_{(options.incremental_replanning &&
+                            (options.trajectory_optimizer_type == TrajectoryOptimizerType::kSpline))
+                               ? std::make_unique<IncrementalPlanner>(data_source)
+                               : nullptr},
+      evaluation_statistics_{},
+      anytime_planning_statistics_{},
+      is_cut_short_{false},
+      candidates_{},
       selected_trajectory_{}
 {
+    if (frame_graph_ != nullptr)
+    {
+        AddFrameTasks();
+    }
+}
+
+void MotionPlanning::AddFrameTasks()
+{
+    // collision checker, occupancy grid and velocity planner only depend on the predicted objects
+    const auto predict_objects =
+        frame_graph_->AddTask("predict_objects", [this]() { object_predictor_->PredictObjects(); });
+    if (collision_checker_ != nullptr)
+    {
+        frame_graph_->AddTask(
+            "update_collision_checker", [this]() { collision_checker_->Update(); }, {predict_objects});
+    }
+    if (occupancy_grid_ != nullptr)
+    {
+        frame_graph_->AddTask("update_occupancy_grid", [this]() { occupancy_grid_->Update(); }, {predict_objects});
+    }
+    frame_graph_->AddTask(
+        "calculate_target_velocity", [this]() { velocity_planner_->CalculateTargetVelocity(); }, {predict_objects});
 }
 
 void MotionPlanning::GenerateTrajectories()
 {
-    velocity_planner_->CalculateTargetVelocity();
+    GenerateTrajectories(nullptr);
+}
+
+void MotionPlanning::GenerateTrajectories(const std::chrono::system_clock::duration& time_budget)
+{
+    timer_->SetTimer(time_budget);
+    timer_->Start();
+    GenerateTrajectories(timer_.get());
+    timer_->Stop();
+
+    ++anytime_planning_statistics_.frames;
+    if (is_cut_short_)
+    {
+        ++anytime_planning_statistics_.cut_short_frames;
+        LOG(WARNING) << "Planning cut short by deadline: " << anytime_planning_statistics_;
+    }
+}
+
+void MotionPlanning::GenerateTrajectories(const timer::ITimer* deadline)
+{
+    is_cut_short_ = false;
+
+    // release scratch buffers of the previous frame at once (chunks are retained)
+    frame_arena_->Reset();
+
+    if (frame_graph_ != nullptr)
+    {
+        frame_graph_->Run(*thread_pool_);
+        task_timings_ = frame_graph_->GetTimings();
+    }
+    else
+    {
+        object_predictor_->PredictObjects();
+        if (collision_checker_ != nullptr)
+        {
+            collision_checker_->Update();
+        }
+        if (occupancy_grid_ != nullptr)
+        {
+            occupancy_grid_->Update();
+        }
+
+        velocity_planner_->CalculateTargetVelocity();
+    }
 
     const auto target_velocity = velocity_planner_->GetTargetVelocity();
 
-    const auto maneuvers = maneuver_generator_->Generate(target_velocity);
+    if (incremental_planner_ == nullptr)
+    {
+        SelectTrajectory(target_velocity, deadline);
+        return;
+    }
+
+    const auto trigger = incremental_planner_->GetReplanningTrigger(target_velocity);
+    if (trigger == ReplanningTrigger::kNone)
+    {
+        selected_trajectory_ = incremental_planner_->GetExtendedTrajectory();
+        return;
+    }
+
+    const auto maneuvers = SelectTrajectory(target_velocity, deadline);
+
+    // re-plan selected maneuver (same inputs, hence same anchor waypoints) to keep its spline for extension
+    const auto selected_idx = static_cast<std::size_t>(selected_trajectory_.unique_id - 1);
+    const auto planned_trajectory = (selected_idx < maneuvers.size())
+                                        ? trajectory_planner_->GetPlannedTrajectory(maneuvers[selected_idx],
+                                                                                    selected_trajectory_.unique_id)
+                                        : Trajectory{};
+    incremental_planner_->SetSelectedTrajectory(planned_trajectory, selected_trajectory_, trigger);
+}
+
+std::vector<Maneuver> MotionPlanning::SelectTrajectory(const units::velocity::meters_per_second_t target_velocity,
+                                                       const timer::ITimer* deadline)
+{
+    // evaluate lanes once per frame, shared by the pruner and all candidates
+    const auto lane_evaluation = trajectory_evaluator_->GetLaneEvaluation();
+
+    // reject maneuvers with invalid or blocked target lane before any waypoint or spline is computed
+    auto maneuvers = maneuver_pruner_->Prune(maneuver_generator_->Generate(target_velocity), lane_evaluation);
+    if (deadline != nullptr)
+    {
+        // ego lane first (keeping lattice order otherwise), hence the deadline cuts the lane changes first
+        std::stable_partition(maneuvers.begin(),
+                              maneuvers.end(),
+                              [](const auto& maneuver) { return maneuver.GetLaneId() == LaneId::kEgo; });
+    }
+
+    if (frame_graph_ != nullptr)
+    {
+        candidates_ = GetRatedTrajectoriesOnTaskGraph(maneuvers, lane_evaluation, deadline);
+    }
+    else if (thread_pool_ != nullptr)
+    {
+        candidates_ = GetRatedTrajectories(maneuvers, lane_evaluation, deadline);
+    }
+    else if (deadline != nullptr)
+    {
+        RateTrajectoriesUntil(maneuvers, lane_evaluation, *deadline);
+    }
+    else
+    {
+        // stages transform the candidates in place, buffers (and their waypoints) persist across frames
+        trajectory_planner_->PlanTrajectories(maneuvers, candidates_);
+        trajectory_optimizer_->OptimizeTrajectories(candidates_);
+        trajectory_evaluator_->RateTrajectories(candidates_, lane_evaluation, evaluation_statistics_);
+    }
+
+    // prioritizer takes ownership of the rated candidates, which are handed back once the trajectory is selected
+    auto prioritized_trajectories = trajectory_prioritizer_->GetPrioritizedTrajectories(std::move(candidates_));
+    trajectory_selector_->SelectTrajectory(prioritized_trajectories, selected_trajectory_);
+    candidates_ = prioritized_trajectories.ReleaseTrajectories();
+    return maneuvers;
+}
+
+void MotionPlanning::RateTrajectoriesUntil(const std::vector<Maneuver>& maneuvers,
+                                           const LaneEvaluation& lane_evaluation,
+                                           const timer::ITimer& deadline)
+{
+    candidates_.clear();
+
+    // first candidate is always rated (i.e. a trajectory is selected), further ones only before the deadline
+    std::size_t number_of_processed{0U};
+    for (; number_of_processed < maneuvers.size(); ++number_of_processed)
+    {
+        if ((number_of_processed > 0U) && deadline.IsTimeout())
+        {
+            break;
+        }
+        const auto unique_id = static_cast<std::int32_t>(number_of_processed + 1U);
+        const auto planned_trajectory =
+            trajectory_planner_->GetPlannedTrajectory(maneuvers[number_of_processed], unique_id);
+        const auto optimized_trajectory = trajectory_optimizer_->GetOptimizedTrajectory(planned_trajectory);
+        if (trajectory_evaluator_->IsValidTrajectory(optimized_trajectory))
+        {
+            candidates_.push_back(trajectory_evaluator_->GetRatedTrajectory(optimized_trajectory, lane_evaluation));
+        }
+    }
+
+    const auto number_of_skipped = maneuvers.size() - number_of_processed;
+    is_cut_short_ = (number_of_skipped > 0U);
+    anytime_planning_statistics_.skipped_candidates += number_of_skipped;
+    LOG(INFO) << "Rated trajectories (anytime): " << candidates_.size() << "/" << maneuvers.size() << " (skipped "
+              << number_of_skipped << ")";
+}
+
+Trajectories MotionPlanning::GetRatedTrajectories(const std::vector<Maneuver>& maneuvers,
+                                                  const LaneEvaluation& lane_evaluation,
+                                                  const timer::ITimer* deadline)
+{
+    Trajectories candidates(maneuvers.size());
+    std::vector<std::uint8_t> is_valid(maneuvers.size(), 0U);
+    std::vector<std::uint8_t> is_skipped(maneuvers.size(), 0U);
+
+    thread_pool_->ParallelFor(maneuvers.size(),
+                              [&](const std::size_t idx)
+                              {
+                                  // first candidate is always rated, further ones only before the deadline
+                                  if ((deadline != nullptr) && (idx > 0U) && deadline->IsTimeout())
+                                  {
+                                      is_skipped[idx] = 1U;
+                                      return;
+                                  }
+                                  const auto unique_id = static_cast<std::int32_t>(idx + 1U);
+                                  const auto planned_trajectory =
+                                      trajectory_planner_->GetPlannedTrajectory(maneuvers[idx], unique_id);
+                                  const auto optimized_trajectory =
+                                      trajectory_optimizer_->GetOptimizedTrajectory(planned_trajectory);
+                                  if (trajectory_evaluator_->IsValidTrajectory(optimized_trajectory))
+                                  {
+                                      candidates[idx] = trajectory_evaluator_->GetRatedTrajectory(
+                                          optimized_trajectory, lane_evaluation);
+                                      is_valid[idx] = 1U;
+                                  }
+                              });
+
+    const auto rated_trajectories = GetValidTrajectories(candidates, is_valid, is_skipped);
+    LOG(INFO) << "Rated trajectories (parallel, " << thread_pool_->GetNumberOfThreads()
+              << " threads): " << rated_trajectories.size() << "/" << maneuvers.size() << " (skipped "
+              << std::count(is_skipped.begin(), is_skipped.end(), std::uint8_t{1U}) << ")";
+    return rated_trajectories;
+}
 
-    const auto planned_trajectories = trajectory_planner_->GetPlannedTrajectories(maneuvers);
+Trajectories MotionPlanning::GetRatedTrajectoriesOnTaskGraph(const std::vector<Maneuver>& maneuvers,
+                                                             const LaneEvaluation& lane_evaluation,
+                                                             const timer::ITimer* deadline)
+{
+    // inputs and results of the branches (buffers retain their capacity across frames)
+    candidate_branches_.maneuvers = &maneuvers;
+    candidate_branches_.deadline = deadline;
+    candidate_branches_.lane_evaluation = &lane_evaluation;
+    candidate_branches_.candidates.resize(maneuvers.size());
+    candidate_branches_.is_valid.assign(maneuvers.size(), 0U);
+    candidate_branches_.is_skipped.assign(maneuvers.size(), 0U);
+
+    // graph is only rebuilt for more maneuvers than branches, spare branches do nothing
+    if ((candidate_graph_->GetNumberOfTasks() / kCandidateStages.size()) < maneuvers.size())
+    {
+        candidate_graph_->Clear();
+        AddCandidateTasks(maneuvers.size());
+    }
+    candidate_graph_->Run(*thread_pool_);
+    AddCandidateTimings(maneuvers.size());
+
+    const auto rated_trajectories = GetValidTrajectories(
+        candidate_branches_.candidates, candidate_branches_.is_valid, candidate_branches_.is_skipped);
+    const auto& is_skipped = candidate_branches_.is_skipped;
+    LOG(INFO) << "Rated trajectories (task graph, " << thread_pool_->GetNumberOfThreads() << " threads, "
+              << candidate_graph_->GetNumberOfTasks() << " tasks): " << rated_trajectories.size() << "/"
+              << maneuvers.size() << " (skipped " << std::count(is_skipped.begin(), is_skipped.end(), std::uint8_t{1U})
+              << ")";
+    candidate_branches_.maneuvers = nullptr;
+    candidate_branches_.deadline = nullptr;
+    candidate_branches_.lane_evaluation = nullptr;
+    return rated_trajectories;
+}
 
-    const auto optimized_trajectories = trajectory_optimizer_->GetOptimizedTrajectories(planned_trajectories);
+void MotionPlanning::AddCandidateTasks(const std::size_t number_of_branches)
+{
+    // branches of different candidates overlap, stages of a candidate run in order
+    auto& branches = candidate_branches_;
+    for (std::size_t idx = 0U; idx < number_of_branches; ++idx)
+    {
+        const auto plan = candidate_graph_->AddTask(
+            kCandidateStages[0U],
+            [&branches, this, idx]()
+            {
+                if (idx >= branches.maneuvers->size())
+                {
+                    return;
+                }
+                // first candidate is always rated, further ones only before the deadline
+                if ((branches.deadline != nullptr) && (idx > 0U) && branches.deadline->IsTimeout())
+                {
+                    branches.is_skipped[idx] = 1U;
+                    return;
+                }
+                const auto unique_id = static_cast<std::int32_t>(idx + 1U);
+                branches.candidates[idx] =
+                    trajectory_planner_->GetPlannedTrajectory((*branches.maneuvers)[idx], unique_id);
+            });
+        const auto optimize = candidate_graph_->AddTask(
+            kCandidateStages[1U],
+            [&branches, this, idx]()
+            {
+                if ((idx < branches.maneuvers->size()) && (branches.is_skipped[idx] == 0U))
+                {
+                    branches.candidates[idx] =
+                        trajectory_optimizer_->GetOptimizedTrajectory(branches.candidates[idx]);
+                }
+            },
+            {plan});
+        candidate_graph_->AddTask(
+            kCandidateStages[2U],
+            [&branches, this, idx]()
+            {
+                if ((idx < branches.maneuvers->size()) && (branches.is_skipped[idx] == 0U) &&
+                    trajectory_evaluator_->IsValidTrajectory(branches.candidates[idx]))
+                {
+                    branches.candidates[idx] =
+                        trajectory_evaluator_->GetRatedTrajectory(branches.candidates[idx], *branches.lane_evaluation);
+                    branches.is_valid[idx] = 1U;
+                }
+            },
+            {optimize});
+    }
+}
 
-    const auto rated_trajectories = trajectory_evaluator_->GetRatedTrajectories(optimized_trajectories);
+void MotionPlanning::AddCandidateTimings(const std::size_t number_of_candidates)
+{
+    // one timing per stage after the frame updates: earliest start and summed duration over the candidates
+    const auto& candidate_timings = candidate_graph_->GetTimings();
+    for (std::size_t stage = 0U; stage < kCandidateStages.size(); ++stage)
+    {
+        TaskTiming stage_timing{kCandidateStages[stage],
+                                (number_of_candidates > 0U) ? std::chrono::nanoseconds::max()
+                                                            : std::chrono::nanoseconds{0},
+                                std::chrono::nanoseconds{0}};
+        for (std::size_t idx = 0U; idx < number_of_candidates; ++idx)
+        {
+            const auto& timing = candidate_timings[(idx * kCandidateStages.size()) + stage];
+            stage_timing.start = std::min(stage_timing.start, timing.start);
+            stage_timing.duration += timing.duration;
+        }
+        task_timings_.push_back(stage_timing);
+    }
+}
 
-    const auto prioritized_trajectories = trajectory_prioritizer_->GetPrioritizedTrajectories(rated_trajectories);
+Trajectories MotionPlanning::GetValidTrajectories(Trajectories& candidates,
+                                                  const std::vector<std::uint8_t>& is_valid,
+                                                  const std::vector<std::uint8_t>& is_skipped)
+{
+    // keep maneuver order (deterministic w.r.t. number of threads)
+    Trajectories valid_trajectories{};
+    valid_trajectories.reserve(candidates.size());
+    for (std::size_t idx = 0U; idx < candidates.size(); ++idx)
+    {
+        if (is_valid[idx] != 0U)
+        {
+            valid_trajectories.push_back(std::move(candidates[idx]));
+        }
+    }
 
-    selected_trajectory_ = trajectory_selector_->GetSelectedTrajectory(prioritized_trajectories);
+    const auto number_of_skipped =
+        static_cast<std::size_t>(std::count(is_skipped.begin(), is_skipped.end(), std::uint8_t{1U}));
+    is_cut_short_ = (number_of_skipped > 0U);
+    anytime_planning_statistics_.skipped_candidates += number_of_skipped;
+    return valid_trajectories;
 }
 
 Trajectory MotionPlanning::GetSelectedTrajectory() const
@@ -52,4 +476,71 @@ Trajectory MotionPlanning::GetSelectedTrajectory() const
     return selected_trajectory_;
 }
 
+IncrementalPlanningStatistics MotionPlanning::GetIncrementalPlanningStatistics() const
+{
+    return (incremental_planner_ != nullptr) ? incremental_planner_->GetStatistics()
+                                             : IncrementalPlanningStatistics{};
+}
+
+ManeuverPruningStatistics MotionPlanning::GetManeuverPruningStatistics() const
+{
+    return maneuver_pruner_->GetStatistics();
+}
+
+const MonotonicArena& MotionPlanning::GetFrameArena() const
+{
+    return *frame_arena_;
+}
+
+EvaluationStatistics MotionPlanning::GetEvaluationStatistics() const
+{
+    return evaluation_statistics_;
+}
+
+void MotionPlanning::Reset()
+{
+    object_predictor_->Reset();
+    velocity_planner_->Reset();
+    if (incremental_planner_ != nullptr)
+    {
+        incremental_planner_->Reset();
+    }
+    is_cut_short_ = false;
+    selected_trajectory_ = Trajectory{};
+}
+
+MotionPlanningState MotionPlanning::GetState() const
+{
+    MotionPlanningState state{};
+    state.target_velocity = velocity_planner_->GetTargetVelocity();
+    state.object_history = object_predictor_->GetObjectHistory();
+    return state;
+}
+
+void MotionPlanning::SetState(const MotionPlanningState& state)
+{
+    velocity_planner_->SetTargetVelocity(state.target_velocity);
+    object_predictor_->SetObjectHistory(state.object_history);
+}
+
+void MotionPlanning::SetTargetLane(const GlobalLaneId target_global_lane_id)
+{
+    maneuver_pruner_->SetTargetLane(target_global_lane_id);
+}
+
+bool MotionPlanning::IsCutShort() const
+{
+    return is_cut_short_;
+}
+
+AnytimePlanningStatistics MotionPlanning::GetAnytimePlanningStatistics() const
+{
+    return anytime_planning_statistics_;
+}
+
+const std::vector<TaskTiming>& MotionPlanning::GetTaskTimings() const
+{
+    return task_timings_;
+}
+
 }  // namespace planning
@@ -5,21 +5,73 @@
 #ifndef PLANNING_MOTION_PLANNING_MOTION_PLANNING_H
 #define PLANNING_MOTION_PLANNING_MOTION_PLANNING_H
 
+#include "planning/common/i_timer.h"
+#include "planning/common/monotonic_arena.h"
+#include "planning/common/task_graph.h"
+#include "planning/common/thread_pool.h"
 #include "planning/datatypes/trajectory.h"
 #include "planning/datatypes/vehicle_dynamics.h"
+#include "planning/motion_planning/i_collision_checker.h"
 #include "planning/motion_planning/i_data_source.h"
+#include "planning/motion_planning/incremental_planner.h"
 #include "planning/motion_planning/i_maneuver_generator.h"
+#include "planning/motion_planning/i_object_predictor.h"
+#include "planning/motion_planning/i_occupancy_grid.h"
 #include "planning/motion_planning/i_trajectory_evaluator.h"
 #include "planning/motion_planning/i_trajectory_optimizer.h"
 #include "planning/motion_planning/i_trajectory_planner.h"
 #include "planning/motion_planning/i_trajectory_prioritizer.h"
 #include "planning/motion_planning/i_trajectory_selector.h"
 #include "planning/motion_planning/i_velocity_planner.h"
+#include "planning/motion_planning/maneuver_pruner.h"
+#include "planning/motion_planning/motion_planning_options.h"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <ostream>
+#include <vector>
 
 namespace planning
 {
+/// @brief Anytime planning counters (frames planned with a time budget)
+struct AnytimePlanningStatistics
+{
+    /// @brief Number of frames planned with a time budget
+    std::size_t frames{0U};
+
+    /// @brief Number of frames whose deadline expired before all the candidates were rated
+    std::size_t cut_short_frames{0U};
+
+    /// @brief Number of candidates skipped due to expired deadlines (all the frames)
+    std::size_t skipped_candidates{0U};
+
+    /// @brief Ratio of cut short frames to all the time bounded frames (0 if no frame was planned)
+    double GetCutShortRate() const noexcept
+    {
+        return (frames > 0U) ? (static_cast<double>(cut_short_frames) / static_cast<double>(frames)) : 0.0;
+    }
+};
+
+/// @brief String Stream for Anytime Planning counters (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const AnytimePlanningStatistics& statistics)
+{
+    return out << "AnytimePlanning{frames: " << statistics.frames << ", cut_short: " << statistics.cut_short_frames
+               << ", skipped_candidates: " << statistics.skipped_candidates << "}";
+}
+
+/// @brief State Motion Planning carries from one frame to the next (e.g. restored after planning a speculative frame)
+/// @note Incremental planner state is not included.
+struct MotionPlanningState
+{
+    /// @brief Target velocity of the Velocity Planner (ramps within its acceleration limits from frame to frame)
+    units::velocity::meters_per_second_t target_velocity{0.0};
+
+    /// @brief Object velocities of the previous frame (used to estimate object accelerations)
+    ObjectHistory object_history{};
+};
+
 /// @brief Motion Planning Wrapper Class
 class MotionPlanning
 {
@@ -27,19 +79,170 @@ class MotionPlanning
     /// @brief Constructor. Initialize Motion Planner with DataSource instance
     explicit MotionPlanning(const IDataSource& data_source);
 
+    /// @brief Constructor. Initialize Motion Planner with DataSource instance and provided options
+    explicit MotionPlanning(const IDataSource& data_source, const MotionPlanningOptions& options);
+
+    /// @brief Constructor. Initialize Motion Planner with DataSource instance, provided options and timer (used to
+    /// bound planning with a time budget)
+    explicit MotionPlanning(const IDataSource& data_source,
+                            const MotionPlanningOptions& options,
+                            std::unique_ptr<timer::ITimer> timer);
+
     /// @brief Generate Trajectories based on the provided DataSource (i.e. Environment)
     void GenerateTrajectories();
 
+    /// @brief Generate Trajectories within provided time budget (anytime planning).
+    ///
+    /// @details Candidates are planned, optimized and rated one at a time in priority order (ego lane first). Once the
+    /// budget expired, the remaining candidates are skipped and the best rated one so far is selected (at least one
+    /// candidate is always rated). Latency is bounded by the budget plus the processing of a single candidate.
+    ///
+    /// @param time_budget [in] - time budget of the whole frame (e.g. 5ms of the 20ms simulator tick)
+    void GenerateTrajectories(const std::chrono::system_clock::duration& time_budget);
+
+    /// @brief Forget the state carried between frames (target velocity, object history, selected trajectory), e.g.
+    /// before planning an unrelated scenario. Buffers, arena, thread pool, target lane and counters are kept.
+    void Reset();
+
+    /// @brief Get state carried to the next frame
+    MotionPlanningState GetState() const;
+
+    /// @brief Set state carried to the next frame (e.g. restore state before a speculative frame was planned)
+    void SetState(const MotionPlanningState& state);
+
+    /// @brief Set strategic target lane (e.g. decided by a slower long horizon planner). Lane changes not approaching
+    /// it are not planned, ego lane is always planned. GlobalLaneId::kInvalid (default) plans all the lanes.
+    void SetTargetLane(const GlobalLaneId target_global_lane_id);
+
+    /// @brief Check whether the deadline cut the last frame short (i.e. candidates were skipped)
+    bool IsCutShort() const;
+
+    /// @brief Get anytime planning counters (frames planned with a time budget)
+    AnytimePlanningStatistics GetAnytimePlanningStatistics() const;
+
     /// @brief Get Selected Trajectory from Trajectory Selector
     Trajectory GetSelectedTrajectory() const;
 
+    /// @brief Get incremental planning counters (all zero if incremental replanning is disabled)
+    IncrementalPlanningStatistics GetIncrementalPlanningStatistics() const;
+
+    /// @brief Get counters of maneuvers rejected before planning (all the frames)
+    ManeuverPruningStatistics GetManeuverPruningStatistics() const;
+
+    /// @brief Get per frame arena (usage of the last frame and retained capacity)
+    const MonotonicArena& GetFrameArena() const;
+
+    /// @brief Get evaluation counters of all the frames (pruned candidates with EvaluationType::kBranchAndBound)
+    EvaluationStatistics GetEvaluationStatistics() const;
+
+    /// @brief Get timings of the last frame, each frame update followed by each stage of the candidate branches
+    /// (earliest start and summed duration over the candidates, empty unless ExecutionType::kTaskGraph)
+    const std::vector<TaskTiming>& GetTaskTimings() const;
+
   private:
+    /// @brief Inputs and results of the candidate branches of the current frame
+    struct CandidateBranches
+    {
+        /// @brief Maneuvers of the current frame (nullptr outside of a run)
+        const std::vector<Maneuver>* maneuvers{nullptr};
+
+        /// @brief Deadline of the current frame (nullptr if unbounded)
+        const timer::ITimer* deadline{nullptr};
+
+        /// @brief Lane evaluation of the current frame, shared by all candidates (nullptr outside of a run)
+        const LaneEvaluation* lane_evaluation{nullptr};
+
+        /// @brief Candidate of each maneuver
+        Trajectories candidates{};
+
+        /// @brief Whether candidate of each maneuver is valid (rated)
+        std::vector<std::uint8_t> is_valid{};
+
+        /// @brief Whether maneuver was skipped (started after the deadline)
+        std::vector<std::uint8_t> is_skipped{};
+    };
+
+    /// @brief Generate Trajectories until the provided deadline (nullptr plans all the candidates)
+    void GenerateTrajectories(const timer::ITimer* deadline);
+
+    /// @brief Plan candidates for target velocity until the deadline (nullptr if unbounded), select the best one
+    /// @return maneuvers the candidates were planned for (i.e. after pruning, in order of their unique ids)
+    std::vector<Maneuver> SelectTrajectory(const units::velocity::meters_per_second_t target_velocity,
+                                           const timer::ITimer* deadline);
+
+    /// @brief Plan, optimize and rate one maneuver at a time into candidates buffer until the deadline expires.
+    void RateTrajectoriesUntil(const std::vector<Maneuver>& maneuvers,
+                               const LaneEvaluation& lane_evaluation,
+                               const timer::ITimer& deadline);
+
+    /// @brief Plan, optimize and rate each maneuver independently on the thread pool (maneuvers started after the
+    /// deadline are skipped, nullptr if unbounded).
+    /// @note Results are ordered as maneuvers (independent of the number of threads).
+    Trajectories GetRatedTrajectories(const std::vector<Maneuver>& maneuvers,
+                                      const LaneEvaluation& lane_evaluation,
+                                      const timer::ITimer* deadline);
+
+    /// @brief Plan, optimize and rate each maneuver as a branch of three tasks on the task graph (maneuvers started
+    /// after the deadline are skipped, nullptr if unbounded).
+    /// @note Results are ordered as maneuvers (independent of the number of threads).
+    Trajectories GetRatedTrajectoriesOnTaskGraph(const std::vector<Maneuver>& maneuvers,
+                                                 const LaneEvaluation& lane_evaluation,
+                                                 const timer::ITimer* deadline);
+
+    /// @brief Add given number of candidate branches (plan, optimize and rate) to the candidate graph
+    void AddCandidateTasks(const std::size_t number_of_branches);
+
+    /// @brief Append timing of each stage of the candidate branches (of given number of candidates) to task timings
+    void AddCandidateTimings(const std::size_t number_of_candidates);
+
+    /// @brief Collect valid candidates in maneuver order, count skipped ones (cut short by the deadline)
+    Trajectories GetValidTrajectories(Trajectories& candidates,
+                                      const std::vector<std::uint8_t>& is_valid,
+                                      const std::vector<std::uint8_t>& is_skipped);
+
+    /// @brief Add the per frame updates (object prediction followed by the updates depending on it) to the frame graph
+    void AddFrameTasks();
+
+    /// @brief Timer bounding time budgeted frames
+    std::unique_ptr<timer::ITimer> timer_;
+
+    /// @brief Per frame arena (scratch buffers of the serial stages, reset in O(1) at the start of each frame)
+    std::unique_ptr<MonotonicArena> frame_arena_;
+
+    /// @brief Thread Pool (created once, nullptr in serial mode unless the task graph executes serially)
+    std::unique_ptr<ThreadPool> thread_pool_;
+
+    /// @brief Task graph of the per frame updates (built once, nullptr unless ExecutionType::kTaskGraph)
+    std::unique_ptr<TaskGraph> frame_graph_;
+
+    /// @brief Task graph of the candidate branches (reused, rebuilt only for more maneuvers than branches, nullptr
+    /// unless ExecutionType::kTaskGraph)
+    std::unique_ptr<TaskGraph> candidate_graph_;
+
+    /// @brief Candidate branches (buffers reused across frames)
+    CandidateBranches candidate_branches_;
+
+    /// @brief Task timings of the last frame (frame updates followed by the stages of the candidate branches)
+    std::vector<TaskTiming> task_timings_;
+
+    /// @brief Object Predictor (runs once per frame, shared by Velocity Planner and Trajectory Evaluator)
+    std::unique_ptr<IObjectPredictor> object_predictor_;
+
+    /// @brief Collision Checker (updated once per frame, nullptr if collision checking is disabled)
+    std::unique_ptr<ICollisionChecker> collision_checker_;
+
+    /// @brief Occupancy Grid (updated once per frame, nullptr if lane level occupancy is evaluated)
+    std::unique_ptr<IOccupancyGrid> occupancy_grid_;
+
     /// @brief Velocity Planner
     std::unique_ptr<IVelocityPlanner> velocity_planner_;
 
     /// @brief Maneuver Generator
     std::unique_ptr<IManeuverGenerator> maneuver_generator_;
 
+    /// @brief Maneuver Pruner (rejects invalid or blocked maneuvers before planning)
+    std::unique_ptr<ManeuverPruner> maneuver_pruner_;
+
     /// @brief Trajectory Planner
     std::unique_ptr<ITrajectoryPlanner> trajectory_planner_;
 
@@ -55,6 +258,21 @@ class MotionPlanning
     /// @brief Trajectory Selector
     std::unique_ptr<ITrajectorySelector> trajectory_selector_;
 
+    /// @brief Incremental Planner (nullptr if incremental replanning is disabled)
+    std::unique_ptr<IncrementalPlanner> incremental_planner_;
+
+    /// @brief Evaluation counters (accumulated over all the frames)
+    EvaluationStatistics evaluation_statistics_;
+
+    /// @brief Anytime planning counters (accumulated over all the time budgeted frames)
+    AnytimePlanningStatistics anytime_planning_statistics_;
+
+    /// @brief Whether the deadline cut the last frame short
+    bool is_cut_short_;
+
+    /// @brief Candidates buffer (planned, optimized and rated in place), reused across frames
+    Trajectories candidates_;
+
     /// @brief Selected Trajectory
     Trajectory selected_trajectory_;
 };
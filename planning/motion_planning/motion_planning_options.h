@@ -0,0 +1,274 @@
+///
+/// @file
+/// @brief Contains Motion Planning options definitions
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_MOTION_PLANNING_OPTIONS_H
+#define PLANNING_MOTION_PLANNING_MOTION_PLANNING_OPTIONS_H
+
+#include <units.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace planning
+{
+/// @brief Maneuver Generator used by Motion Planning
+enum class ManeuverGeneratorType : std::uint8_t
+{
+    /// @brief One maneuver per lane (left, ego, right) at target velocity
+    kLanes = 0U,
+    /// @brief Frenet lattice of maneuvers (lanes x velocities x horizons)
+    kLattice = 1U
+};
+
+/// @brief Trajectory Optimizer used by Motion Planning
+enum class TrajectoryOptimizerType : std::uint8_t
+{
+    /// @brief Spline through planned anchor waypoints
+    kSpline = 0U,
+    /// @brief Jerk minimal quartic (longitudinal) and quintic (lateral) polynomials in Frenet space
+    kFrenetPolynomial = 1U
+};
+
+/// @brief Motion Model used to predict the objects
+enum class PredictionModel : std::uint8_t
+{
+    /// @brief Objects keep their current velocity
+    kConstantVelocity = 0U,
+    /// @brief Objects keep their acceleration (estimated from velocity change between consecutive frames)
+    kConstantAcceleration = 1U
+};
+
+/// @brief Contains Object Prediction options
+struct PredictionOptions
+{
+    /// @brief Motion Model used to predict the objects
+    PredictionModel model{PredictionModel::kConstantVelocity};
+
+    /// @brief Number of predicted time steps (including the current one), default covers the simulator's path length
+    std::size_t number_of_steps{51U};
+
+    /// @brief Duration between consecutive predicted time steps (simulator tick)
+    units::time::second_t time_step{0.02};
+
+    /// @brief Limit for the estimated object acceleration (suppresses noise of the velocity difference)
+    units::acceleration::meters_per_second_squared_t max_acceleration{5.0};
+};
+
+/// @brief Contains Collision Checker options (footprints of ego and objects as oriented boxes)
+struct CollisionCheckerOptions
+{
+    /// @brief Vehicle length (ego and objects)
+    units::length::meter_t vehicle_length{5.0};
+
+    /// @brief Vehicle width (ego and objects)
+    units::length::meter_t vehicle_width{2.0};
+
+    /// @brief Margin added on each side of the ego footprint
+    units::length::meter_t safety_margin{0.5};
+};
+
+/// @brief Occupancy evaluation used to rate the drivability of the candidates
+enum class OccupancyEvaluationType : std::uint8_t
+{
+    /// @brief Lane level occupancy (objects near ego once it reaches previous path end)
+    kLanes = 0U,
+    /// @brief Corridor of each candidate queried in Frenet space-time occupancy grid
+    kOccupancyGrid = 1U
+};
+
+/// @brief Evaluation of the candidates' cost terms
+enum class EvaluationType : std::uint8_t
+{
+    /// @brief All cost terms of all the drivable candidates
+    kExhaustive = 0U,
+    /// @brief Candidates in order of their lower bound, terms (cheapest first) evaluated only while the candidate may
+    /// still beat the best cost so far (same selected trajectory as kExhaustive)
+    kBranchAndBound = 1U
+};
+
+/// @brief Execution of the Motion Planning stages
+enum class ExecutionType : std::uint8_t
+{
+    /// @brief Stage by stage in the calling thread, candidates in parallel on the thread pool (number_of_threads > 0)
+    kStages = 0U,
+    /// @brief Task graph on the thread pool, i.e. frame updates after object prediction overlap each other and each
+    /// candidate is a plan, optimize and rate branch (number_of_threads = 0 executes the graph serially)
+    kTaskGraph = 1U
+};
+
+/// @brief Contains Occupancy Grid options (longitudinal extent relative to ego, lanes and resolution)
+/// @note Memory is bounded by these options (independent of the number of objects), i.e. number of time steps x
+/// number of lanes x ceil(cells per lane / 64) words of 64 bits.
+struct OccupancyGridOptions
+{
+    /// @brief Longitudinal size of a cell
+    units::length::meter_t resolution{1.0};
+
+    /// @brief Longitudinal extent behind ego
+    units::length::meter_t distance_behind{30.0};
+
+    /// @brief Longitudinal extent ahead of ego
+    units::length::meter_t distance_ahead{100.0};
+
+    /// @brief Number of lanes (global lanes, from left)
+    std::size_t number_of_lanes{3U};
+
+    /// @brief Lateral size of a lane
+    units::length::meter_t lane_width{4.0};
+};
+
+/// @brief Contains Frenet Lattice sampling options
+struct LatticeOptions
+{
+    /// @brief Number of velocity samples per lane (target velocity and below, spaced by velocity_resolution)
+    std::size_t number_of_velocities{7U};
+
+    /// @brief Spacing between velocity samples
+    units::velocity::meters_per_second_t velocity_resolution{1.0};
+
+    /// @brief Number of planning horizon samples per lane and velocity (spaced by horizon_resolution)
+    std::size_t number_of_horizons{4U};
+
+    /// @brief Shortest planning horizon (longitudinal spacing of anchor waypoints)
+    units::length::meter_t min_horizon{30.0};
+
+    /// @brief Spacing between planning horizon samples
+    units::length::meter_t horizon_resolution{10.0};
+};
+
+/// @brief Contains weights of the cost terms used to rate drivable candidates (0 disables the term's evaluation)
+/// @note Each term is normalized per candidate (mean over its waypoints), hence weights are comparable between
+/// candidates of different lengths.
+struct CostOptions
+{
+    /// @brief Missing progress, i.e. 1 - (travelled distance / distance at speed limit), in [0, 1]
+    double progress_weight{0.0};
+
+    /// @brief Mean absolute lateral offset from the ego heading line (in meters)
+    double lateral_offset_weight{0.0};
+
+    /// @brief Mean squared jerk (in m^2/s^6)
+    double jerk_weight{0.0};
+
+    /// @brief Mean squared acceleration (in m^2/s^4)
+    double acceleration_weight{0.0};
+
+    /// @brief Mean squared curvature (in 1/m^2)
+    double curvature_weight{0.0};
+
+    /// @brief Mean proximity to predicted objects, 1 - (distance / proximity radius)^2 if within radius, in [0, 1]
+    double proximity_weight{0.0};
+
+    /// @brief Lane change (1 for candidates leaving the ego lane)
+    double lane_change_weight{1.0};
+
+    /// @brief Distance to predicted objects below which proximity is penalized
+    units::length::meter_t proximity_radius{10.0};
+};
+
+/// @brief Contains Motion Planning Options
+struct MotionPlanningOptions
+{
+    /// @brief Number of worker threads used to plan, optimize and evaluate each candidate independently.
+    /// @note 0 runs all the stages serially (stage by stage for all candidates) in the calling thread.
+    std::size_t number_of_threads{0U};
+
+    /// @brief Execution of the stages (on number_of_threads worker threads)
+    ExecutionType execution_type{ExecutionType::kStages};
+
+    /// @brief Maneuver Generator used to produce the candidates
+    ManeuverGeneratorType maneuver_generator_type{ManeuverGeneratorType::kLanes};
+
+    /// @brief Lattice sampling (used only with ManeuverGeneratorType::kLattice)
+    LatticeOptions lattice_options{};
+
+    /// @brief Trajectory Optimizer used to produce the waypoints of each candidate
+    TrajectoryOptimizerType trajectory_optimizer_type{TrajectoryOptimizerType::kSpline};
+
+    /// @brief Reuse the previous selected trajectory (extend its tail) unless a replanning trigger fires.
+    /// @note Applies to TrajectoryOptimizerType::kSpline only (extension follows the selected trajectory's spline).
+    bool incremental_replanning{false};
+
+    /// @brief Object Prediction (runs once per frame, shared by Velocity Planner and Lane Evaluator)
+    PredictionOptions prediction_options{};
+
+    /// @brief Check each candidate's waypoints (at their timestamps) against the predicted object footprints.
+    /// @note Colliding candidates are rated not drivable (in addition to the lane level evaluation).
+    bool collision_checking{false};
+
+    /// @brief Footprints used for collision checking and occupancy grid
+    CollisionCheckerOptions collision_checker_options{};
+
+    /// @brief Occupancy evaluation used to rate the drivability of the candidates
+    OccupancyEvaluationType occupancy_evaluation_type{OccupancyEvaluationType::kLanes};
+
+    /// @brief Occupancy Grid (used only with OccupancyEvaluationType::kOccupancyGrid)
+    OccupancyGridOptions occupancy_grid_options{};
+
+    /// @brief Cost terms used to rate drivable candidates (lane change penalty only by default)
+    CostOptions cost_options{};
+
+    /// @brief Initial capacity (in bytes) of the per frame arena for scratch buffers of the serial stages (grows on
+    /// demand, retained and reset at the start of each frame)
+    std::size_t frame_arena_capacity{256U * 1024U};
+
+    /// @brief Evaluation of the cost terms
+    /// @note Applies to serial evaluation (number_of_threads = 0) with non negative weights, otherwise exhaustive.
+    EvaluationType evaluation_type{EvaluationType::kExhaustive};
+};
+
+/// @brief Contains Two Rate Planning options (fast loop uses MotionPlanningOptions, e.g. short horizon lanes)
+struct TwoRatePlanningOptions
+{
+    /// @brief Number of fast loop frames between starts of the strategic (slow loop) refresh (at least 1)
+    /// @note A refresh still running when due is not restarted, i.e. the slow loop never queues up.
+    std::size_t strategic_refresh_period{10U};
+
+    /// @brief Strategic planning deciding the target lane (e.g. lattice with long horizons and heavy cost terms)
+    MotionPlanningOptions strategic_options{};
+};
+
+/// @brief Contains Batch Planning options
+struct BatchPlanningOptions
+{
+    /// @brief Number of worker threads, each with its own Motion Planning (0 plans in the calling thread)
+    /// @note Frames are distributed across workers, each frame is planned serially (number_of_threads and
+    /// execution_type of MotionPlanningOptions are ignored, i.e. no nested thread pools).
+    std::size_t number_of_threads{0U};
+};
+
+/// @brief Contains Replay Planning options
+struct ReplayOptions
+{
+    /// @brief Number of worker threads (shards), each replaying whole drives with its own Motion Planning (0 replays
+    /// in the calling thread)
+    /// @note Frames are planned serially (number_of_threads and execution_type of MotionPlanningOptions are ignored).
+    std::size_t number_of_threads{0U};
+};
+
+/// @brief Contains Planning Watchdog options
+struct WatchdogOptions
+{
+    /// @brief Worst case response time, the fallback trajectory is returned once planning takes longer
+    std::chrono::system_clock::duration response_time{std::chrono::milliseconds{15}};
+
+    /// @brief Deceleration along the extension of the previous path (fallback trajectory)
+    units::acceleration::meters_per_second_squared_t fallback_deceleration{3.0};
+};
+
+/// @brief Contains Speculative Planning options (tolerances between predicted and received frame)
+struct SpeculationOptions
+{
+    /// @brief Position tolerance (previous path, previous path end, ego and objects)
+    units::length::meter_t position_tolerance{0.5};
+
+    /// @brief Velocity tolerance (ego and objects)
+    units::velocity::meters_per_second_t velocity_tolerance{0.5};
+};
+
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_MOTION_PLANNING_OPTIONS_H
@@ -0,0 +1,128 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/object_predictor.h"
+
+#include "planning/common/logging.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+
+#include <algorithm>
+
+namespace planning
+{
+ObjectPredictor::ObjectPredictor(const IDataSource& data_source)
+    : ObjectPredictor{data_source, PredictionOptions{}}
+{
+}
+
+ObjectPredictor::ObjectPredictor(const IDataSource& data_source, const PredictionOptions& options)
+    : data_source_{data_source},
+      options_{options},
+      accelerations_{},
+      previous_velocities_{},
+      predicted_objects_{}
+{
+}
+
+void ObjectPredictor::PredictObjects()
+{
+    const auto sensor_fusion = data_source_.GetSensorFusion();
+    const auto& objects = sensor_fusion.objs;
+    const auto number_of_objects = objects.size();
+
+    EstimateAccelerations(sensor_fusion);
+
+    // current time step is always predicted
+    const auto number_of_steps = std::max(options_.number_of_steps, static_cast<std::size_t>(1U));
+    predicted_objects_.Resize(number_of_objects, number_of_steps, options_.time_step);
+    for (std::size_t object = 0U; object < number_of_objects; ++object)
+    {
+        predicted_objects_.SetObjectId(object, objects[object].idx);
+    }
+
+    // fill time-major, i.e. all the objects of a time step are written contiguously
+    const auto time_step = options_.time_step.value();
+    for (std::size_t step = 0U; step < number_of_steps; ++step)
+    {
+        const auto time = static_cast<double>(step) * time_step;
+        auto* const states = predicted_objects_.GetStates(step);
+        for (std::size_t object = 0U; object < number_of_objects; ++object)
+        {
+            states[object] = GetPredictedState(objects[object], accelerations_[object], time);
+        }
+    }
+
+    LOG(INFO) << "Predicted objects: " << number_of_objects << " x " << number_of_steps << " steps";
+}
+
+const PredictedObjects& ObjectPredictor::GetPredictedObjects() const
+{
+    return predicted_objects_;
+}
+
+void ObjectPredictor::Reset()
+{
+    previous_velocities_.clear();
+}
+
+const ObjectHistory& ObjectPredictor::GetObjectHistory() const
+{
+    return previous_velocities_;
+}
+
+void ObjectPredictor::SetObjectHistory(const ObjectHistory& object_history)
+{
+    previous_velocities_ = object_history;
+}
+
+PredictedObjectState ObjectPredictor::GetPredictedState(const ObjectFusion& object_fusion,
+                                                        const double acceleration,
+                                                        const double time) noexcept
+{
+    const auto velocity = object_fusion.velocity.value();
+    const auto is_stopping = (acceleration < 0.0) && ((velocity + (acceleration * time)) < 0.0);
+    const auto duration = is_stopping ? std::max(0.0, -velocity / acceleration) : time;
+
+    return PredictedObjectState{
+        object_fusion.frenet_coords.s + (velocity * duration) + (0.5 * acceleration * duration * duration),
+        object_fusion.frenet_coords.d,
+        velocity + (acceleration * duration)};
+}
+
+void ObjectPredictor::EstimateAccelerations(const SensorFusion& sensor_fusion)
+{
+    const auto& objects = sensor_fusion.objs;
+    accelerations_.assign(objects.size(), 0.0);
+
+    const auto elapsed_time = GetElapsedTime().value();
+    if ((options_.model == PredictionModel::kConstantAcceleration) && (elapsed_time > 0.0))
+    {
+        const auto max_acceleration = options_.max_acceleration.value();
+        for (std::size_t object = 0U; object < objects.size(); ++object)
+        {
+            const auto previous_velocity = previous_velocities_.find(objects[object].idx);
+            if (previous_velocity != previous_velocities_.end())
+            {
+                const auto acceleration = (objects[object].velocity.value() - previous_velocity->second) / elapsed_time;
+                accelerations_[object] = std::min(std::max(acceleration, -max_acceleration), max_acceleration);
+            }
+        }
+    }
+
+    previous_velocities_.clear();
+    for (const auto& object : objects)
+    {
+        previous_velocities_[object.idx] = object.velocity.value();
+    }
+}
+
+units::time::second_t ObjectPredictor::GetElapsedTime() const
+{
+    // every sent path has kTotalWaypoints waypoints, the simulator consumes one of them each tick
+    const auto previous_path_size = std::min(data_source_.GetSharedPreviousPath()->size(), kTotalWaypoints);
+    const auto consumed_waypoints = kTotalWaypoints - previous_path_size;
+    return units::time::second_t{static_cast<double>(consumed_waypoints) * kWaypointSamplingTime};
+}
+
+}  // namespace planning
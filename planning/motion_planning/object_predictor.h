@@ -0,0 +1,80 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_OBJECT_PREDICTOR_H
+#define PLANNING_MOTION_PLANNING_OBJECT_PREDICTOR_H
+
+#include "planning/datatypes/sensor_fusion.h"
+#include "planning/motion_planning/i_data_source.h"
+#include "planning/motion_planning/i_object_predictor.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <units.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace planning
+{
+/// @brief Predicts all the objects (SensorFusion) once per frame with constant velocity or constant acceleration
+/// motion model.
+///
+/// @note Objects don't provide acceleration, hence for PredictionModel::kConstantAcceleration it is estimated from
+/// the velocity change of each object (by object id) since the previous frame. Time between frames is derived from
+/// the number of waypoints consumed by the simulator.
+class ObjectPredictor : public IObjectPredictor
+{
+  public:
+    /// @brief Constructor. Initializes with DataSource and default (constant velocity) prediction options.
+    explicit ObjectPredictor(const IDataSource& data_source);
+
+    /// @brief Constructor. Initializes with DataSource and provided prediction options.
+    explicit ObjectPredictor(const IDataSource& data_source, const PredictionOptions& options);
+
+    /// @brief Predict all the objects over the planning horizon (to be called once per frame)
+    void PredictObjects() override;
+
+    /// @brief Get Predicted Objects of the last prediction
+    const PredictedObjects& GetPredictedObjects() const override;
+
+    /// @brief Forget object velocities of previous frames (i.e. no acceleration is estimated for the next frame)
+    void Reset() override;
+
+    /// @brief Get object velocities of the previous frame
+    const ObjectHistory& GetObjectHistory() const override;
+
+    /// @brief Set object velocities of the previous frame
+    void SetObjectHistory(const ObjectHistory& object_history) override;
+
+    /// @brief Predicted state of the object after given time with given (constant) acceleration.
+    /// @note Decelerating object stops at standstill (i.e. never drives backwards).
+    static PredictedObjectState GetPredictedState(const ObjectFusion& object_fusion,
+                                                  const double acceleration,
+                                                  const double time) noexcept;
+
+  private:
+    /// @brief Estimate acceleration of each object (zero for constant velocity model or unknown objects)
+    void EstimateAccelerations(const SensorFusion& sensor_fusion);
+
+    /// @brief Time since the previous frame (based on consumed waypoints of previous path)
+    units::time::second_t GetElapsedTime() const;
+
+    /// @brief DataSource (contains information on SensorFusion, Previous Path etc.)
+    const IDataSource& data_source_;
+
+    /// @brief Prediction Options
+    const PredictionOptions options_;
+
+    /// @brief Estimated acceleration for each object of the current frame (indexed as SensorFusion objects)
+    std::vector<double> accelerations_;
+
+    /// @brief Object velocities of the previous frame (by object id)
+    ObjectHistory previous_velocities_;
+
+    /// @brief Predicted Objects (time-major buffer, reused between frames)
+    PredictedObjects predicted_objects_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_OBJECT_PREDICTOR_H
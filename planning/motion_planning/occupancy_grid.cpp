@@ -0,0 +1,232 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/occupancy_grid.h"
+
+#include "planning/common/logging.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+
+namespace planning
+{
+namespace
+{
+/// @brief Number of bins per word
+constexpr std::size_t kBitsPerWord{64U};
+
+/// @brief Mask of the bits [first_bit, last_bit] within a word (0 <= first_bit <= last_bit < kBitsPerWord)
+inline std::uint64_t GetMask(const std::size_t first_bit, const std::size_t last_bit) noexcept
+{
+    const auto all = ~std::uint64_t{0U};
+    return (all >> (kBitsPerWord - 1U - last_bit)) & (all << first_bit);
+}
+
+/// @brief Number of set bits of a word
+inline std::size_t GetPopulationCount(const std::uint64_t word) noexcept
+{
+    return std::bitset<kBitsPerWord>{word}.count();
+}
+}  // namespace
+
+OccupancyGrid::OccupancyGrid(const IDataSource& data_source, const IObjectPredictor& object_predictor)
+    : OccupancyGrid{data_source, object_predictor, OccupancyGridOptions{}, CollisionCheckerOptions{}}
+{
+}
+
+OccupancyGrid::OccupancyGrid(const IDataSource& data_source,
+                             const IObjectPredictor& object_predictor,
+                             const OccupancyGridOptions& options,
+                             const CollisionCheckerOptions& footprint_options)
+    : data_source_{data_source},
+      object_predictor_{object_predictor},
+      resolution_{options.resolution.value()},
+      distance_behind_{options.distance_behind.value()},
+      lane_width_{options.lane_width.value()},
+      number_of_lanes_{options.number_of_lanes},
+      number_of_bins_{static_cast<std::size_t>(
+          std::ceil((options.distance_behind + options.distance_ahead).value() / options.resolution.value()))},
+      number_of_words_{(number_of_bins_ + kBitsPerWord - 1U) / kBitsPerWord},
+      ego_half_length_{(0.5 * footprint_options.vehicle_length.value()) + footprint_options.safety_margin.value()},
+      object_half_length_{0.5 * footprint_options.vehicle_length.value()},
+      object_half_width_{0.5 * footprint_options.vehicle_width.value()},
+      origin_{0.0},
+      ego_s_{0.0},
+      ego_velocity_{0.0},
+      ego_global_lane_id_{GlobalLaneId::kInvalid},
+      number_of_steps_{0U},
+      time_step_{0.0},
+      cells_{},
+      build_duration_{0}
+{
+}
+
+void OccupancyGrid::Update()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto& predicted_objects = object_predictor_.GetPredictedObjects();
+    const auto vehicle_dynamics = data_source_.GetVehicleDynamics();
+
+    ego_s_ = vehicle_dynamics.frenet_coords.s;
+    ego_velocity_ = vehicle_dynamics.velocity.value();
+    ego_global_lane_id_ = data_source_.GetGlobalLaneId();
+    origin_ = ego_s_ - distance_behind_;
+    number_of_steps_ = predicted_objects.GetNumberOfSteps();
+    time_step_ = predicted_objects.GetTimeStep().value();
+
+    // size is bounded by the options, hence allocated on the first frame only
+    cells_.assign(number_of_steps_ * number_of_lanes_ * number_of_words_, std::uint64_t{0U});
+
+    const auto last_lane = static_cast<std::int64_t>(number_of_lanes_) - 1;
+    for (std::size_t step = 0U; step < number_of_steps_; ++step)
+    {
+        const auto* const states = predicted_objects.GetStates(step);
+        for (std::size_t object = 0U; object < predicted_objects.GetNumberOfObjects(); ++object)
+        {
+            const auto& state = states[object];
+            const auto first_lane =
+                static_cast<std::int64_t>(std::floor((state.d - object_half_width_) / lane_width_));
+            const auto last_object_lane =
+                static_cast<std::int64_t>(std::floor((state.d + object_half_width_) / lane_width_));
+            const auto first_bin = GetBin(state.s - object_half_length_);
+            const auto last_bin = GetBin(state.s + object_half_length_);
+            for (auto lane = std::max(first_lane, std::int64_t{0}); lane <= std::min(last_object_lane, last_lane);
+                 ++lane)
+            {
+                SetBins(step, static_cast<std::size_t>(lane), first_bin, last_bin);
+            }
+        }
+    }
+
+    build_duration_ = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    LOG(INFO) << "Occupancy grid: " << predicted_objects.GetNumberOfObjects() << " objects, " << number_of_steps_
+              << " steps x " << number_of_lanes_ << " lanes x " << number_of_bins_ << " bins (" << GetMemoryUsage()
+              << " bytes), built in " << build_duration_.count() << " ns";
+}
+
+bool OccupancyGrid::IsCorridorFree(const Trajectory& trajectory) const
+{
+    return (CountCorridorCells(trajectory, true) == 0U);
+}
+
+std::size_t OccupancyGrid::GetNumberOfOccupiedCells(const Trajectory& trajectory) const
+{
+    return CountCorridorCells(trajectory, false);
+}
+
+std::size_t OccupancyGrid::CountCorridorCells(const Trajectory& trajectory, const bool stop_at_occupied) const
+{
+    // corridor lanes, current ego lane and target lane (if different)
+    std::size_t lanes[2U]{};
+    std::size_t number_of_corridor_lanes = 0U;
+    for (const auto global_lane_id : {ego_global_lane_id_, trajectory.global_lane_id})
+    {
+        const auto lane = static_cast<std::size_t>(global_lane_id);
+        if ((lane < number_of_lanes_) && ((number_of_corridor_lanes == 0U) || (lanes[0U] != lane)))
+        {
+            lanes[number_of_corridor_lanes] = lane;
+            ++number_of_corridor_lanes;
+        }
+    }
+
+    // longitudinal extent ego may occupy, between moving with current and with target velocity
+    const auto min_velocity = std::min(ego_velocity_, trajectory.velocity.value());
+    const auto max_velocity = std::max(ego_velocity_, trajectory.velocity.value());
+
+    std::size_t occupied_cells = 0U;
+    for (std::size_t step = 0U; (step < number_of_steps_) && !(stop_at_occupied && (occupied_cells > 0U)); ++step)
+    {
+        const auto time = static_cast<double>(step) * time_step_;
+        const auto first_bin = GetBin(ego_s_ + (min_velocity * time) - ego_half_length_);
+        const auto last_bin = GetBin(ego_s_ + (max_velocity * time) + ego_half_length_);
+        for (std::size_t idx = 0U; idx < number_of_corridor_lanes; ++idx)
+        {
+            occupied_cells += CountBins(step, lanes[idx], first_bin, last_bin);
+        }
+    }
+    return occupied_cells;
+}
+
+std::size_t OccupancyGrid::GetNumberOfOccupiedCells() const
+{
+    std::size_t occupied_cells = 0U;
+    for (const auto word : cells_)
+    {
+        occupied_cells += GetPopulationCount(word);
+    }
+    return occupied_cells;
+}
+
+bool OccupancyGrid::IsOccupied(const std::size_t step, const GlobalLaneId global_lane_id, const double s) const
+{
+    const auto lane = static_cast<std::size_t>(global_lane_id);
+    const auto bin = GetBin(s);
+    return (step < number_of_steps_) && (lane < number_of_lanes_) && (CountBins(step, lane, bin, bin) > 0U);
+}
+
+std::size_t OccupancyGrid::GetMemoryUsage() const noexcept
+{
+    return cells_.size() * sizeof(std::uint64_t);
+}
+
+std::chrono::nanoseconds OccupancyGrid::GetBuildDuration() const noexcept
+{
+    return build_duration_;
+}
+
+std::int64_t OccupancyGrid::GetBin(const double s) const noexcept
+{
+    return static_cast<std::int64_t>(std::floor((s - origin_) / resolution_));
+}
+
+void OccupancyGrid::SetBins(const std::size_t step,
+                            const std::size_t lane,
+                            std::int64_t first_bin,
+                            std::int64_t last_bin)
+{
+    first_bin = std::max(first_bin, std::int64_t{0});
+    last_bin = std::min(last_bin, static_cast<std::int64_t>(number_of_bins_) - 1);
+    if (first_bin > last_bin)
+    {
+        return;
+    }
+
+    const auto first = static_cast<std::size_t>(first_bin);
+    const auto last = static_cast<std::size_t>(last_bin);
+    auto* const row = cells_.data() + (((step * number_of_lanes_) + lane) * number_of_words_);
+    for (auto word = first / kBitsPerWord; word <= last / kBitsPerWord; ++word)
+    {
+        const auto first_bit = (word == (first / kBitsPerWord)) ? (first % kBitsPerWord) : 0U;
+        const auto last_bit = (word == (last / kBitsPerWord)) ? (last % kBitsPerWord) : (kBitsPerWord - 1U);
+        row[word] |= GetMask(first_bit, last_bit);
+    }
+}
+
+std::size_t OccupancyGrid::CountBins(const std::size_t step,
+                                     const std::size_t lane,
+                                     std::int64_t first_bin,
+                                     std::int64_t last_bin) const noexcept
+{
+    first_bin = std::max(first_bin, std::int64_t{0});
+    last_bin = std::min(last_bin, static_cast<std::int64_t>(number_of_bins_) - 1);
+    if (first_bin > last_bin)
+    {
+        return 0U;
+    }
+
+    const auto first = static_cast<std::size_t>(first_bin);
+    const auto last = static_cast<std::size_t>(last_bin);
+    const auto* const row = cells_.data() + (((step * number_of_lanes_) + lane) * number_of_words_);
+    std::size_t occupied_bins = 0U;
+    for (auto word = first / kBitsPerWord; word <= last / kBitsPerWord; ++word)
+    {
+        const auto first_bit = (word == (first / kBitsPerWord)) ? (first % kBitsPerWord) : 0U;
+        const auto last_bit = (word == (last / kBitsPerWord)) ? (last % kBitsPerWord) : (kBitsPerWord - 1U);
+        occupied_bins += GetPopulationCount(row[word] & GetMask(first_bit, last_bit));
+    }
+    return occupied_bins;
+}
+
+}  // namespace planning
@@ -0,0 +1,137 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_OCCUPANCY_GRID_H
+#define PLANNING_MOTION_PLANNING_OCCUPANCY_GRID_H
+
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/i_data_source.h"
+#include "planning/motion_planning/i_object_predictor.h"
+#include "planning/motion_planning/i_occupancy_grid.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace planning
+{
+/// @brief Frenet space-time occupancy (s-bin x lane x time step) of predicted objects, stored as packed bitsets.
+///
+/// @details Each (time step, lane) row is a bitset over the longitudinal bins around ego, packed into 64 bit words.
+/// Rows are filled once per frame from the predicted object footprints (range of bins per object and lane). The
+/// corridor of a candidate is the range of bins ego may occupy (between current and target velocity) on the current
+/// and target lane at each time step, hence querying it is a word wide AND with a range mask and a population count
+/// per touched word, independent of the number of objects.
+class OccupancyGrid : public IOccupancyGrid
+{
+  public:
+    /// @brief Constructor. Initializes with DataSource, Object Predictor and default grid and footprints.
+    explicit OccupancyGrid(const IDataSource& data_source, const IObjectPredictor& object_predictor);
+
+    /// @brief Constructor. Initializes with DataSource, Object Predictor and provided grid and footprints.
+    explicit OccupancyGrid(const IDataSource& data_source,
+                           const IObjectPredictor& object_predictor,
+                           const OccupancyGridOptions& options,
+                           const CollisionCheckerOptions& footprint_options);
+
+    /// @brief Fill occupancy from predicted objects (grid is centered on current ego position)
+    void Update() override;
+
+    /// @brief Check the corridor swept by the trajectory (lanes and longitudinal extent over time) to be unoccupied
+    bool IsCorridorFree(const Trajectory& trajectory) const override;
+
+    /// @brief Number of occupied cells within the corridor swept by the trajectory
+    std::size_t GetNumberOfOccupiedCells(const Trajectory& trajectory) const;
+
+    /// @brief Number of occupied cells (whole grid)
+    std::size_t GetNumberOfOccupiedCells() const;
+
+    /// @brief Check given cell to be occupied (cells outside of the grid are not occupied)
+    bool IsOccupied(const std::size_t step, const GlobalLaneId global_lane_id, const double s) const;
+
+    /// @brief Memory used by the occupancy bitsets (in bytes)
+    std::size_t GetMemoryUsage() const noexcept;
+
+    /// @brief Duration of the last Update
+    std::chrono::nanoseconds GetBuildDuration() const noexcept;
+
+  private:
+    /// @brief Count occupied cells within the corridor swept by the trajectory (optionally up to the first occupied
+    /// time step)
+    std::size_t CountCorridorCells(const Trajectory& trajectory, const bool stop_at_occupied) const;
+
+    /// @brief Longitudinal bin of given position (may be outside of the grid)
+    std::int64_t GetBin(const double s) const noexcept;
+
+    /// @brief Set bins [first_bin, last_bin] (clamped to the grid) of given row
+    void SetBins(const std::size_t step, const std::size_t lane, std::int64_t first_bin, std::int64_t last_bin);
+
+    /// @brief Count occupied bins [first_bin, last_bin] (clamped to the grid) of given row
+    std::size_t CountBins(const std::size_t step,
+                          const std::size_t lane,
+                          std::int64_t first_bin,
+                          std::int64_t last_bin) const noexcept;
+
+    /// @brief DataSource (contains information on Vehicle Dynamics)
+    const IDataSource& data_source_;
+
+    /// @brief Object Predictor (predicted once per frame)
+    const IObjectPredictor& object_predictor_;
+
+    /// @brief Longitudinal size of a bin
+    const double resolution_;
+
+    /// @brief Longitudinal extent behind ego
+    const double distance_behind_;
+
+    /// @brief Lateral size of a lane
+    const double lane_width_;
+
+    /// @brief Number of lanes
+    const std::size_t number_of_lanes_;
+
+    /// @brief Number of longitudinal bins per lane
+    const std::size_t number_of_bins_;
+
+    /// @brief Number of 64 bit words per row (lane)
+    const std::size_t number_of_words_;
+
+    /// @brief Ego footprint half length (including safety margin)
+    const double ego_half_length_;
+
+    /// @brief Object footprint half length
+    const double object_half_length_;
+
+    /// @brief Object footprint half width
+    const double object_half_width_;
+
+    /// @brief Longitudinal position of the first bin (in meters)
+    double origin_;
+
+    /// @brief Ego longitudinal position (at Update)
+    double ego_s_;
+
+    /// @brief Ego velocity (at Update)
+    double ego_velocity_;
+
+    /// @brief Ego global lane (at Update)
+    GlobalLaneId ego_global_lane_id_;
+
+    /// @brief Number of predicted time steps
+    std::size_t number_of_steps_;
+
+    /// @brief Duration between consecutive predicted time steps (in seconds)
+    double time_step_;
+
+    /// @brief Occupancy bitsets, [time step][lane][word] (reused between frames)
+    std::vector<std::uint64_t> cells_;
+
+    /// @brief Duration of the last Update
+    std::chrono::nanoseconds build_duration_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_OCCUPANCY_GRID_H
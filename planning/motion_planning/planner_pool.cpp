@@ -0,0 +1,50 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/planner_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace planning
+{
+PlannerPool::PlannerPool(const MotionPlanningOptions& options, const std::size_t number_of_threads)
+    : planners_{}, thread_pool_{number_of_threads}
+{
+    // parallelism is across items, hence each planner plans its items serially
+    auto planner_options = options;
+    planner_options.number_of_threads = 0U;
+    planner_options.execution_type = ExecutionType::kStages;
+
+    const auto number_of_planners = std::max(number_of_threads, std::size_t{1U});
+    planners_.reserve(number_of_planners);
+    for (std::size_t idx = 0U; idx < number_of_planners; ++idx)
+    {
+        auto planner = std::make_unique<PooledPlanner>();
+        planner->motion_planning = std::make_unique<MotionPlanning>(planner->data_source, planner_options);
+        planners_.push_back(std::move(planner));
+    }
+}
+
+void PlannerPool::ForEach(const std::size_t number_of_items, const Job& job)
+{
+    std::atomic<std::size_t> next_item{0U};
+    thread_pool_.ParallelFor(planners_.size(),
+                             [&](const std::size_t planner_index)
+                             {
+                                 auto& planner = *planners_[planner_index];
+                                 for (auto item = next_item.fetch_add(1U); item < number_of_items;
+                                      item = next_item.fetch_add(1U))
+                                 {
+                                     job(planner, item);
+                                 }
+                             });
+}
+
+std::size_t PlannerPool::GetNumberOfPlanners() const
+{
+    return planners_.size();
+}
+}  // namespace planning
@@ -0,0 +1,68 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_PLANNER_POOL_H
+#define PLANNING_MOTION_PLANNING_PLANNER_POOL_H
+
+#include "planning/common/thread_pool.h"
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace planning
+{
+/// @brief Motion Planning bound to its own DataSource (used by one thread at a time)
+struct PooledPlanner
+{
+    /// @brief DataSource of Motion Planning (frame currently planned by this planner)
+    DataSource data_source;
+
+    /// @brief Motion Planning bound to data_source
+    std::unique_ptr<MotionPlanning> motion_planning;
+};
+
+/// @brief Planner Pool. One Motion Planning per worker thread for planning independent items (e.g. frames or whole
+/// drives) in parallel.
+///
+/// @details Planners are created once and reused for all the items. Parallelism is across items, hence each planner
+/// plans serially (no thread pool of its own, ExecutionType::kStages). Planners pull the next item from a shared index,
+/// i.e. expensive items don't stall a statically assigned share.
+class PlannerPool
+{
+  public:
+    /// @brief Job planning one item with the given planner
+    using Job = std::function<void(PooledPlanner&, std::size_t)>;
+
+    /// @brief Constructor. Initializes one planner per thread (at least one) for provided options.
+    ///
+    /// @param options [in] - options of each planner (number of threads and execution type are overridden)
+    /// @param number_of_threads [in] - number of worker threads (0 plans all the items in the calling thread)
+    explicit PlannerPool(const MotionPlanningOptions& options, const std::size_t number_of_threads);
+
+    PlannerPool(const PlannerPool&) = delete;
+    PlannerPool& operator=(const PlannerPool&) = delete;
+
+    /// @brief Run job for each item (0 to number_of_items - 1) and wait for all of them
+    ///
+    /// @note Each item is run once, by one planner. Items of one planner are run in order of their index.
+    void ForEach(const std::size_t number_of_items, const Job& job);
+
+    /// @brief Get number of planners
+    std::size_t GetNumberOfPlanners() const;
+
+  private:
+    /// @brief Planners (at least one, used by one thread at a time)
+    std::vector<std::unique_ptr<PooledPlanner>> planners_;
+
+    /// @brief Worker threads (destroyed first)
+    ThreadPool thread_pool_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_PLANNER_POOL_H
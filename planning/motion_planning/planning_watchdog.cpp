@@ -0,0 +1,177 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/planning_watchdog.h"
+
+#include "planning/common/logging.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+
+namespace planning
+{
+PlanningWatchdog::PlanningWatchdog(const MotionPlanningOptions& options, const WatchdogOptions& watchdog_options)
+    : watchdog_options_{watchdog_options},
+      data_source_{},
+      motion_planning_{std::make_unique<MotionPlanning>(data_source_, options)},
+      mutex_{},
+      request_condition_{},
+      result_condition_{},
+      has_request_{false},
+      is_busy_{false},
+      is_waiting_{false},
+      has_result_{false},
+      is_stopped_{false},
+      result_{},
+      result_time_{},
+      statistics_{},
+      thread_{&PlanningWatchdog::Run, this}
+{
+}
+
+PlanningWatchdog::~PlanningWatchdog()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        is_stopped_ = true;
+    }
+    request_condition_.notify_one();
+    thread_.join();
+}
+
+Trajectory PlanningWatchdog::GetTrajectory(const DataSource& data_source)
+{
+    const auto deadline = std::chrono::steady_clock::now() + watchdog_options_.response_time;
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    ++statistics_.frames;
+    if (is_busy_)
+    {
+        // planner is still late with a previous frame (which reads the planner's DataSource), answer right away
+        ++statistics_.overruns;
+        lock.unlock();
+        LOG(WARNING) << "Planning still busy with a late frame, fallback trajectory is used.";
+        return GetFallbackTrajectory(data_source);
+    }
+
+    data_source_ = data_source;
+    has_request_ = true;
+    is_busy_ = true;
+    is_waiting_ = true;
+    has_result_ = false;
+    lock.unlock();
+    request_condition_.notify_one();
+
+    // precompute fallback trajectory while the planner runs
+    auto fallback_trajectory = GetFallbackTrajectory(data_source);
+
+    lock.lock();
+    result_condition_.wait_until(lock, deadline, [this] { return has_result_; });
+    is_waiting_ = false;
+    if (!has_result_ || (result_time_ > deadline))
+    {
+        // pending result is discarded by the planning thread, result completed after the deadline is discarded here
+        if (has_result_)
+        {
+            ++statistics_.discarded_results;
+            has_result_ = false;
+        }
+        ++statistics_.overruns;
+        lock.unlock();
+        LOG(WARNING) << "Planning exceeded response time of "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(watchdog_options_.response_time).count()
+                     << " us, fallback trajectory is used.";
+        return fallback_trajectory;
+    }
+    has_result_ = false;
+    return std::move(result_);
+}
+
+Trajectory PlanningWatchdog::GetFallbackTrajectory(const IDataSource& data_source) const
+{
+    Trajectory trajectory{};
+    trajectory.previous_path = data_source.GetSharedPreviousPath();
+    trajectory.global_lane_id = data_source.GetGlobalLaneId();
+    trajectory.lane_id = LaneId::kEgo;
+    trajectory.drivable = true;
+
+    const auto map_coordinates = data_source.GetMapCoordinates();
+    const auto& previous_path = *trajectory.previous_path;
+    if (map_coordinates.size() < 2U)
+    {
+        return trajectory;
+    }
+
+    // continue from the previous path end (or from ego if the previous path is consumed)
+    const auto vehicle_dynamics = data_source.GetVehicleDynamics();
+    auto end = vehicle_dynamics.frenet_coords;
+    auto velocity = vehicle_dynamics.velocity.value();
+    if (previous_path.size() >= 2U)
+    {
+        const auto& last = previous_path.at(previous_path.size() - 1U);
+        const auto& second_last = previous_path.at(previous_path.size() - 2U);
+        end = data_source.GetPreviousPathEnd();
+        velocity = std::hypot(last.x - second_last.x, last.y - second_last.y) / kWaypointSamplingTime;
+    }
+    trajectory.velocity = units::velocity::meters_per_second_t{velocity};
+
+    const auto n_waypoints = (previous_path.size() < kTotalWaypoints) ? (kTotalWaypoints - previous_path.size()) : 0U;
+    trajectory.waypoints.reserve(n_waypoints);
+
+    // decelerate along the lane (keeping the lateral position) until standstill
+    const auto velocity_decrement = watchdog_options_.fallback_deceleration.value() * kWaypointSamplingTime;
+    FrenetToGlobalConverter to_global{map_coordinates};
+    auto s = end.s;
+    for (std::size_t idx = 0U; idx < n_waypoints; ++idx)
+    {
+        velocity = std::max(velocity - velocity_decrement, 0.0);
+        s += velocity * kWaypointSamplingTime;
+        trajectory.waypoints.push_back(to_global(s, end.d));
+    }
+    return trajectory;
+}
+
+WatchdogStatistics PlanningWatchdog::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock{mutex_};
+    return statistics_;
+}
+
+void PlanningWatchdog::Run()
+{
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true)
+    {
+        request_condition_.wait(lock, [this] { return has_request_ || is_stopped_; });
+        if (is_stopped_)
+        {
+            return;
+        }
+        has_request_ = false;
+
+        lock.unlock();
+        motion_planning_->GenerateTrajectories();
+        auto selected_trajectory = motion_planning_->GetSelectedTrajectory();
+        const auto result_time = std::chrono::steady_clock::now();
+        lock.lock();
+
+        is_busy_ = false;
+        if (is_waiting_)
+        {
+            result_ = std::move(selected_trajectory);
+            result_time_ = result_time;
+            has_result_ = true;
+            result_condition_.notify_one();
+        }
+        else
+        {
+            ++statistics_.discarded_results;
+        }
+    }
+}
+}  // namespace planning
@@ -0,0 +1,135 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_PLANNING_WATCHDOG_H
+#define PLANNING_MOTION_PLANNING_PLANNING_WATCHDOG_H
+
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+
+namespace planning
+{
+/// @brief Planning Watchdog counters
+struct WatchdogStatistics
+{
+    /// @brief Number of requested frames
+    std::size_t frames{0U};
+
+    /// @brief Number of frames answered with the fallback trajectory (planning late or still busy with a late frame)
+    std::size_t overruns{0U};
+
+    /// @brief Number of planning results completed after their frame was answered (discarded)
+    std::size_t discarded_results{0U};
+
+    /// @brief Ratio of overruns to all frames (0 if no frame was requested)
+    double GetOverrunRate() const noexcept
+    {
+        return (frames > 0U) ? (static_cast<double>(overruns) / static_cast<double>(frames)) : 0.0;
+    }
+};
+
+/// @brief Planning Watchdog. Runs Motion Planning on a dedicated thread and answers each frame within the configured
+/// response time, either with the selected trajectory or (on overrun) with a fallback trajectory.
+///
+/// @details Each frame's DataSource is copied into the planner's own DataSource, hence a late planner never reads the
+/// caller's DataSource while it is updated. While the planner is still busy with a late frame, the following frames
+/// are answered with the fallback trajectory right away and the late result is discarded. The fallback trajectory
+/// keeps the previous path and extends it along the lane with a safely decelerating velocity, it is computed (cheap,
+/// no candidates) in the calling thread while the planner runs.
+///
+/// @note The destructor waits for a running planning to finish.
+class PlanningWatchdog
+{
+  public:
+    /// @brief Constructor. Spawns the planning thread with Motion Planning for provided options.
+    explicit PlanningWatchdog(const MotionPlanningOptions& options, const WatchdogOptions& watchdog_options);
+
+    /// @brief Destructor. Stops and joins the planning thread.
+    ~PlanningWatchdog();
+
+    PlanningWatchdog(const PlanningWatchdog&) = delete;
+    PlanningWatchdog& operator=(const PlanningWatchdog&) = delete;
+
+    /// @brief Get Trajectory for provided DataSource within the response time
+    ///
+    /// @param data_source [in] - current frame (copied, i.e. may be updated once the call returned)
+    ///
+    /// @return Selected trajectory of Motion Planning or the fallback trajectory on overrun
+    Trajectory GetTrajectory(const DataSource& data_source);
+
+    /// @brief Previous path extended along the lane with velocity decelerating from the previous path end
+    Trajectory GetFallbackTrajectory(const IDataSource& data_source) const;
+
+    /// @brief Get watchdog counters
+    WatchdogStatistics GetStatistics();
+
+  private:
+    /// @brief Planning thread loop (plans each requested frame)
+    void Run();
+
+    /// @brief Watchdog options
+    const WatchdogOptions watchdog_options_;
+
+    /// @brief DataSource of the planner (copy of the requested frame)
+    DataSource data_source_;
+
+    /// @brief Motion Planning (used by the planning thread only)
+    std::unique_ptr<MotionPlanning> motion_planning_;
+
+    /// @brief Guards the request/result state and the counters
+    std::mutex mutex_;
+
+    /// @brief Signals requested frames (and stop) to the planning thread
+    std::condition_variable request_condition_;
+
+    /// @brief Signals planning results to the waiting caller
+    std::condition_variable result_condition_;
+
+    /// @brief Whether a frame was requested (and not yet started)
+    bool has_request_;
+
+    /// @brief Whether the planner is busy with a frame
+    bool is_busy_;
+
+    /// @brief Whether the caller is still waiting for the requested frame (otherwise its result is discarded)
+    bool is_waiting_;
+
+    /// @brief Whether the planning result of the requested frame is available
+    bool has_result_;
+
+    /// @brief Whether the planning thread is requested to stop
+    bool is_stopped_;
+
+    /// @brief Planning result (selected trajectory)
+    Trajectory result_;
+
+    /// @brief Completion time of the planning result
+    std::chrono::steady_clock::time_point result_time_;
+
+    /// @brief Watchdog counters
+    WatchdogStatistics statistics_;
+
+    /// @brief Planning thread
+    std::thread thread_;
+};
+
+/// @brief String Stream for Watchdog counters (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const WatchdogStatistics& statistics)
+{
+    return out << "Watchdog{frames: " << statistics.frames << ", overruns: " << statistics.overruns
+               << ", discarded_results: " << statistics.discarded_results << "}";
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_PLANNING_WATCHDOG_H
@@ -0,0 +1,175 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/polynomial_trajectory_optimizer.h"
+
+#include "planning/common/logging.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+#include "planning/motion_planning/maneuver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <sstream>
+
+namespace planning
+{
+namespace
+{
+/// @brief Lane width (in meters)
+constexpr double kLaneWidth{4.0};
+
+/// @brief Maneuver duration (in seconds) for given planning horizon
+inline double GetManeuverDuration(const units::length::meter_t horizon) noexcept
+{
+    return std::max(horizon.value() / kManeuverReferenceVelocity.value(), 1.0);
+}
+
+/// @brief Log optimized trajectories (verbose information)
+void LogOptimizedTrajectories(const Trajectories& optimized_trajectories)
+{
+    if (!IsInfoLogged())
+    {
+        return;
+    }
+
+    std::stringstream log_stream;
+    log_stream << "Optimized trajectories (Frenet polynomials): " << optimized_trajectories.size() << std::endl;
+    const auto n_logged = std::min(optimized_trajectories.size(), kMaxLoggedTrajectories);
+    std::for_each(optimized_trajectories.begin(),
+                  optimized_trajectories.begin() + n_logged,
+                  [&log_stream](const auto& trajectory) { log_stream << " (+) " << trajectory << std::endl; });
+    log_stream << " (+) ... (more " << optimized_trajectories.size() - n_logged << " trajectories)" << std::endl;
+    LOG(INFO) << log_stream.str();
+}
+}  // namespace
+
+PolynomialTrajectoryOptimizer::PolynomialTrajectoryOptimizer(const IDataSource& data_source)
+    : PolynomialTrajectoryOptimizer{data_source, {kDefaultManeuverHorizon}}
+{
+}
+
+PolynomialTrajectoryOptimizer::PolynomialTrajectoryOptimizer(const IDataSource& data_source,
+                                                             const std::vector<units::length::meter_t>& horizons)
+    : data_source_{data_source}, horizons_{horizons}, solvers_{}
+{
+    solvers_.reserve(horizons_.size());
+    std::transform(horizons_.begin(),
+                   horizons_.end(),
+                   std::back_inserter(solvers_),
+                   [](const auto horizon) { return FrenetPolynomialSolver{GetManeuverDuration(horizon)}; });
+}
+
+Trajectories PolynomialTrajectoryOptimizer::GetOptimizedTrajectories(const Trajectories& planned_trajectories) const
+{
+    auto optimized_trajectories = Trajectories{};
+    optimized_trajectories.reserve(planned_trajectories.size());
+
+    // query per frame inputs once for all trajectories
+    const auto start_state = GetFrenetStartState();
+    const auto map_coordinates = data_source_.GetMapCoordinates();
+
+    std::transform(planned_trajectories.begin(),
+                   planned_trajectories.end(),
+                   std::back_inserter(optimized_trajectories),
+                   [&](const auto& trajectory)
+                   { return GetOptimizedTrajectory(trajectory, start_state, map_coordinates); });
+
+    LogOptimizedTrajectories(optimized_trajectories);
+    return optimized_trajectories;
+}
+
+void PolynomialTrajectoryOptimizer::OptimizeTrajectories(Trajectories& trajectories) const
+{
+    // query per frame inputs once for all trajectories
+    const auto start_state = GetFrenetStartState();
+    const auto map_coordinates = data_source_.GetMapCoordinates();
+
+    std::for_each(trajectories.begin(),
+                  trajectories.end(),
+                  [&](auto& trajectory) { Optimize(start_state, map_coordinates, trajectory); });
+    LogOptimizedTrajectories(trajectories);
+}
+
+Trajectory PolynomialTrajectoryOptimizer::GetOptimizedTrajectory(const Trajectory& planned_trajectory) const
+{
+    return GetOptimizedTrajectory(planned_trajectory, GetFrenetStartState(), data_source_.GetMapCoordinates());
+}
+
+FrenetStartState PolynomialTrajectoryOptimizer::GetFrenetStartState() const
+{
+    const auto vehicle_dynamics = data_source_.GetVehicleDynamics();
+    const auto previous_path = data_source_.GetSharedPreviousPath();
+
+    FrenetStartState start_state{};
+    if (previous_path->size() < 2U)
+    {
+        start_state.longitudinal.position = vehicle_dynamics.frenet_coords.s;
+        start_state.longitudinal.velocity = vehicle_dynamics.velocity.value();
+        start_state.lateral.position = vehicle_dynamics.frenet_coords.d;
+    }
+    else
+    {
+        // previous path is consumed once per tick, hence its last segment gives the end velocity
+        const auto previous_path_end = data_source_.GetPreviousPathEnd();
+        const auto& last = previous_path->at(previous_path->size() - 1U);
+        const auto& second_last = previous_path->at(previous_path->size() - 2U);
+        start_state.longitudinal.position = previous_path_end.s;
+        start_state.longitudinal.velocity =
+            std::hypot(last.x - second_last.x, last.y - second_last.y) / kWaypointSamplingTime;
+        start_state.lateral.position = previous_path_end.d;
+    }
+    return start_state;
+}
+
+Trajectory PolynomialTrajectoryOptimizer::GetOptimizedTrajectory(const Trajectory& planned_trajectory,
+                                                                 const FrenetStartState& start_state,
+                                                                 const MapCoordinatesList& map_coordinates) const
+{
+    auto optimized_trajectory = planned_trajectory;
+    Optimize(start_state, map_coordinates, optimized_trajectory);
+    return optimized_trajectory;
+}
+
+void PolynomialTrajectoryOptimizer::Optimize(const FrenetStartState& start_state,
+                                             const MapCoordinatesList& map_coordinates,
+                                             Trajectory& trajectory) const
+{
+    // planned (anchor) waypoints are not needed, optimized waypoints continue the previous path
+    trajectory.waypoints.clear();
+    if (trajectory.previous_path == nullptr)
+    {
+        trajectory.previous_path = data_source_.GetSharedPreviousPath();
+    }
+    if (map_coordinates.size() < 2U)
+    {
+        return;
+    }
+
+    // reuse prepared solver for known horizons, otherwise factor boundary conditions for this trajectory only
+    const auto horizon = std::find(horizons_.begin(), horizons_.end(), trajectory.horizon);
+    const auto solver = (horizon != horizons_.end())
+                            ? solvers_[static_cast<std::size_t>(std::distance(horizons_.begin(), horizon))]
+                            : FrenetPolynomialSolver{GetManeuverDuration(trajectory.horizon)};
+
+    const auto global_lane = static_cast<double>(trajectory.global_lane_id);
+    const auto target_d = (trajectory.global_lane_id != GlobalLaneId::kInvalid)
+                              ? ((kLaneWidth * global_lane) + (kLaneWidth / 2.0))
+                              : start_state.lateral.position;
+    const auto longitudinal = solver.GetQuarticPolynomial(start_state.longitudinal, trajectory.velocity.value());
+    const auto lateral = solver.GetQuinticPolynomial(start_state.lateral, target_d);
+
+    const auto previous_path_size = GetPreviousPathSize(trajectory);
+    const auto n_waypoints = (previous_path_size < kTotalWaypoints) ? (kTotalWaypoints - previous_path_size) : 0U;
+    trajectory.waypoints.reserve(n_waypoints);
+
+    FrenetToGlobalConverter to_global{map_coordinates};
+    for (std::size_t idx = 1U; idx <= n_waypoints; ++idx)
+    {
+        const double t = static_cast<double>(idx) * kWaypointSamplingTime;
+        trajectory.waypoints.push_back(to_global(longitudinal(t).position, lateral(t).position));
+    }
+}
+}  // namespace planning
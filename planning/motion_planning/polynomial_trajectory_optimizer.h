@@ -0,0 +1,82 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_POLYNOMIAL_TRAJECTORY_OPTIMIZER_H
+#define PLANNING_MOTION_PLANNING_POLYNOMIAL_TRAJECTORY_OPTIMIZER_H
+
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/frenet_polynomial.h"
+#include "planning/motion_planning/i_trajectory_optimizer.h"
+
+#include <units.h>
+
+#include <vector>
+
+namespace planning
+{
+/// @brief Reference velocity converting the planning horizon (distance) to the maneuver duration (i.e. 30m => 3s)
+constexpr units::velocity::meters_per_second_t kManeuverReferenceVelocity{10.0};
+
+/// @brief Frenet start state (at the end of the previous path) shared by all trajectories of a frame
+struct FrenetStartState
+{
+    /// @brief Longitudinal state
+    FrenetState longitudinal{};
+
+    /// @brief Lateral state
+    FrenetState lateral{};
+};
+
+/// @brief Trajectory Optimizer generating jerk minimal trajectories in Frenet space.
+///
+/// @details Alternative to spline through anchor waypoints (TrajectoryOptimizer): longitudinal motion is a quartic
+/// polynomial reaching the trajectory's velocity, lateral motion is a quintic polynomial reaching the center of the
+/// trajectory's lane, both over the maneuver duration derived from the trajectory's horizon. Solvers (factored
+/// boundary conditions) are created once per horizon on construction and reused every frame.
+class PolynomialTrajectoryOptimizer : public ITrajectoryOptimizer
+{
+  public:
+    /// @brief Constructor. Initializes with provided DataSource and solvers for the default horizon
+    explicit PolynomialTrajectoryOptimizer(const IDataSource& data_source);
+
+    /// @brief Constructor. Initializes with provided DataSource and solvers for the provided horizons
+    explicit PolynomialTrajectoryOptimizer(const IDataSource& data_source,
+                                           const std::vector<units::length::meter_t>& horizons);
+
+    /// @brief Provide Optimized Trajectories set using Frenet Polynomials
+    Trajectories GetOptimizedTrajectories(const Trajectories& planned_trajectories) const override;
+
+    /// @brief Generate Trajectory waypoints with Frenet Polynomials for target velocity and lane
+    Trajectory GetOptimizedTrajectory(const Trajectory& planned_trajectory) const override;
+
+    /// @brief Replace the anchor waypoints of all planned trajectories with Frenet Polynomial waypoints (in place)
+    void OptimizeTrajectories(Trajectories& trajectories) const override;
+
+  private:
+    /// @brief Frenet state at the end of the previous path (i.e. where the new waypoints start)
+    FrenetStartState GetFrenetStartState() const;
+
+    /// @brief Generate Trajectory waypoints from given start state (using map)
+    Trajectory GetOptimizedTrajectory(const Trajectory& planned_trajectory,
+                                      const FrenetStartState& start_state,
+                                      const MapCoordinatesList& map_coordinates) const;
+
+    /// @brief Replace Trajectory waypoints with the ones generated from given start state (using map)
+    void Optimize(const FrenetStartState& start_state,
+                  const MapCoordinatesList& map_coordinates,
+                  Trajectory& trajectory) const;
+
+    /// @brief DataSource (contains information on VehicleDynamics, SensorFusion, Map Points etc.)
+    const IDataSource& data_source_;
+
+    /// @brief Planning horizons with prepared solvers (same order as solvers_)
+    std::vector<units::length::meter_t> horizons_;
+
+    /// @brief Prepared solvers (factored boundary conditions) for each horizon
+    std::vector<FrenetPolynomialSolver> solvers_;
+};
+
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_POLYNOMIAL_TRAJECTORY_OPTIMIZER_H
@@ -0,0 +1,103 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/prioritized_trajectories.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace planning
+{
+namespace
+{
+/// @brief Check lhs to have higher priority than rhs (ordering of the handles, top first)
+bool HasHigherPriority(const TrajectoryHandle& lhs, const TrajectoryHandle& rhs) noexcept
+{
+    return rhs > lhs;
+}
+}  // namespace
+
+PrioritizedTrajectories::PrioritizedTrajectories() : PrioritizedTrajectories{Trajectories{}, 1U} {}
+
+PrioritizedTrajectories::PrioritizedTrajectories(Trajectories trajectories, const std::size_t number_of_sorted)
+    : PrioritizedTrajectories{std::move(trajectories), number_of_sorted, nullptr}
+{
+}
+
+PrioritizedTrajectories::PrioritizedTrajectories(Trajectories trajectories,
+                                                 const std::size_t number_of_sorted,
+                                                 MonotonicArena* arena)
+    : trajectories_{std::move(trajectories)},
+      handles_{ArenaAllocator<TrajectoryHandle>{arena}},
+      number_of_sorted_{std::max(number_of_sorted, std::size_t{1U})},
+      top_{0U},
+      sorted_end_{0U}
+{
+    handles_.reserve(trajectories_.size());
+    for (std::size_t idx = 0U; idx < trajectories_.size(); ++idx)
+    {
+        handles_.push_back(TrajectoryHandle{trajectories_[idx].cost, trajectories_[idx].lane_id, idx});
+    }
+    SortNext();
+}
+
+const Trajectory& PrioritizedTrajectories::top() const
+{
+    return trajectories_[handles_[top_].index];
+}
+
+void PrioritizedTrajectories::pop()
+{
+    ++top_;
+    if (top_ == sorted_end_)
+    {
+        SortNext();
+    }
+}
+
+std::size_t PrioritizedTrajectories::size() const noexcept
+{
+    return handles_.size() - top_;
+}
+
+bool PrioritizedTrajectories::empty() const noexcept
+{
+    return top_ == handles_.size();
+}
+
+std::vector<TrajectoryHandle> PrioritizedTrajectories::GetOrderedHandles() const
+{
+    return std::vector<TrajectoryHandle>{handles_.begin() + static_cast<std::ptrdiff_t>(top_),
+                                         handles_.begin() + static_cast<std::ptrdiff_t>(sorted_end_)};
+}
+
+Trajectory PrioritizedTrajectories::TakeTop()
+{
+    return std::move(trajectories_[handles_[top_].index]);
+}
+
+Trajectories PrioritizedTrajectories::ReleaseTrajectories()
+{
+    handles_.clear();
+    top_ = 0U;
+    sorted_end_ = 0U;
+    return std::move(trajectories_);
+}
+
+void PrioritizedTrajectories::SortNext()
+{
+    const auto first = handles_.begin() + static_cast<std::ptrdiff_t>(sorted_end_);
+    const auto last = first + static_cast<std::ptrdiff_t>(std::min(number_of_sorted_, handles_.size() - sorted_end_));
+    if (first == last)
+    {
+        return;
+    }
+
+    // partition the next K handles in front of the remaining ones, then order only those K
+    std::nth_element(first, last - 1, handles_.end(), HasHigherPriority);
+    std::sort(first, last, HasHigherPriority);
+    sorted_end_ = static_cast<std::size_t>(last - handles_.begin());
+}
+
+}  // namespace planning
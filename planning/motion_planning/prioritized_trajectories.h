@@ -0,0 +1,101 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_PRIORITIZED_TRAJECTORIES_H
+#define PLANNING_MOTION_PLANNING_PRIORITIZED_TRAJECTORIES_H
+
+#include "planning/common/monotonic_arena.h"
+#include "planning/datatypes/trajectory.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+/// @brief Lightweight handle of a rated trajectory (priority key and index into the rated trajectories)
+struct TrajectoryHandle
+{
+    /// @brief Trajectory cost
+    double cost;
+
+    /// @brief Trajectory lane (breaks ties of equal costs)
+    LaneInformation::LaneId lane_id;
+
+    /// @brief Index of the trajectory within the rated trajectories (breaks remaining ties, first one wins)
+    std::size_t index;
+};
+
+/// @brief Check lhs to have lower priority than rhs (same order as operator> for Trajectory, then by index)
+inline bool operator>(const TrajectoryHandle& lhs, const TrajectoryHandle& rhs) noexcept
+{
+    // lane ids only differ if at least one of them is valid, hence the comparison matches operator> for Trajectory
+    return (lhs.cost > rhs.cost) ||
+           ((lhs.cost == rhs.cost) && ((lhs.lane_id < rhs.lane_id) ||
+                                       ((lhs.lane_id == rhs.lane_id) && (lhs.index > rhs.index))));
+}
+
+/// @brief Rated trajectories in order of priority (least cost first).
+///
+/// @details Owns the rated trajectories (moved in) and orders only lightweight handles, i.e. trajectories (with
+/// their waypoints) are never copied. Only the top K handles are ordered (nth_element followed by sorting the K
+/// best ones), further handles are ordered K at a time once popped beyond them. The top trajectory can be moved out.
+class PrioritizedTrajectories
+{
+  public:
+    /// @brief Default Constructor (no trajectories).
+    PrioritizedTrajectories();
+
+    /// @brief Constructor. Takes ownership of rated trajectories and orders the top number_of_sorted ones.
+    explicit PrioritizedTrajectories(Trajectories trajectories, const std::size_t number_of_sorted);
+
+    /// @brief Constructor. Takes ownership of rated trajectories and orders the top number_of_sorted ones, handles are
+    /// drawn from given arena (nullptr uses the heap, must outlive the prioritized trajectories).
+    explicit PrioritizedTrajectories(Trajectories trajectories,
+                                     const std::size_t number_of_sorted,
+                                     MonotonicArena* arena);
+
+    /// @brief Top priority trajectory (requires !empty())
+    const Trajectory& top() const;
+
+    /// @brief Remove top priority trajectory (requires !empty())
+    void pop();
+
+    /// @brief Number of remaining trajectories
+    std::size_t size() const noexcept;
+
+    /// @brief Check no trajectories to remain
+    bool empty() const noexcept;
+
+    /// @brief Remaining handles in order of priority (ordered ones only, i.e. up to number_of_sorted)
+    std::vector<TrajectoryHandle> GetOrderedHandles() const;
+
+    /// @brief Move top priority trajectory out (requires !empty(), top is left without waypoints)
+    Trajectory TakeTop();
+
+    /// @brief Move all the rated trajectories out (in order of rating), e.g. to reuse them as buffers of the next
+    /// frame. Leaves no trajectories.
+    Trajectories ReleaseTrajectories();
+
+  private:
+    /// @brief Order the next number_of_sorted_ handles after the current top
+    void SortNext();
+
+    /// @brief Rated trajectories (in order of rating)
+    Trajectories trajectories_;
+
+    /// @brief Handles of the rated trajectories, [top_, sorted_end_) in order of priority
+    ArenaVector<TrajectoryHandle> handles_;
+
+    /// @brief Number of handles ordered at once
+    std::size_t number_of_sorted_;
+
+    /// @brief Position of the top priority handle
+    std::size_t top_;
+
+    /// @brief End of the ordered handles
+    std::size_t sorted_end_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_PRIORITIZED_TRAJECTORIES_H
@@ -0,0 +1,70 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/replay_planning.h"
+
+#include "planning/common/logging.h"
+
+#include <chrono>
+
+namespace planning
+{
+ReplayPlanning::ReplayPlanning(const MotionPlanningOptions& options, const ReplayOptions& replay_options)
+    : drive_summaries_{}, planner_pool_{options, replay_options.number_of_threads}
+{
+}
+
+ReplaySummary ReplayPlanning::Replay(const std::vector<RecordedDrive>& drives)
+{
+    drive_summaries_.assign(drives.size(), ReplaySummary{});
+    planner_pool_.ForEach(drives.size(),
+                          [&](PooledPlanner& shard, const std::size_t drive)
+                          { ReplayDrive(drives[drive], shard, drive_summaries_[drive]); });
+
+    ReplaySummary summary{};
+    for (const auto& drive_summary : drive_summaries_)
+    {
+        summary.Merge(drive_summary);
+    }
+    LOG(INFO) << "Replayed " << drives.size() << " drives: " << summary;
+    return summary;
+}
+
+const std::vector<ReplaySummary>& ReplayPlanning::GetDriveSummaries() const
+{
+    return drive_summaries_;
+}
+
+std::size_t ReplayPlanning::GetNumberOfShards() const
+{
+    return planner_pool_.GetNumberOfPlanners();
+}
+
+void ReplayPlanning::ReplayDrive(const RecordedDrive& drive, PooledPlanner& shard, ReplaySummary& drive_summary)
+{
+    shard.motion_planning->Reset();
+    drive_summary.drives = 1U;
+
+    for (const auto& frame : drive)
+    {
+        shard.data_source = frame;
+
+        const auto start = std::chrono::steady_clock::now();
+        shard.motion_planning->GenerateTrajectories();
+        drive_summary.latency.Add(std::chrono::steady_clock::now() - start);
+
+        const auto selected_trajectory = shard.motion_planning->GetSelectedTrajectory();
+        ++drive_summary.frames;
+        drive_summary.velocity_sum += selected_trajectory.velocity.value();
+        if ((selected_trajectory.lane_id != LaneId::kEgo) && (selected_trajectory.lane_id != LaneId::kInvalid))
+        {
+            ++drive_summary.lane_change_frames;
+        }
+        if (selected_trajectory.waypoints.empty())
+        {
+            ++drive_summary.empty_frames;
+        }
+    }
+}
+}  // namespace planning
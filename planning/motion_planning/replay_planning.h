@@ -0,0 +1,118 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_REPLAY_PLANNING_H
+#define PLANNING_MOTION_PLANNING_REPLAY_PLANNING_H
+
+#include "planning/common/latency_histogram.h"
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning_options.h"
+#include "planning/motion_planning/planner_pool.h"
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace planning
+{
+/// @brief Recorded drive (consecutive frames in order of reception)
+using RecordedDrive = std::vector<DataSource>;
+
+/// @brief Replay KPIs of one or more drives (summaries of different drives are merged)
+struct ReplaySummary
+{
+    /// @brief Number of replayed drives
+    std::size_t drives{0U};
+
+    /// @brief Number of replayed frames
+    std::size_t frames{0U};
+
+    /// @brief Number of frames whose selected trajectory leaves the ego lane
+    std::size_t lane_change_frames{0U};
+
+    /// @brief Number of frames without selected waypoints (i.e. no trajectory was planned)
+    std::size_t empty_frames{0U};
+
+    /// @brief Sum of the selected velocities (in m/s)
+    double velocity_sum{0.0};
+
+    /// @brief Latency of each frame (GenerateTrajectories)
+    LatencyHistogram latency{};
+
+    /// @brief Ratio of lane change frames to all the frames (0 if nothing was replayed)
+    double GetLaneChangeRate() const noexcept
+    {
+        return (frames > 0U) ? (static_cast<double>(lane_change_frames) / static_cast<double>(frames)) : 0.0;
+    }
+
+    /// @brief Mean selected velocity (in m/s, 0 if nothing was replayed)
+    double GetMeanVelocity() const noexcept
+    {
+        return (frames > 0U) ? (velocity_sum / static_cast<double>(frames)) : 0.0;
+    }
+
+    /// @brief Add KPIs (and latencies) of given summary
+    void Merge(const ReplaySummary& other)
+    {
+        drives += other.drives;
+        frames += other.frames;
+        lane_change_frames += other.lane_change_frames;
+        empty_frames += other.empty_frames;
+        velocity_sum += other.velocity_sum;
+        latency.Merge(other.latency);
+    }
+};
+
+/// @brief Replay Planning. Replays recorded drives across worker threads (shards) and summarizes KPIs and latencies.
+///
+/// @details Drives are replayed on a Planner Pool, i.e. each shard owns a DataSource and a Motion Planning bound to it,
+/// reused for all the drives. A shard takes a whole drive, resets the state carried between frames (Motion Planning's
+/// Reset()) and plans its frames in order, i.e. stateful stages (e.g. Velocity Planner) see each drive as recorded.
+/// Every drive is summarized on its own, summaries are merged (in order of the drives) once all of them are replayed.
+///
+/// @note KPIs of each drive are independent of the number of threads and of the order of the drives (latencies are
+/// measured, hence they vary between replays).
+class ReplayPlanning
+{
+  public:
+    /// @brief Constructor. Initializes one Motion Planning per shard for provided options.
+    explicit ReplayPlanning(const MotionPlanningOptions& options, const ReplayOptions& replay_options);
+
+    ReplayPlanning(const ReplayPlanning&) = delete;
+    ReplayPlanning& operator=(const ReplayPlanning&) = delete;
+
+    /// @brief Replay all the provided drives
+    ///
+    /// @param drives [in] - recorded drives (independent of each other)
+    ///
+    /// @return Merged summary of all the drives
+    ReplaySummary Replay(const std::vector<RecordedDrive>& drives);
+
+    /// @brief Get summary of each drive of the last replay (ordered as drives)
+    const std::vector<ReplaySummary>& GetDriveSummaries() const;
+
+    /// @brief Get number of shards (each with its own Motion Planning)
+    std::size_t GetNumberOfShards() const;
+
+  private:
+    /// @brief Plan all the frames of given drive (in order) and summarize them
+    static void ReplayDrive(const RecordedDrive& drive, PooledPlanner& shard, ReplaySummary& drive_summary);
+
+    /// @brief Summary of each drive of the last replay
+    std::vector<ReplaySummary> drive_summaries_;
+
+    /// @brief Shards (one Motion Planning per thread)
+    PlannerPool planner_pool_;
+};
+
+/// @brief String Stream for Replay KPIs (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const ReplaySummary& summary)
+{
+    return out << "Replay{drives: " << summary.drives << ", frames: " << summary.frames
+               << ", lane_change_rate: " << summary.GetLaneChangeRate() << ", empty_frames: " << summary.empty_frames
+               << ", mean_velocity: " << summary.GetMeanVelocity() << ", " << summary.latency << "}";
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_REPLAY_PLANNING_H
@@ -0,0 +1,266 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/speculative_planning.h"
+
+#include "planning/common/logging.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <memory>
+
+namespace planning
+{
+namespace
+{
+/// @brief Frenet Coordinates of given position, projected on the closest map segment (inverse of
+/// FrenetToGlobalConverter, at least 2 map points)
+FrenetCoordinates GetFrenetCoordinates(const GlobalCoordinates& position, const MapCoordinatesList& map_coordinates)
+{
+    FrenetCoordinates frenet_coords{0.0, 0.0, 0.0, 0.0};
+    auto min_distance = std::numeric_limits<double>::max();
+    for (std::size_t segment = 0U; (segment + 1U) < map_coordinates.size(); ++segment)
+    {
+        const auto& start = map_coordinates[segment];
+        const auto& end = map_coordinates[segment + 1U];
+        const auto length = std::hypot(end.global_coords.x - start.global_coords.x,
+                                       end.global_coords.y - start.global_coords.y);
+        if (length <= 0.0)
+        {
+            continue;
+        }
+        const auto cos_heading = (end.global_coords.x - start.global_coords.x) / length;
+        const auto sin_heading = (end.global_coords.y - start.global_coords.y) / length;
+        const auto dx = position.x - start.global_coords.x;
+        const auto dy = position.y - start.global_coords.y;
+
+        // d is measured to the right of the driving direction
+        const auto segment_s = std::min(std::max((dx * cos_heading) + (dy * sin_heading), 0.0), length);
+        const auto d = (dx * sin_heading) - (dy * cos_heading);
+        const auto distance = std::hypot(dx - (segment_s * cos_heading), dy - (segment_s * sin_heading));
+        if (distance < min_distance)
+        {
+            min_distance = distance;
+            frenet_coords.s = start.frenet_coords.s + segment_s;
+            frenet_coords.d = d;
+        }
+    }
+    return frenet_coords;
+}
+
+/// @brief Check whether given positions are within tolerance
+inline bool IsNear(const GlobalCoordinates& lhs, const GlobalCoordinates& rhs, const double tolerance) noexcept
+{
+    return std::hypot(lhs.x - rhs.x, lhs.y - rhs.y) <= tolerance;
+}
+
+/// @brief Motion Planning options without incremental replanning (its state is not restored on a miss)
+inline MotionPlanningOptions GetSpeculativeOptions(const MotionPlanningOptions& options)
+{
+    auto speculative_options = options;
+    speculative_options.incremental_replanning = false;
+    return speculative_options;
+}
+
+/// @brief Check whether given Frenet positions are within tolerance
+inline bool IsNear(const FrenetCoordinates& lhs, const FrenetCoordinates& rhs, const double tolerance) noexcept
+{
+    return (std::abs(lhs.s - rhs.s) <= tolerance) && (std::abs(lhs.d - rhs.d) <= tolerance);
+}
+}  // namespace
+
+SpeculativePlanning::SpeculativePlanning(const MotionPlanningOptions& options,
+                                         const SpeculationOptions& speculation_options)
+    : speculation_options_{speculation_options},
+      data_source_{},
+      motion_planning_{std::make_unique<MotionPlanning>(data_source_, GetSpeculativeOptions(options))},
+      received_state_{motion_planning_->GetState()},
+      sent_waypoints_{0U},
+      consumed_waypoints_{0U},
+      statistics_{},
+      speculation_{},
+      thread_pool_{1U}
+{
+}
+
+SpeculativePlanning::~SpeculativePlanning()
+{
+    if (speculation_.valid())
+    {
+        speculation_.wait();
+    }
+}
+
+Trajectory SpeculativePlanning::GetTrajectory(const DataSource& data_source)
+{
+    ++statistics_.frames;
+
+    auto is_speculative = false;
+    if (speculation_.valid())
+    {
+        speculation_.get();
+        is_speculative = IsPredicted(data_source, data_source_, speculation_options_);
+        if (is_speculative)
+        {
+            ++statistics_.hits;
+        }
+        else
+        {
+            ++statistics_.misses;
+            LOG(INFO) << "Received frame deviates from predicted frame, planning again.";
+        }
+    }
+    if (!is_speculative)
+    {
+        // speculative frame advanced the state (e.g. target velocity), hence restore it for the received frame
+        motion_planning_->SetState(received_state_);
+        data_source_ = data_source;
+        motion_planning_->GenerateTrajectories();
+    }
+    received_state_ = motion_planning_->GetState();
+    auto trajectory = motion_planning_->GetSelectedTrajectory();
+
+    // simulator consumes the sent waypoints from the front, remaining ones are received as previous path
+    const auto previous_path_size = data_source.GetSharedPreviousPath()->size();
+    consumed_waypoints_ = (sent_waypoints_ > previous_path_size) ? (sent_waypoints_ - previous_path_size) : 0U;
+    sent_waypoints_ = GetPreviousPathSize(trajectory) + trajectory.waypoints.size();
+
+    Speculate(data_source, trajectory);
+    return trajectory;
+}
+
+DataSource SpeculativePlanning::GetPredictedDataSource(const DataSource& data_source,
+                                                       const Trajectory& sent_trajectory,
+                                                       const std::size_t consumed_waypoints)
+{
+    auto predicted_data_source = data_source;
+
+    PreviousPathGlobal sent_waypoints{};
+    ForEachWaypoint(sent_trajectory, [&sent_waypoints](const auto& waypoint) { sent_waypoints.push_back(waypoint); });
+    const auto map_coordinates = data_source.GetMapCoordinates();
+    if ((consumed_waypoints == 0U) || ((consumed_waypoints + 1U) >= sent_waypoints.size()) ||
+        (map_coordinates.size() < 2U))
+    {
+        return predicted_data_source;
+    }
+
+    // ego follows the sent waypoints (one per tick), remaining waypoints become previous path
+    const PreviousPathGlobal previous_path{sent_waypoints.begin() + static_cast<std::ptrdiff_t>(consumed_waypoints),
+                                           sent_waypoints.end()};
+    const auto& position = sent_waypoints[consumed_waypoints - 1U];
+    const auto& last_position = (consumed_waypoints > 1U) ? sent_waypoints[consumed_waypoints - 2U]
+                                                           : data_source.GetVehicleDynamics().global_coords;
+    const auto previous_path_end = GetFrenetCoordinates(previous_path.back(), map_coordinates);
+
+    VehicleDynamics vehicle_dynamics{};
+    vehicle_dynamics.global_coords = position;
+    vehicle_dynamics.frenet_coords = GetFrenetCoordinates(position, map_coordinates);
+    vehicle_dynamics.frenet_coords.s = previous_path_end.s;
+    vehicle_dynamics.velocity = units::velocity::meters_per_second_t{
+        std::hypot(position.x - last_position.x, position.y - last_position.y) / kWaypointSamplingTime};
+    vehicle_dynamics.yaw =
+        units::angle::radian_t{std::atan2(position.y - last_position.y, position.x - last_position.x)};
+
+    // objects keep their velocity along the lane
+    const auto elapsed_time = static_cast<double>(consumed_waypoints) * kWaypointSamplingTime;
+    auto sensor_fusion = data_source.GetSensorFusion();
+    for (auto& object : sensor_fusion.objs)
+    {
+        object.frenet_coords.s += object.velocity.value() * elapsed_time;
+        object.global_coords =
+            FrenetToGlobalConverter{map_coordinates}(object.frenet_coords.s, object.frenet_coords.d);
+    }
+
+    predicted_data_source.SetPreviousPath(previous_path);
+    predicted_data_source.SetPreviousPathEnd(previous_path_end);
+    predicted_data_source.SetVehicleDynamics(vehicle_dynamics);
+    predicted_data_source.SetSensorFusion(sensor_fusion);
+    return predicted_data_source;
+}
+
+bool SpeculativePlanning::IsPredicted(const IDataSource& data_source,
+                                      const IDataSource& predicted_data_source,
+                                      const SpeculationOptions& speculation_options)
+{
+    const auto position_tolerance = speculation_options.position_tolerance.value();
+    const auto velocity_tolerance = speculation_options.velocity_tolerance.value();
+
+    if ((data_source.GetSpeedLimit() != predicted_data_source.GetSpeedLimit()) ||
+        (data_source.GetMapCoordinates().size() != predicted_data_source.GetMapCoordinates().size()))
+    {
+        return false;
+    }
+
+    const auto previous_path = data_source.GetSharedPreviousPath();
+    const auto predicted_previous_path = predicted_data_source.GetSharedPreviousPath();
+    if (previous_path->size() != predicted_previous_path->size())
+    {
+        return false;
+    }
+    for (std::size_t idx = 0U; idx < previous_path->size(); ++idx)
+    {
+        if (!IsNear((*previous_path)[idx], (*predicted_previous_path)[idx], position_tolerance))
+        {
+            return false;
+        }
+    }
+    if (!previous_path->empty() &&
+        !IsNear(data_source.GetPreviousPathEnd(), predicted_data_source.GetPreviousPathEnd(), position_tolerance))
+    {
+        return false;
+    }
+
+    const auto vehicle_dynamics = data_source.GetVehicleDynamics();
+    const auto predicted_vehicle_dynamics = predicted_data_source.GetVehicleDynamics();
+    if (!IsNear(vehicle_dynamics.global_coords, predicted_vehicle_dynamics.global_coords, position_tolerance) ||
+        (units::math::abs(vehicle_dynamics.velocity - predicted_vehicle_dynamics.velocity).value() >
+         velocity_tolerance))
+    {
+        return false;
+    }
+
+    const auto objects = data_source.GetSensorFusion().objs;
+    const auto predicted_objects = predicted_data_source.GetSensorFusion().objs;
+    if (objects.size() != predicted_objects.size())
+    {
+        return false;
+    }
+    for (std::size_t idx = 0U; idx < objects.size(); ++idx)
+    {
+        const auto& object = objects[idx];
+        const auto& predicted_object = predicted_objects[idx];
+        if ((object.idx != predicted_object.idx) ||
+            !IsNear(object.frenet_coords, predicted_object.frenet_coords, position_tolerance) ||
+            (units::math::abs(object.velocity - predicted_object.velocity).value() > velocity_tolerance))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+SpeculationStatistics SpeculativePlanning::GetStatistics() const
+{
+    return statistics_;
+}
+
+void SpeculativePlanning::Speculate(const DataSource& data_source, const Trajectory& sent_trajectory)
+{
+    if ((consumed_waypoints_ == 0U) || ((consumed_waypoints_ + 1U) >= sent_waypoints_))
+    {
+        return;
+    }
+
+    // planner (and its DataSource) are used by the worker until the next frame is received
+    data_source_ = GetPredictedDataSource(data_source, sent_trajectory, consumed_waypoints_);
+    auto task = std::make_shared<std::packaged_task<void()>>([this] { motion_planning_->GenerateTrajectories(); });
+    speculation_ = task->get_future();
+    thread_pool_.Submit([task] { (*task)(); });
+    ++statistics_.speculations;
+}
+}  // namespace planning
@@ -0,0 +1,133 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_SPECULATIVE_PLANNING_H
+#define PLANNING_MOTION_PLANNING_SPECULATIVE_PLANNING_H
+
+#include "planning/common/thread_pool.h"
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <ostream>
+
+namespace planning
+{
+/// @brief Speculative Planning counters
+struct SpeculationStatistics
+{
+    /// @brief Number of received frames
+    std::size_t frames{0U};
+
+    /// @brief Number of frames pre-planned on the predicted frame
+    std::size_t speculations{0U};
+
+    /// @brief Number of frames answered with the speculative result (prediction within tolerance)
+    std::size_t hits{0U};
+
+    /// @brief Number of frames planned again (prediction out of tolerance)
+    std::size_t misses{0U};
+
+    /// @brief Ratio of hits to all speculations (0 if nothing was speculated)
+    double GetHitRate() const noexcept
+    {
+        return (speculations > 0U) ? (static_cast<double>(hits) / static_cast<double>(speculations)) : 0.0;
+    }
+};
+
+/// @brief Speculative Planning. Pre-plans the next frame between frames and plans on the critical path only if the
+/// received frame deviates from the predicted one.
+///
+/// @details Right after a trajectory is returned (i.e. sent), the next frame is predicted from it: the simulator
+/// consumes as many waypoints as during the last frame, ego moves to the last consumed waypoint and objects keep
+/// their velocity along the lane. Motion Planning runs on this predicted frame in a worker thread. Once the next frame
+/// is received, it is compared against the prediction (within SpeculationOptions) and the speculative result is
+/// returned if valid, otherwise the received frame is planned in the calling thread.
+///
+/// @note Motion Planning keeps its state across frames (e.g. target velocity ramp and object history). The state
+/// after each received frame is kept, hence a miss restores it before planning the received frame, i.e. the
+/// predicted frame leaves no trace. Incremental replanning is disabled (its state is not restored).
+class SpeculativePlanning
+{
+  public:
+    /// @brief Constructor. Initializes Motion Planning (with its own DataSource) for provided options.
+    explicit SpeculativePlanning(const MotionPlanningOptions& options, const SpeculationOptions& speculation_options);
+
+    /// @brief Destructor. Waits for the running speculation.
+    ~SpeculativePlanning();
+
+    SpeculativePlanning(const SpeculativePlanning&) = delete;
+    SpeculativePlanning& operator=(const SpeculativePlanning&) = delete;
+
+    /// @brief Get Trajectory for received frame (speculative result if valid), then speculate on the next frame
+    ///
+    /// @param data_source [in] - received frame (copied, i.e. may be updated once the call returned)
+    ///
+    /// @return Selected trajectory of Motion Planning
+    Trajectory GetTrajectory(const DataSource& data_source);
+
+    /// @brief Predict next frame after sending given trajectory for received frame
+    ///
+    /// @param data_source [in] - received frame
+    /// @param sent_trajectory [in] - trajectory sent for received frame (previous path followed by its waypoints)
+    /// @param consumed_waypoints [in] - number of waypoints consumed until the next frame (at least 1)
+    ///
+    /// @return Predicted frame
+    static DataSource GetPredictedDataSource(const DataSource& data_source,
+                                             const Trajectory& sent_trajectory,
+                                             const std::size_t consumed_waypoints);
+
+    /// @brief Check whether received frame matches predicted frame within provided tolerances
+    static bool IsPredicted(const IDataSource& data_source,
+                            const IDataSource& predicted_data_source,
+                            const SpeculationOptions& speculation_options);
+
+    /// @brief Get speculation counters
+    SpeculationStatistics GetStatistics() const;
+
+  private:
+    /// @brief Start pre-planning on the next frame (if the consumed waypoints are known)
+    void Speculate(const DataSource& data_source, const Trajectory& sent_trajectory);
+
+    /// @brief Speculation options
+    const SpeculationOptions speculation_options_;
+
+    /// @brief DataSource of Motion Planning (received or predicted frame)
+    DataSource data_source_;
+
+    /// @brief Motion Planning (used by one thread at a time)
+    std::unique_ptr<MotionPlanning> motion_planning_;
+
+    /// @brief State of Motion Planning after the last received frame (restored on a miss)
+    MotionPlanningState received_state_;
+
+    /// @brief Number of waypoints sent with the last trajectory (0 until the first trajectory is sent)
+    std::size_t sent_waypoints_;
+
+    /// @brief Number of waypoints consumed between the last two frames (0 if unknown)
+    std::size_t consumed_waypoints_;
+
+    /// @brief Speculation counters
+    SpeculationStatistics statistics_;
+
+    /// @brief Completion of the running speculation (invalid if nothing is speculated)
+    std::future<void> speculation_;
+
+    /// @brief Worker thread for speculations (destroyed first, i.e. finishes the running speculation)
+    ThreadPool thread_pool_;
+};
+
+/// @brief String Stream for Speculation counters (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const SpeculationStatistics& statistics)
+{
+    return out << "Speculation{frames: " << statistics.frames << ", speculations: " << statistics.speculations
+               << ", hits: " << statistics.hits << ", misses: " << statistics.misses << "}";
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_SPECULATIVE_PLANNING_H
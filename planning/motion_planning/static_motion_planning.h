@@ -0,0 +1,249 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_STATIC_MOTION_PLANNING_H
+#define PLANNING_MOTION_PLANNING_STATIC_MOTION_PLANNING_H
+
+#include "planning/common/monotonic_arena.h"
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/collision_checker.h"
+#include "planning/motion_planning/i_data_source.h"
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+#include "planning/motion_planning/maneuver.h"
+#include "planning/motion_planning/maneuver_generator.h"
+#include "planning/motion_planning/maneuver_pruner.h"
+#include "planning/motion_planning/motion_planning_options.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/occupancy_grid.h"
+#include "planning/motion_planning/polynomial_trajectory_optimizer.h"
+#include "planning/motion_planning/trajectory_evaluator.h"
+#include "planning/motion_planning/trajectory_optimizer.h"
+#include "planning/motion_planning/trajectory_planner.h"
+#include "planning/motion_planning/trajectory_prioritizer.h"
+#include "planning/motion_planning/trajectory_selector.h"
+#include "planning/motion_planning/velocity_planner.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace planning
+{
+namespace internal
+{
+/// @brief Create Maneuver Generator of given type for provided options (default constructed)
+template <typename ManeuverGeneratorT>
+ManeuverGeneratorT MakeManeuverGenerator(const MotionPlanningOptions& /* options */)
+{
+    return ManeuverGeneratorT{};
+}
+
+/// @brief Create Lattice Maneuver Generator for provided lattice options
+template <>
+inline LatticeManeuverGenerator MakeManeuverGenerator<LatticeManeuverGenerator>(const MotionPlanningOptions& options)
+{
+    return LatticeManeuverGenerator{options.lattice_options};
+}
+
+/// @brief Create Trajectory Optimizer of given type for provided DataSource and options
+template <typename TrajectoryOptimizerT>
+TrajectoryOptimizerT MakeTrajectoryOptimizer(const IDataSource& data_source,
+                                             const MotionPlanningOptions& /* options */)
+{
+    return TrajectoryOptimizerT{data_source};
+}
+
+/// @brief Create Frenet Polynomial Trajectory Optimizer with solvers for the default and all the lattice horizons
+template <>
+inline PolynomialTrajectoryOptimizer MakeTrajectoryOptimizer<PolynomialTrajectoryOptimizer>(
+    const IDataSource& data_source,
+    const MotionPlanningOptions& options)
+{
+    auto horizons = LatticeManeuverGenerator{options.lattice_options}.GetHorizons();
+    horizons.push_back(kDefaultManeuverHorizon);
+    return PolynomialTrajectoryOptimizer{data_source, horizons};
+}
+
+/// @brief Create Trajectory Evaluator options for provided options and collaborators (nullptr if not used)
+inline TrajectoryEvaluatorOptions MakeTrajectoryEvaluatorOptions(const MotionPlanningOptions& options,
+                                                                 const ICollisionChecker* collision_checker,
+                                                                 const IOccupancyGrid* occupancy_grid,
+                                                                 MonotonicArena* arena)
+{
+    TrajectoryEvaluatorOptions evaluator_options{};
+    evaluator_options.collision_checker = collision_checker;
+    evaluator_options.occupancy_grid = occupancy_grid;
+    evaluator_options.cost_options = options.cost_options;
+    evaluator_options.evaluation_type = options.evaluation_type;
+    evaluator_options.arena = arena;
+    return evaluator_options;
+}
+}  // namespace internal
+
+/// @brief Motion Planning composed of concrete stages at compile time.
+///
+/// @details Same serial pipeline as MotionPlanning (number_of_threads = 0), but each stage is held by value with its
+/// concrete type, hence all stage calls are resolved (and can be inlined) at compile time without heap indirection.
+/// MotionPlanning (stages behind interfaces) remains the variant to inject mocks or select stages at runtime.
+///
+/// @note Maneuver Generator and Trajectory Optimizer are given by the template arguments (maneuver_generator_type
+/// and trajectory_optimizer_type options are ignored). Thread pool and incremental replanning are not supported.
+///
+/// @tparam VelocityPlannerT - constructible from (IDataSource, IObjectPredictor)
+/// @tparam ManeuverGeneratorT - default constructible (or LatticeManeuverGenerator, built from lattice options)
+/// @tparam TrajectoryPlannerT - constructible from (IDataSource), provides PlanTrajectories
+/// @tparam TrajectoryOptimizerT - constructible from (IDataSource) (or PolynomialTrajectoryOptimizer), provides
+/// OptimizeTrajectories
+/// @tparam TrajectoryEvaluatorT - constructible from (IDataSource, IObjectPredictor, TrajectoryEvaluatorOptions),
+/// provides GetLaneEvaluation and RateTrajectories (with evaluated lanes)
+/// @tparam TrajectoryPrioritizerT - constructible from (number_of_sorted, arena)
+/// @tparam TrajectorySelectorT - default constructible, provides SelectTrajectory
+template <typename VelocityPlannerT = VelocityPlanner,
+          typename ManeuverGeneratorT = ManeuverGenerator,
+          typename TrajectoryPlannerT = TrajectoryPlanner,
+          typename TrajectoryOptimizerT = TrajectoryOptimizer,
+          typename TrajectoryEvaluatorT = TrajectoryEvaluator,
+          typename TrajectoryPrioritizerT = TrajectoryPrioritizer,
+          typename TrajectorySelectorT = TrajectorySelector>
+class StaticMotionPlanning
+{
+  public:
+    /// @brief Constructor. Initialize Motion Planner with DataSource instance
+    explicit StaticMotionPlanning(const IDataSource& data_source)
+        : StaticMotionPlanning{data_source, MotionPlanningOptions{}}
+    {
+    }
+
+    /// @brief Constructor. Initialize Motion Planner with DataSource instance and provided options
+    explicit StaticMotionPlanning(const IDataSource& data_source, const MotionPlanningOptions& options)
+        : frame_arena_{options.frame_arena_capacity},
+          object_predictor_{data_source, options.prediction_options},
+          collision_checker_{options.collision_checking
+                                 ? std::make_unique<CollisionChecker>(
+                                       data_source, object_predictor_, options.collision_checker_options)
+                                 : nullptr},
+          occupancy_grid_{(options.occupancy_evaluation_type == OccupancyEvaluationType::kOccupancyGrid)
+                              ? std::make_unique<OccupancyGrid>(data_source,
+                                                                object_predictor_,
+                                                                options.occupancy_grid_options,
+                                                                options.collision_checker_options)
+                              : nullptr},
+          velocity_planner_{data_source, object_predictor_},
+          maneuver_generator_{internal::MakeManeuverGenerator<ManeuverGeneratorT>(options)},
+          maneuver_pruner_{data_source},
+          trajectory_planner_{data_source},
+          trajectory_optimizer_{internal::MakeTrajectoryOptimizer<TrajectoryOptimizerT>(data_source, options)},
+          trajectory_evaluator_{data_source,
+                                object_predictor_,
+                                internal::MakeTrajectoryEvaluatorOptions(
+                                    options, collision_checker_.get(), occupancy_grid_.get(), &frame_arena_)},
+          trajectory_prioritizer_{kMaxLoggedTrajectories, &frame_arena_},
+          trajectory_selector_{},
+          evaluation_statistics_{},
+          candidates_{},
+          selected_trajectory_{}
+    {
+    }
+
+    /// @note Stages refer to each other (and to the arena), hence the planner is neither copied nor moved.
+    StaticMotionPlanning(const StaticMotionPlanning&) = delete;
+    StaticMotionPlanning& operator=(const StaticMotionPlanning&) = delete;
+
+    /// @brief Generate Trajectories based on the provided DataSource (i.e. Environment)
+    void GenerateTrajectories()
+    {
+        // release scratch buffers of the previous frame at once (chunks are retained)
+        frame_arena_.Reset();
+
+        object_predictor_.PredictObjects();
+        if (collision_checker_ != nullptr)
+        {
+            collision_checker_->Update();
+        }
+        if (occupancy_grid_ != nullptr)
+        {
+            occupancy_grid_->Update();
+        }
+
+        velocity_planner_.CalculateTargetVelocity();
+
+        const auto target_velocity = velocity_planner_.GetTargetVelocity();
+
+        // evaluate lanes once per frame, shared by the pruner and all candidates
+        const auto lane_evaluation = trajectory_evaluator_.GetLaneEvaluation();
+
+        // reject maneuvers with invalid or blocked target lane before any waypoint or spline is computed
+        const auto maneuvers = maneuver_pruner_.Prune(maneuver_generator_.Generate(target_velocity), lane_evaluation);
+
+        // stages transform the candidates in place, buffers (and their waypoints) persist across frames
+        trajectory_planner_.PlanTrajectories(maneuvers, candidates_);
+        trajectory_optimizer_.OptimizeTrajectories(candidates_);
+        trajectory_evaluator_.RateTrajectories(candidates_, lane_evaluation, evaluation_statistics_);
+
+        auto prioritized_trajectories = trajectory_prioritizer_.GetPrioritizedTrajectories(std::move(candidates_));
+        trajectory_selector_.SelectTrajectory(prioritized_trajectories, selected_trajectory_);
+        candidates_ = prioritized_trajectories.ReleaseTrajectories();
+    }
+
+    /// @brief Get Selected Trajectory from Trajectory Selector
+    Trajectory GetSelectedTrajectory() const { return selected_trajectory_; }
+
+    /// @brief Get counters of maneuvers rejected before planning (all the frames)
+    ManeuverPruningStatistics GetManeuverPruningStatistics() const { return maneuver_pruner_.GetStatistics(); }
+
+    /// @brief Get per frame arena (usage of the last frame and retained capacity)
+    const MonotonicArena& GetFrameArena() const { return frame_arena_; }
+
+    /// @brief Get evaluation counters of all the frames (pruned candidates with EvaluationType::kBranchAndBound)
+    EvaluationStatistics GetEvaluationStatistics() const { return evaluation_statistics_; }
+
+  private:
+    /// @brief Per frame arena (scratch buffers of the serial stages, reset in O(1) at the start of each frame)
+    MonotonicArena frame_arena_;
+
+    /// @brief Object Predictor (runs once per frame, shared by Velocity Planner and Trajectory Evaluator)
+    ObjectPredictor object_predictor_;
+
+    /// @brief Collision Checker (updated once per frame, nullptr if collision checking is disabled)
+    std::unique_ptr<CollisionChecker> collision_checker_;
+
+    /// @brief Occupancy Grid (updated once per frame, nullptr if lane level occupancy is evaluated)
+    std::unique_ptr<OccupancyGrid> occupancy_grid_;
+
+    /// @brief Velocity Planner
+    VelocityPlannerT velocity_planner_;
+
+    /// @brief Maneuver Generator
+    ManeuverGeneratorT maneuver_generator_;
+
+    /// @brief Maneuver Pruner (rejects invalid or blocked maneuvers before planning)
+    ManeuverPruner maneuver_pruner_;
+
+    /// @brief Trajectory Planner
+    TrajectoryPlannerT trajectory_planner_;
+
+    /// @brief Trajectory Optimizer
+    TrajectoryOptimizerT trajectory_optimizer_;
+
+    /// @brief Trajectory Evaluator
+    TrajectoryEvaluatorT trajectory_evaluator_;
+
+    /// @brief Trajectory Prioritizer
+    TrajectoryPrioritizerT trajectory_prioritizer_;
+
+    /// @brief Trajectory Selector
+    TrajectorySelectorT trajectory_selector_;
+
+    /// @brief Evaluation counters (accumulated over all the frames)
+    EvaluationStatistics evaluation_statistics_;
+
+    /// @brief Candidates buffer (planned, optimized and rated in place), reused across frames
+    Trajectories candidates_;
+
+    /// @brief Selected Trajectory
+    Trajectory selected_trajectory_;
+};
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_STATIC_MOTION_PLANNING_H
@@ -0,0 +1,106 @@
+///
+/// @file
+/// @brief Contains unit tests for Arc Length Resampler.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/fixed_size_spline.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <units.h>
+
+#include <cmath>
+
+namespace planning
+{
+namespace
+{
+using Waypoints = std::array<GlobalCoordinates, kTotalWaypoints>;
+
+class ArcLengthResamplerFixture : public ::testing::TestWithParam<double>
+{
+  protected:
+    const GlobalCoordinates position_{10.0, 20.0};
+    const units::angle::radian_t yaw_{0.3};
+};
+
+INSTANTIATE_TEST_SUITE_P(ArcLengthResampler, ArcLengthResamplerFixture, ::testing::Values(1.0, 10.0, 22.0));
+
+TEST_P(ArcLengthResamplerFixture, ResampleByArcLength_GivenStraightCurve_ExpectEquidistantWaypoints)
+{
+    // Given
+    const auto velocity = GetParam();
+    const auto curve = [](const double) { return 0.0; };
+    VelocityProfile velocity_profile{};
+    velocity_profile.fill(velocity);
+
+    // When
+    Waypoints actual{};
+    ResampleByArcLength(curve, velocity_profile, kTotalWaypoints, position_, yaw_, actual);
+
+    // Then
+    auto previous = position_;
+    for (const auto& waypoint : actual)
+    {
+        const auto distance = std::hypot(waypoint.x - previous.x, waypoint.y - previous.y);
+        EXPECT_NEAR(distance, velocity * kWaypointSamplingTime, 1e-9);
+        previous = waypoint;
+    }
+}
+
+TEST_P(ArcLengthResamplerFixture, ResampleByArcLength_GivenLaneChangeCurve_ExpectExactDistancePerTick)
+{
+    // Given
+    const auto velocity = GetParam();
+    const FixedSizeSpline<5U> curve{{-1.0, 0.0, 10.0, 20.0, 30.0}, {0.0, 0.0, 2.0, 4.0, 4.0}};
+    VelocityProfile velocity_profile{};
+    velocity_profile.fill(velocity);
+
+    // When
+    Waypoints actual{};
+    ResampleByArcLength(curve, velocity_profile, kTotalWaypoints, position_, yaw_, actual);
+
+    // Then
+    auto previous = position_;
+    for (const auto& waypoint : actual)
+    {
+        const auto distance = std::hypot(waypoint.x - previous.x, waypoint.y - previous.y);
+        EXPECT_NEAR(distance, velocity * kWaypointSamplingTime, 1e-3);
+        previous = waypoint;
+    }
+}
+
+TEST(ArcLengthResamplerTest, ResampleByArcLength_GivenCount_ExpectOnlyRequestedWaypoints)
+{
+    // Given
+    const auto curve = [](const double) { return 0.0; };
+    VelocityProfile velocity_profile{};
+    velocity_profile.fill(10.0);
+    const std::size_t count = 3U;
+
+    // When
+    Waypoints actual{};
+    const auto position = GlobalCoordinates{0.0, 0.0};
+    const auto yaw = units::angle::radian_t{0.0};
+    ResampleByArcLength(curve, velocity_profile, count, position, yaw, actual);
+
+    // Then
+    EXPECT_DOUBLE_EQ(actual[count - 1U].x, 0.6);
+    EXPECT_DOUBLE_EQ(actual[count].x, 0.0);
+}
+
+TEST(ArcLengthTableTest, GetLength_GivenStraightCurve_ExpectLengthOfTable)
+{
+    // Given
+    ArcLengthTable<8U> table{};
+
+    // When
+    table.Build([](const double x) { return x; }, 3.0);
+
+    // Then
+    EXPECT_NEAR(table.GetLength(), 3.0 * std::sqrt(2.0), 1e-12);
+}
+
+}  // namespace
+}  // namespace planning
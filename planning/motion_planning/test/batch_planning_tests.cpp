@@ -0,0 +1,128 @@
+///
+/// @file
+/// @brief Contains unit tests for Batch Planning.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/batch_planning.h"
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+class BatchPlanningFixture_WithNumberOfThreads : public ::testing::TestWithParam<std::size_t>
+{
+  public:
+    BatchPlanningFixture_WithNumberOfThreads() : options_{}, batch_options_{}, data_sources_{}
+    {
+        options_.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+        options_.collision_checking = true;
+        batch_options_.number_of_threads = GetParam();
+
+        // unrelated frames, i.e. each ego lane with a slower object in each lane at different distances
+        for (const auto ego_lane : {GlobalLaneId::kLeft, GlobalLaneId::kCenter, GlobalLaneId::kRight})
+        {
+            for (const auto object_lane : {GlobalLaneId::kLeft, GlobalLaneId::kCenter, GlobalLaneId::kRight})
+            {
+                for (const auto distance : {24.0, 200.0})
+                {
+                    data_sources_.push_back(
+                        DataSourceBuilder()
+                            .WithPreviousPath(PreviousPathGlobal{})
+                            .WithMapCoordinates(kHighwayMap)
+                            .WithDistance(units::length::meter_t{distance})
+                            .WithGlobalLaneId(ego_lane)
+                            .WithObjectInLane(object_lane, units::velocity::meters_per_second_t{10.0})
+                            .Build());
+                }
+            }
+        }
+    }
+
+  protected:
+    /// @brief Selected trajectory of a freshly constructed Motion Planning for each frame
+    std::vector<Trajectory> GetExpectedTrajectories(const std::vector<DataSource>& data_sources) const
+    {
+        std::vector<Trajectory> expected{};
+        for (const auto& data_source : data_sources)
+        {
+            auto motion_planning = MotionPlanning{data_source, options_};
+            motion_planning.GenerateTrajectories();
+            expected.push_back(motion_planning.GetSelectedTrajectory());
+        }
+        return expected;
+    }
+
+    MotionPlanningOptions options_;
+    BatchPlanningOptions batch_options_;
+    std::vector<DataSource> data_sources_;
+};
+
+INSTANTIATE_TEST_SUITE_P(BatchPlanning, BatchPlanningFixture_WithNumberOfThreads, ::testing::Values(0U, 1U, 4U));
+
+TEST_P(BatchPlanningFixture_WithNumberOfThreads, GetSelectedTrajectories_GivenFrames_ExpectSameAsIndependentPlanning)
+{
+    // Given
+    BatchPlanning batch_planning{options_, batch_options_};
+
+    // When
+    const auto actual = batch_planning.GetSelectedTrajectories(data_sources_);
+
+    // Then
+    const auto expected = GetExpectedTrajectories(data_sources_);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t frame = 0U; frame < actual.size(); ++frame)
+    {
+        EXPECT_EQ(actual[frame].unique_id, expected[frame].unique_id) << "frame: " << frame;
+        EXPECT_DOUBLE_EQ(actual[frame].cost, expected[frame].cost) << "frame: " << frame;
+        EXPECT_EQ(actual[frame].waypoints.size(), expected[frame].waypoints.size()) << "frame: " << frame;
+    }
+}
+
+TEST_P(BatchPlanningFixture_WithNumberOfThreads, GetSelectedTrajectories_GivenReversedFrames_ExpectReversedResult)
+{
+    // Given
+    BatchPlanning batch_planning{options_, batch_options_};
+    const auto expected = batch_planning.GetSelectedTrajectories(data_sources_);
+    std::reverse(data_sources_.begin(), data_sources_.end());
+
+    // When
+    auto actual = batch_planning.GetSelectedTrajectories(data_sources_);
+
+    // Then
+    std::reverse(actual.begin(), actual.end());
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t frame = 0U; frame < actual.size(); ++frame)
+    {
+        EXPECT_EQ(actual[frame].unique_id, expected[frame].unique_id) << "frame: " << frame;
+        EXPECT_DOUBLE_EQ(actual[frame].cost, expected[frame].cost) << "frame: " << frame;
+    }
+    const auto statistics = batch_planning.GetStatistics();
+    EXPECT_EQ(statistics.batches, 2U);
+    EXPECT_EQ(statistics.frames, 2U * data_sources_.size());
+}
+
+TEST_P(BatchPlanningFixture_WithNumberOfThreads, GetSelectedTrajectories_GivenEmptyBatch_ExpectEmptyResult)
+{
+    // Given
+    BatchPlanning batch_planning{options_, batch_options_};
+
+    // When
+    const auto actual = batch_planning.GetSelectedTrajectories(std::vector<DataSource>{});
+
+    // Then
+    EXPECT_TRUE(actual.empty());
+    EXPECT_EQ(batch_planning.GetNumberOfWorkers(), std::max(GetParam(), std::size_t{1U}));
+}
+
+}  // namespace
+}  // namespace planning
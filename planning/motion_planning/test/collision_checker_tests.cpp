@@ -0,0 +1,166 @@
+///
+/// @file
+/// @brief Contains unit tests for Collision Checker.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/collision_checker.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/builders/object_fusion_builder.h"
+#include "planning/motion_planning/test/support/builders/sensor_fusion_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <units.h>
+
+namespace planning
+{
+namespace
+{
+/// @brief Ego longitudinal position (in meters)
+constexpr double kEgoPosition{200.0};
+
+/// @brief Ego lateral position (in meters, center lane)
+constexpr double kEgoLane{6.0};
+
+/// @brief Trajectory along the lane at constant velocity (one waypoint per tick, without previous path)
+Trajectory GetTrajectory(const double velocity)
+{
+    Trajectory trajectory{};
+    FrenetToGlobalConverter to_global{kHighwayMap};
+    for (std::size_t tick = 1U; tick <= 50U; ++tick)
+    {
+        const auto s = kEgoPosition + (velocity * 0.02 * static_cast<double>(tick));
+        trajectory.waypoints.push_back(to_global(s, kEgoLane));
+    }
+    return trajectory;
+}
+
+/// @brief DataSource with given objects on the highway map (ego at kEgoPosition)
+DataSource GetDataSource(const SensorFusion& sensor_fusion)
+{
+    return DataSourceBuilder()
+        .WithPreviousPath(PreviousPathGlobal{})
+        .WithMapCoordinates(kHighwayMap)
+        .WithFrenetCoordinates(FrenetCoordinates{kEgoPosition, kEgoLane, 0.0, 0.0})
+        .WithSensorFusion(sensor_fusion)
+        .Build();
+}
+
+struct TestCollisionParam
+{
+    // Given
+    double object_distance;
+    double object_lane;
+    double object_velocity;
+
+    // Then
+    bool is_collision_free;
+};
+
+class CollisionCheckerFixture : public ::testing::TestWithParam<TestCollisionParam>
+{
+};
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(
+    CollisionChecker,
+    CollisionCheckerFixture,
+    ::testing::Values(
+        //                 object_distance, object_lane, object_velocity, (expected) is_collision_free?
+        TestCollisionParam{           10.0,         6.0,             0.0,                         false},  // stopped
+        TestCollisionParam{           10.0,         6.0,            20.0,                          true},  // ahead
+        TestCollisionParam{           30.0,         6.0,             0.0,                          true},  // too far
+        TestCollisionParam{          -10.0,         6.0,            40.0,                         false},  // overtaking
+        TestCollisionParam{          -10.0,         6.0,            20.0,                          true},  // behind
+        TestCollisionParam{            0.0,         2.0,            20.0,                          true},  // left
+        TestCollisionParam{            0.0,        10.0,            20.0,                          true},  // right
+        TestCollisionParam{            5.0,         8.0,            20.0,                         false}   // cut in
+));
+// clang-format on
+
+TEST_P(CollisionCheckerFixture, IsCollisionFree_GivenPredictedObject_ExpectCollisionAtWaypointTimestamps)
+{
+    // Given
+    const auto param = GetParam();
+    const auto data_source = GetDataSource(
+        SensorFusionBuilder()
+            .WithObjectFusion(ObjectFusionBuilder()
+                                  .WithIndex(1)
+                                  .WithFrenetCoordinates({kEgoPosition + param.object_distance, param.object_lane})
+                                  .WithVelocity(units::velocity::meters_per_second_t{param.object_velocity})
+                                  .Build())
+            .Build());
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    CollisionChecker collision_checker{data_source, object_predictor};
+    collision_checker.Update();
+
+    // When
+    const auto is_collision_free = collision_checker.IsCollisionFree(GetTrajectory(20.0));
+
+    // Then
+    EXPECT_EQ(is_collision_free, param.is_collision_free);
+}
+
+TEST(CollisionCheckerTest, IsCollisionFree_GivenManyObjects_ExpectOnlyOverlappingObjectDetected)
+{
+    // Given (objects in all lanes, except the one stopped in ego lane, keep their distance)
+    SensorFusionBuilder sensor_fusion_builder{};
+    for (std::int32_t idx = 0; idx < 60; ++idx)
+    {
+        const auto lane = 2.0 + (4.0 * static_cast<double>(idx % 3));
+        const auto distance = -150.0 + (5.0 * static_cast<double>(idx));
+        const auto is_ego_lane = (lane == kEgoLane);
+        sensor_fusion_builder.WithObjectFusion(
+            ObjectFusionBuilder()
+                .WithIndex(idx)
+                .WithFrenetCoordinates({kEgoPosition + distance + (is_ego_lane ? 200.0 : 0.0), lane})
+                .WithVelocity(units::velocity::meters_per_second_t{20.0})
+                .Build());
+    }
+    auto data_source = GetDataSource(sensor_fusion_builder.Build());
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    CollisionChecker collision_checker{data_source, object_predictor};
+    collision_checker.Update();
+    const auto is_collision_free = collision_checker.IsCollisionFree(GetTrajectory(20.0));
+
+    // When
+    sensor_fusion_builder.WithObjectFusion(ObjectFusionBuilder()
+                                               .WithIndex(60)
+                                               .WithFrenetCoordinates({kEgoPosition + 15.0, kEgoLane})
+                                               .WithVelocity(units::velocity::meters_per_second_t{0.0})
+                                               .Build());
+    data_source.SetSensorFusion(sensor_fusion_builder.Build());
+    object_predictor.PredictObjects();
+    collision_checker.Update();
+
+    // Then
+    EXPECT_TRUE(is_collision_free);
+    EXPECT_FALSE(collision_checker.IsCollisionFree(GetTrajectory(20.0)));
+}
+
+TEST(CollisionCheckerTest, IsCollisionFree_GivenNoMap_ExpectCollisionFree)
+{
+    // Given
+    const auto data_source = DataSourceBuilder()
+                                 .WithPreviousPath(PreviousPathGlobal{})
+                                 .WithMapCoordinates(MapCoordinatesList{})
+                                 .WithObjectInLane(GlobalLaneId::kCenter, units::velocity::meters_per_second_t{0.0})
+                                 .Build();
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    CollisionChecker collision_checker{data_source, object_predictor};
+
+    // When
+    collision_checker.Update();
+
+    // Then
+    EXPECT_TRUE(collision_checker.IsCollisionFree(GetTrajectory(20.0)));
+}
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,94 @@
+///
+/// @file
+/// @brief Contains unit tests for Fixed Size Spline.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/fixed_size_spline.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <spline.h>
+
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+constexpr std::size_t kNumberOfPoints{5U};
+using Points = FixedSizeSpline<kNumberOfPoints>::Points;
+
+struct TestSplineParam
+{
+    // Given
+    Points x;
+    Points y;
+};
+
+class FixedSizeSplineFixture : public ::testing::TestWithParam<TestSplineParam>
+{
+};
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(
+    FixedSizeSpline,
+    FixedSizeSplineFixture,
+    ::testing::Values(
+        //              x                                  , y
+        TestSplineParam{Points{-1.0, 0.0, 30.0, 60.0, 90.0}, Points{0.0, 0.0, 0.0, 0.0, 0.0}},
+        TestSplineParam{Points{-1.0, 0.0, 30.0, 60.0, 90.0}, Points{-0.1, 0.0, 2.0, 4.0, 4.0}},
+        TestSplineParam{Points{-1.0, 0.0, 30.0, 60.0, 90.0}, Points{0.1, 0.0, -4.0, -7.5, -8.0}},
+        TestSplineParam{Points{-0.4, 0.0, 29.5, 59.8, 91.2}, Points{0.05, 0.0, 1.5, -2.5, 3.0}},
+        TestSplineParam{Points{0.0, 1.0, 2.0, 3.0, 4.0}, Points{0.0, 1.0, 0.0, 1.0, 0.0}}));
+// clang-format on
+
+TEST_P(FixedSizeSplineFixture, Evaluate_GivenTypicalControlPoints_ExpectSameResultAsDynamicSpline)
+{
+    // Given
+    const auto param = GetParam();
+    tk::spline expected_spline;
+    expected_spline.set_points(std::vector<double>{param.x.begin(), param.x.end()},
+                               std::vector<double>{param.y.begin(), param.y.end()});
+
+    // When
+    const FixedSizeSpline<kNumberOfPoints> actual_spline{param.x, param.y};
+
+    // Then
+    const auto lower = param.x.front() - 10.0;
+    const auto upper = param.x.back() + 10.0;
+    for (auto x = lower; x <= upper; x += 0.25)
+    {
+        EXPECT_NEAR(actual_spline(x), expected_spline(x), 1e-9) << "x: " << x;
+    }
+}
+
+TEST_P(FixedSizeSplineFixture, Evaluate_GivenControlPoints_ExpectSplineThroughControlPoints)
+{
+    // Given
+    const auto param = GetParam();
+
+    // When
+    const FixedSizeSpline<kNumberOfPoints> spline{param.x, param.y};
+
+    // Then
+    for (std::size_t idx = 0U; idx < kNumberOfPoints; ++idx)
+    {
+        EXPECT_NEAR(spline(param.x[idx]), param.y[idx], 1e-9);
+    }
+}
+
+TEST(FixedSizeSplineTest, SetPoints_GivenPreviouslyInitializedSpline_ExpectUpdatedSpline)
+{
+    // Given
+    FixedSizeSpline<3U> spline{{0.0, 1.0, 2.0}, {0.0, 1.0, 2.0}};
+
+    // When
+    spline.SetPoints({0.0, 1.0, 2.0}, {2.0, 2.0, 2.0});
+
+    // Then
+    EXPECT_DOUBLE_EQ(spline(0.5), 2.0);
+    EXPECT_DOUBLE_EQ(spline(5.0), 2.0);
+}
+
+}  // namespace
+}  // namespace planning
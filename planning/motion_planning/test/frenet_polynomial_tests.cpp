@@ -0,0 +1,80 @@
+///
+/// @file
+/// @brief Contains unit tests for Frenet Polynomials.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/frenet_polynomial.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace planning
+{
+namespace
+{
+constexpr double kTolerance{1e-9};
+
+class FrenetPolynomialSolverFixture : public ::testing::TestWithParam<double>
+{
+  protected:
+    const FrenetState start_{10.0, 15.0, 0.5};
+};
+
+INSTANTIATE_TEST_SUITE_P(FrenetPolynomial, FrenetPolynomialSolverFixture, ::testing::Values(1.0, 3.0, 4.5, 6.0));
+
+TEST_P(FrenetPolynomialSolverFixture, GetQuinticPolynomial_GivenEndPosition_ExpectBoundaryConditions)
+{
+    // Given
+    const auto duration = GetParam();
+    const auto unit = FrenetPolynomialSolver{duration};
+
+    // When
+    const auto polynomial = unit.GetQuinticPolynomial(start_, 6.0);
+
+    // Then
+    const auto start = polynomial(0.0);
+    EXPECT_NEAR(start.position, start_.position, kTolerance);
+    EXPECT_NEAR(start.velocity, start_.velocity, kTolerance);
+    EXPECT_NEAR(start.acceleration, start_.acceleration, kTolerance);
+    const auto end = polynomial(duration);
+    EXPECT_NEAR(end.position, 6.0, 1e-6);
+    EXPECT_NEAR(end.velocity, 0.0, 1e-6);
+    EXPECT_NEAR(end.acceleration, 0.0, 1e-6);
+}
+
+TEST_P(FrenetPolynomialSolverFixture, GetQuarticPolynomial_GivenEndVelocity_ExpectBoundaryConditions)
+{
+    // Given
+    const auto duration = GetParam();
+    const auto unit = FrenetPolynomialSolver{duration};
+
+    // When
+    const auto polynomial = unit.GetQuarticPolynomial(start_, 20.0);
+
+    // Then
+    const auto start = polynomial(0.0);
+    EXPECT_NEAR(start.position, start_.position, kTolerance);
+    EXPECT_NEAR(start.velocity, start_.velocity, kTolerance);
+    EXPECT_NEAR(start.acceleration, start_.acceleration, kTolerance);
+    const auto end = polynomial(duration);
+    EXPECT_NEAR(end.velocity, 20.0, 1e-6);
+    EXPECT_NEAR(end.acceleration, 0.0, 1e-6);
+}
+
+TEST(FrenetPolynomialTest, Evaluate_GivenTimeBeyondDuration_ExpectConstantEndVelocity)
+{
+    // Given
+    const auto polynomial = FrenetPolynomialSolver{2.0}.GetQuarticPolynomial(FrenetState{0.0, 10.0, 0.0}, 12.0);
+    const auto end = polynomial(2.0);
+
+    // When
+    const auto actual = polynomial(3.0);
+
+    // Then
+    EXPECT_NEAR(actual.position, end.position + 12.0, 1e-6);
+    EXPECT_NEAR(actual.velocity, 12.0, 1e-6);
+    EXPECT_DOUBLE_EQ(actual.acceleration, 0.0);
+}
+
+}  // namespace
+}  // namespace planning
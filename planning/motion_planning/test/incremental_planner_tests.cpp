@@ -0,0 +1,161 @@
+///
+/// @file
+/// @brief Contains unit tests for Incremental Planner.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/incremental_planner.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/builders/object_fusion_builder.h"
+#include "planning/motion_planning/test/support/builders/sensor_fusion_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+#include "planning/motion_planning/trajectory_optimizer.h"
+#include "planning/motion_planning/trajectory_planner.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <units.h>
+
+#include <cmath>
+
+namespace planning
+{
+namespace
+{
+class IncrementalPlannerFixture : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        VehicleDynamics vehicle_dynamics{};
+        vehicle_dynamics.velocity = velocity_;
+        vehicle_dynamics.global_coords = GlobalCoordinates{964.7734, 1138.318};
+        vehicle_dynamics.frenet_coords = FrenetCoordinates{180.0, 6.0};
+        vehicle_dynamics.yaw = units::angle::radian_t{0.23};
+        data_source_ = DataSourceBuilder()
+                           .WithPreviousPath(PreviousPathGlobal{})
+                           .WithMapCoordinates(kHighwayMap)
+                           .WithVehicleDynamics(vehicle_dynamics)
+                           .Build();
+    }
+
+    /// @brief Plan and optimize ego lane maneuver, store it as selected trajectory
+    Trajectory SetSelectedTrajectory(const LaneId lane_id)
+    {
+        const auto maneuver = Maneuver{lane_id, velocity_};
+        const auto planned_trajectory = TrajectoryPlanner{data_source_}.GetPlannedTrajectory(maneuver, 1);
+        const auto selected_trajectory = TrajectoryOptimizer{data_source_}.GetOptimizedTrajectory(planned_trajectory);
+        unit_.SetSelectedTrajectory(planned_trajectory, selected_trajectory, ReplanningTrigger::kNoPreviousPlan);
+        return selected_trajectory;
+    }
+
+    /// @brief Simulator consumed first n waypoints of the sent trajectory
+    void ConsumeWaypoints(const Trajectory& sent_trajectory, const std::size_t n_waypoints)
+    {
+        PreviousPathGlobal previous_path{};
+        ForEachWaypoint(sent_trajectory, [&previous_path](const auto& waypoint) { previous_path.push_back(waypoint); });
+        previous_path.erase(previous_path.begin(), previous_path.begin() + n_waypoints);
+        data_source_.SetPreviousPath(previous_path);
+    }
+
+    const units::velocity::meters_per_second_t velocity_{20.0};
+    DataSource data_source_{};
+    IncrementalPlanner unit_{data_source_};
+};
+
+TEST_F(IncrementalPlannerFixture, GetReplanningTrigger_GivenNoSelectedTrajectory_ExpectNoPreviousPlan)
+{
+    // Then
+    EXPECT_EQ(unit_.GetReplanningTrigger(velocity_), ReplanningTrigger::kNoPreviousPlan);
+}
+
+TEST_F(IncrementalPlannerFixture, GetExtendedTrajectory_GivenConsumedWaypoints_ExpectTailExtended)
+{
+    // Given
+    const auto selected_trajectory = SetSelectedTrajectory(LaneId::kEgo);
+    ConsumeWaypoints(selected_trajectory, 5U);
+
+    // When
+    ASSERT_EQ(unit_.GetReplanningTrigger(velocity_), ReplanningTrigger::kNone);
+    const auto actual = unit_.GetExtendedTrajectory();
+
+    // Then
+    ASSERT_EQ(actual.waypoints.size(), 5U);
+    EXPECT_EQ(GetPreviousPathSize(actual) + actual.waypoints.size(), 50U);
+    EXPECT_EQ(actual.unique_id, selected_trajectory.unique_id);
+    auto previous_waypoint = actual.previous_path->back();
+    for (const auto& waypoint : actual.waypoints)
+    {
+        const auto distance = std::hypot(waypoint.x - previous_waypoint.x, waypoint.y - previous_waypoint.y);
+        EXPECT_NEAR(distance, velocity_.value() * kWaypointSamplingTime, 1e-2);
+        previous_waypoint = waypoint;
+    }
+    EXPECT_EQ(unit_.GetStatistics().extended_frames, 1U);
+    EXPECT_EQ(unit_.GetStatistics().replanned_frames, 1U);
+    EXPECT_DOUBLE_EQ(unit_.GetStatistics().GetHitRate(), 0.5);
+}
+
+TEST_F(IncrementalPlannerFixture, GetReplanningTrigger_GivenExtendedTrajectory_ExpectSteadyState)
+{
+    // Given
+    auto sent_trajectory = SetSelectedTrajectory(LaneId::kEgo);
+
+    for (auto frame = 0; frame < 10; ++frame)
+    {
+        // When
+        ConsumeWaypoints(sent_trajectory, 3U);
+
+        // Then
+        ASSERT_EQ(unit_.GetReplanningTrigger(velocity_), ReplanningTrigger::kNone);
+        sent_trajectory = unit_.GetExtendedTrajectory();
+    }
+    EXPECT_EQ(unit_.GetStatistics().extended_frames, 10U);
+}
+
+TEST_F(IncrementalPlannerFixture, GetReplanningTrigger_GivenVelocityChange_ExpectVelocityChange)
+{
+    // Given
+    const auto selected_trajectory = SetSelectedTrajectory(LaneId::kEgo);
+    ConsumeWaypoints(selected_trajectory, 5U);
+
+    // Then
+    EXPECT_EQ(unit_.GetReplanningTrigger(velocity_ + units::velocity::meters_per_second_t{0.2}),
+              ReplanningTrigger::kVelocityChange);
+}
+
+TEST_F(IncrementalPlannerFixture, GetReplanningTrigger_GivenLaneChange_ExpectLaneChange)
+{
+    // Given
+    const auto selected_trajectory = SetSelectedTrajectory(LaneId::kLeft);
+    ConsumeWaypoints(selected_trajectory, 5U);
+
+    // Then
+    EXPECT_EQ(unit_.GetReplanningTrigger(velocity_), ReplanningTrigger::kLaneChange);
+}
+
+TEST_F(IncrementalPlannerFixture, GetReplanningTrigger_GivenNewObjectInRelevanceWindow_ExpectNewObject)
+{
+    // Given
+    const auto selected_trajectory = SetSelectedTrajectory(LaneId::kEgo);
+    ConsumeWaypoints(selected_trajectory, 5U);
+    data_source_.SetSensorFusion(
+        SensorFusionBuilder()
+            .WithObjectFusion(
+                ObjectFusionBuilder().WithIndex(7).WithFrenetCoordinates(FrenetCoordinates{200.0, 2.0}).Build())
+            .Build());
+
+    // Then
+    EXPECT_EQ(unit_.GetReplanningTrigger(velocity_), ReplanningTrigger::kNewObject);
+}
+
+TEST_F(IncrementalPlannerFixture, GetReplanningTrigger_GivenDivergedPreviousPath_ExpectPathDiverged)
+{
+    // Given
+    SetSelectedTrajectory(LaneId::kEgo);
+    data_source_.SetPreviousPath(PreviousPathGlobal{GlobalCoordinates{1.0, 2.0}, GlobalCoordinates{2.0, 2.0}});
+
+    // Then
+    EXPECT_EQ(unit_.GetReplanningTrigger(velocity_), ReplanningTrigger::kPathDiverged);
+}
+
+}  // namespace
+}  // namespace planning
@@ -5,6 +5,7 @@
 ///
 #include "planning/motion_planning/data_source.h"
 #include "planning/motion_planning/lane_evaluator.h"
+#include "planning/motion_planning/object_predictor.h"
 #include "planning/motion_planning/test/support/builders/data_source_builder.h"
 
 #include <gmock/gmock.h>
@@ -122,5 +123,46 @@ TEST_P(LaneEvaluatorFixture_WithDrivableLaneId,
     EXPECT_EQ(is_drivable, param.is_drivable);
 }
 
+TEST_P(LaneEvaluatorFixture_WithDrivableLaneId, GetLaneEvaluation_GivenTypicalDataSource_ExpectSameAsPerLaneEvaluation)
+{
+    // Given
+    const auto param = GetParam();
+    const auto data_source =
+        DataSourceBuilder()
+            .WithGlobalLaneId(param.ego_global_lane_id)
+            .WithObjectInLane(param.object_global_lane_id, units::velocity::meters_per_second_t{10.0})
+            .Build();
+    const auto unit = LaneEvaluator(data_source);
+
+    // When
+    const auto lane_evaluation = unit.GetLaneEvaluation();
+
+    // Then
+    EXPECT_EQ(lane_evaluation.IsDrivable(param.lane_id), param.is_drivable);
+    for (const auto lane_id : {LaneId::kLeft, LaneId::kEgo, LaneId::kRight, LaneId::kInvalid})
+    {
+        EXPECT_EQ(lane_evaluation.IsDrivable(lane_id), unit.IsDrivableLane(lane_id));
+    }
+}
+
+TEST_P(LaneEvaluatorFixture_WithDrivableLaneId, GetLaneEvaluation_GivenSharedObjectPredictor_ExpectSameDrivability)
+{
+    // Given
+    const auto param = GetParam();
+    const auto data_source =
+        DataSourceBuilder()
+            .WithGlobalLaneId(param.ego_global_lane_id)
+            .WithObjectInLane(param.object_global_lane_id, units::velocity::meters_per_second_t{10.0})
+            .Build();
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+
+    // When
+    const auto lane_evaluation = LaneEvaluator(data_source, object_predictor).GetLaneEvaluation();
+
+    // Then
+    EXPECT_EQ(lane_evaluation.IsDrivable(param.lane_id), param.is_drivable);
+}
+
 }  // namespace
 }  // namespace planning
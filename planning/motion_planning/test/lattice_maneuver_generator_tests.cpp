@@ -0,0 +1,78 @@
+///
+/// @file
+/// @brief Contains unit tests for Lattice Maneuver Generation.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/lattice_maneuver_generator.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace planning
+{
+namespace
+{
+TEST(LatticeManeuverGeneratorTest, Generate_GivenDefaultOptions_ExpectFullLattice)
+{
+    // Given
+    const auto target_velocity = units::velocity::meters_per_second_t{17.0};
+    const auto unit = LatticeManeuverGenerator();
+
+    // When
+    const auto maneuvers = unit.Generate(target_velocity);
+
+    // Then
+    ASSERT_THAT(unit.GetLatticeSize(), ::testing::Eq(3U * 7U * 4U));
+    ASSERT_THAT(maneuvers.size(), ::testing::Eq(unit.GetLatticeSize()));
+    EXPECT_EQ(maneuvers.front(), Maneuver(LaneId::kLeft, target_velocity, units::length::meter_t{30.0}));
+    EXPECT_EQ(maneuvers.back(),
+              Maneuver(LaneId::kRight, units::velocity::meters_per_second_t{11.0}, units::length::meter_t{60.0}));
+    for (const auto lane_id : {LaneId::kLeft, LaneId::kEgo, LaneId::kRight})
+    {
+        EXPECT_EQ(std::count_if(maneuvers.begin(),
+                                maneuvers.end(),
+                                [lane_id](const auto& maneuver) { return maneuver.GetLaneId() == lane_id; }),
+                  7 * 4);
+    }
+}
+
+TEST(LatticeManeuverGeneratorTest, Generate_GivenLowTargetVelocity_ExpectStandstillSamplesSkipped)
+{
+    // Given
+    const auto target_velocity = units::velocity::meters_per_second_t{2.5};
+
+    // When
+    const auto maneuvers = LatticeManeuverGenerator().Generate(target_velocity);
+
+    // Then
+    ASSERT_THAT(maneuvers.size(), ::testing::Eq(3U * 2U * 4U));
+    EXPECT_TRUE(std::all_of(maneuvers.begin(),
+                            maneuvers.end(),
+                            [](const auto& maneuver)
+                            { return maneuver.GetVelocity() >= units::velocity::meters_per_second_t{1.0}; }));
+}
+
+TEST(LatticeManeuverGeneratorTest, Generate_GivenCustomOptions_ExpectConfiguredLatticeSize)
+{
+    // Given
+    LatticeOptions options{};
+    options.number_of_velocities = 10U;
+    options.velocity_resolution = units::velocity::meters_per_second_t{0.5};
+    options.number_of_horizons = 12U;
+    options.min_horizon = units::length::meter_t{20.0};
+    options.horizon_resolution = units::length::meter_t{5.0};
+    const auto unit = LatticeManeuverGenerator(options);
+
+    // When
+    const auto maneuvers = unit.Generate(units::velocity::meters_per_second_t{20.0});
+
+    // Then
+    ASSERT_THAT(maneuvers.size(), ::testing::Eq(360U));
+    EXPECT_EQ(maneuvers[1], Maneuver(LaneId::kLeft, units::velocity::meters_per_second_t{19.5}, options.min_horizon));
+    EXPECT_EQ(maneuvers[10].GetHorizon(), units::length::meter_t{25.0});
+}
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,115 @@
+///
+/// @file
+/// @brief Contains unit tests for Maneuver Pruner.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/lane_evaluator.h"
+#include "planning/motion_planning/maneuver_pruner.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <units.h>
+
+namespace planning
+{
+namespace
+{
+/// @brief Maneuvers to all the lanes at 17 m/s
+std::vector<Maneuver> GetManeuvers()
+{
+    const units::velocity::meters_per_second_t velocity{17.0};
+    return {Maneuver{LaneId::kLeft, velocity}, Maneuver{LaneId::kEgo, velocity}, Maneuver{LaneId::kRight, velocity}};
+}
+
+struct TestPruneParam
+{
+    // Given
+    GlobalLaneId ego_global_lane_id;
+
+    // Then
+    std::vector<LaneId> lane_ids;
+};
+
+class ManeuverPrunerFixture : public ::testing::TestWithParam<TestPruneParam>
+{
+};
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(
+    ManeuverPruner,
+    ManeuverPrunerFixture,
+    ::testing::Values(
+        //             ego_global_lane_id, (expected) lane_ids
+        TestPruneParam{  GlobalLaneId::kLeft, {LaneId::kEgo, LaneId::kRight}},
+        TestPruneParam{GlobalLaneId::kCenter, {LaneId::kLeft, LaneId::kEgo, LaneId::kRight}},
+        TestPruneParam{ GlobalLaneId::kRight, {LaneId::kLeft, LaneId::kEgo}}
+));
+// clang-format on
+
+TEST_P(ManeuverPrunerFixture, Prune_GivenEgoGlobalLane_ExpectManeuversToValidLanesOnly)
+{
+    // Given
+    const auto param = GetParam();
+    const auto data_source = DataSourceBuilder().WithGlobalLaneId(param.ego_global_lane_id).Build();
+    const auto lane_evaluation = LaneEvaluator{data_source}.GetLaneValidity();
+    ManeuverPruner maneuver_pruner{data_source};
+
+    // When
+    const auto actual = maneuver_pruner.Prune(GetManeuvers(), lane_evaluation);
+
+    // Then
+    std::vector<LaneId> lane_ids{};
+    for (const auto& maneuver : actual)
+    {
+        lane_ids.push_back(maneuver.GetLaneId());
+    }
+    EXPECT_EQ(lane_ids, param.lane_ids);
+    EXPECT_EQ(maneuver_pruner.GetStatistics().maneuvers, 3U);
+    EXPECT_EQ(maneuver_pruner.GetStatistics().invalid_lane, 3U - param.lane_ids.size());
+    EXPECT_EQ(maneuver_pruner.GetStatistics().blocked_lane, 0U);
+}
+
+TEST(ManeuverPrunerTest, Prune_GivenObjectAlongsideOnLeft_ExpectLeftRejectedAsBlocked)
+{
+    // Given
+    const auto data_source =
+        DataSourceBuilder().WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{0.0}).Build();
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    const auto lane_evaluation = LaneEvaluator{data_source, object_predictor}.GetLaneEvaluation();
+    ManeuverPruner maneuver_pruner{data_source};
+
+    // When
+    const auto actual = maneuver_pruner.Prune(GetManeuvers(), lane_evaluation);
+
+    // Then
+    ASSERT_EQ(actual.size(), 2U);
+    EXPECT_EQ(actual[0].GetLaneId(), LaneId::kEgo);
+    EXPECT_EQ(actual[1].GetLaneId(), LaneId::kRight);
+    EXPECT_EQ(maneuver_pruner.GetStatistics().blocked_lane, 1U);
+    EXPECT_EQ(maneuver_pruner.GetStatistics().GetRejected(), 1U);
+}
+
+TEST(ManeuverPrunerTest, Prune_GivenTargetLaneOnLeft_ExpectRightRejectedAsOffTarget)
+{
+    // Given
+    const auto data_source = DataSourceBuilder().WithGlobalLaneId(GlobalLaneId::kCenter).Build();
+    const auto lane_evaluation = LaneEvaluator{data_source}.GetLaneValidity();
+    ManeuverPruner maneuver_pruner{data_source};
+    maneuver_pruner.SetTargetLane(GlobalLaneId::kLeft);
+
+    // When
+    const auto actual = maneuver_pruner.Prune(GetManeuvers(), lane_evaluation);
+
+    // Then
+    ASSERT_EQ(actual.size(), 2U);
+    EXPECT_EQ(actual[0].GetLaneId(), LaneId::kLeft);
+    EXPECT_EQ(actual[1].GetLaneId(), LaneId::kEgo);
+    EXPECT_EQ(maneuver_pruner.GetStatistics().off_target_lane, 1U);
+    EXPECT_EQ(maneuver_pruner.GetStatistics().GetRejected(), 1U);
+}
+
+}  // namespace
+}  // namespace planning
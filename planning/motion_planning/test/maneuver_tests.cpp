@@ -29,6 +29,17 @@ TEST(ManeuverTest, NonDefaultConstruction)
     EXPECT_THAT(unit.GetVelocity(), ::testing::Eq(units::velocity::meters_per_second_t{10.0}));
 }
 
+TEST(ManeuverTest, GivenHorizon_WhenConstructed_ThenReturnsHorizon)
+{
+    // When
+    const auto unit = Maneuver(LaneId::kLeft, units::velocity::meters_per_second_t{10.0}, units::length::meter_t{50.0});
+
+    // Then
+    EXPECT_EQ(unit.GetLaneId(), LaneId::kLeft);
+    EXPECT_THAT(unit.GetHorizon(), ::testing::Eq(units::length::meter_t{50.0}));
+    EXPECT_FALSE(unit == Maneuver(LaneId::kLeft, units::velocity::meters_per_second_t{10.0}));
+}
+
 TEST(ManeuverTest, CompareManeuvers)
 {
     // Then
@@ -10,10 +10,24 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <memory>
+
 namespace planning
 {
 namespace
 {
+/// @brief Timer whose deadline has always expired (e.g. pathological scene exceeding any time budget)
+class ExpiredTimer : public timer::ITimer
+{
+  public:
+    void Start() override {}
+    void Stop() override {}
+    bool IsTimeout() const override { return true; }
+    bool IsRunning() const override { return false; }
+    void SetTimer(const std::chrono::system_clock::duration& /* duration */) override {}
+};
+
 class MotionPlanningFixture : public ::testing::Test
 {
   public:
@@ -46,5 +60,386 @@ TEST_F(MotionPlanningFixture, DISABLED_GenerateTrajectories_GivenTypicalDataSour
     EXPECT_EQ(actual.global_lane_id, LaneInformation::GlobalLaneId::kCenter);
 }
 
+class MotionPlanningFixture_WithHighwayMap : public ::testing::Test
+{
+  protected:
+    const DataSource data_source_{DataSourceBuilder()
+                                      .WithPreviousPath(PreviousPathGlobal{})
+                                      .WithMapCoordinates(kHighwayMap)
+                                      .WithGlobalLaneId(GlobalLaneId::kCenter)
+                                      .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+                                      .Build()};
+};
+
+class MotionPlanningFixture_WithNumberOfThreads : public MotionPlanningFixture_WithHighwayMap,
+                                                  public ::testing::WithParamInterface<std::size_t>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(MotionPlanning, MotionPlanningFixture_WithNumberOfThreads, ::testing::Values(1U, 2U, 4U));
+
+TEST_P(MotionPlanningFixture_WithNumberOfThreads, GenerateTrajectories_GivenThreadPool_ExpectSameResultAsSerial)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.number_of_threads = GetParam();
+    auto serial_motion_planning = MotionPlanning{data_source_};
+    auto parallel_motion_planning = MotionPlanning{data_source_, options};
+
+    for (auto frame = 0; frame < 3; ++frame)
+    {
+        // When
+        serial_motion_planning.GenerateTrajectories();
+        parallel_motion_planning.GenerateTrajectories();
+
+        // Then
+        const auto expected = serial_motion_planning.GetSelectedTrajectory();
+        const auto actual = parallel_motion_planning.GetSelectedTrajectory();
+        EXPECT_EQ(actual.unique_id, expected.unique_id);
+        EXPECT_EQ(actual.lane_id, expected.lane_id);
+        EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+        ASSERT_EQ(actual.waypoints.size(), expected.waypoints.size());
+        for (std::size_t idx = 0U; idx < actual.waypoints.size(); ++idx)
+        {
+            EXPECT_DOUBLE_EQ(actual.waypoints[idx].x, expected.waypoints[idx].x);
+            EXPECT_DOUBLE_EQ(actual.waypoints[idx].y, expected.waypoints[idx].y);
+        }
+    }
+}
+
+TEST_P(MotionPlanningFixture_WithNumberOfThreads, GenerateTrajectories_GivenLatticeGenerator_ExpectSameResultAsSerial)
+{
+    // Given
+    MotionPlanningOptions serial_options{};
+    serial_options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    MotionPlanningOptions parallel_options{serial_options};
+    parallel_options.number_of_threads = GetParam();
+    auto serial_motion_planning = MotionPlanning{data_source_, serial_options};
+    auto parallel_motion_planning = MotionPlanning{data_source_, parallel_options};
+
+    // When
+    serial_motion_planning.GenerateTrajectories();
+    parallel_motion_planning.GenerateTrajectories();
+
+    // Then
+    const auto expected = serial_motion_planning.GetSelectedTrajectory();
+    const auto actual = parallel_motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.lane_id, expected.lane_id);
+    EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+    EXPECT_EQ(actual.waypoints.size(), expected.waypoints.size());
+    EXPECT_NE(actual.lane_id, LaneInformation::LaneId::kLeft);
+}
+
+TEST_P(MotionPlanningFixture_WithNumberOfThreads, GenerateTrajectories_GivenCollisionChecking_ExpectSameResultAsSerial)
+{
+    // Given
+    MotionPlanningOptions serial_options{};
+    serial_options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    serial_options.collision_checking = true;
+    MotionPlanningOptions parallel_options{serial_options};
+    parallel_options.number_of_threads = GetParam();
+    auto serial_motion_planning = MotionPlanning{data_source_, serial_options};
+    auto parallel_motion_planning = MotionPlanning{data_source_, parallel_options};
+
+    // When
+    serial_motion_planning.GenerateTrajectories();
+    parallel_motion_planning.GenerateTrajectories();
+
+    // Then
+    const auto expected = serial_motion_planning.GetSelectedTrajectory();
+    const auto actual = parallel_motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+    EXPECT_NE(actual.lane_id, LaneInformation::LaneId::kLeft);
+}
+
+TEST_P(MotionPlanningFixture_WithNumberOfThreads, GenerateTrajectories_GivenOccupancyGrid_ExpectSameResultAsSerial)
+{
+    // Given
+    MotionPlanningOptions serial_options{};
+    serial_options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    serial_options.occupancy_evaluation_type = OccupancyEvaluationType::kOccupancyGrid;
+    MotionPlanningOptions parallel_options{serial_options};
+    parallel_options.number_of_threads = GetParam();
+    auto serial_motion_planning = MotionPlanning{data_source_, serial_options};
+    auto parallel_motion_planning = MotionPlanning{data_source_, parallel_options};
+
+    // When
+    serial_motion_planning.GenerateTrajectories();
+    parallel_motion_planning.GenerateTrajectories();
+
+    // Then
+    const auto expected = serial_motion_planning.GetSelectedTrajectory();
+    const auto actual = parallel_motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+    EXPECT_NE(actual.lane_id, LaneInformation::LaneId::kLeft);
+}
+
+TEST_P(MotionPlanningFixture_WithNumberOfThreads, GenerateTrajectories_GivenTaskGraph_ExpectSameResultAsSerial)
+{
+    // Given
+    MotionPlanningOptions serial_options{};
+    serial_options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    serial_options.collision_checking = true;
+    serial_options.occupancy_evaluation_type = OccupancyEvaluationType::kOccupancyGrid;
+    MotionPlanningOptions task_graph_options{serial_options};
+    task_graph_options.execution_type = ExecutionType::kTaskGraph;
+    task_graph_options.number_of_threads = GetParam();
+    auto serial_motion_planning = MotionPlanning{data_source_, serial_options};
+    auto task_graph_motion_planning = MotionPlanning{data_source_, task_graph_options};
+
+    // When
+    serial_motion_planning.GenerateTrajectories();
+    task_graph_motion_planning.GenerateTrajectories();
+
+    // Then
+    const auto expected = serial_motion_planning.GetSelectedTrajectory();
+    const auto actual = task_graph_motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+    EXPECT_EQ(actual.waypoints.size(), expected.waypoints.size());
+    EXPECT_TRUE(serial_motion_planning.GetTaskTimings().empty());
+}
+
+TEST_F(MotionPlanningFixture_WithHighwayMap, GenerateTrajectories_GivenSerialTaskGraph_ExpectTimingOfEachTask)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.execution_type = ExecutionType::kTaskGraph;
+    options.collision_checking = true;
+    auto motion_planning = MotionPlanning{data_source_, options};
+
+    // When
+    motion_planning.GenerateTrajectories();
+    motion_planning.GenerateTrajectories();
+
+    // Then (one timing per frame update followed by one per stage of the candidate branches)
+    const auto& actual = motion_planning.GetTaskTimings();
+    ASSERT_EQ(actual.size(), 3U + 3U);
+    EXPECT_STREQ(actual[0U].name, "predict_objects");
+    EXPECT_STREQ(actual[1U].name, "update_collision_checker");
+    EXPECT_STREQ(actual[2U].name, "calculate_target_velocity");
+    EXPECT_STREQ(actual[3U].name, "plan_trajectories");
+    EXPECT_STREQ(actual[4U].name, "optimize_trajectories");
+    EXPECT_STREQ(actual[5U].name, "rate_trajectories");
+    EXPECT_GE(actual[2U].start, actual[0U].start + actual[0U].duration);
+    EXPECT_GE(actual[5U].start, actual[3U].start);
+}
+
+TEST_F(MotionPlanningFixture_WithHighwayMap, GenerateTrajectories_GivenFrenetPolynomialOptimizer_ExpectWaypoints)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    options.trajectory_optimizer_type = TrajectoryOptimizerType::kFrenetPolynomial;
+    auto motion_planning = MotionPlanning{data_source_, options};
+
+    // When
+    motion_planning.GenerateTrajectories();
+
+    // Then
+    const auto actual = motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(GetPreviousPathSize(actual) + actual.waypoints.size(), 50U);
+    EXPECT_NE(actual.lane_id, LaneInformation::LaneId::kLeft);
+}
+
+TEST_F(MotionPlanningFixture_WithHighwayMap, GenerateTrajectories_GivenBranchAndBound_ExpectSameResultAsExhaustive)
+{
+    // Given
+    MotionPlanningOptions exhaustive_options{};
+    exhaustive_options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    exhaustive_options.trajectory_optimizer_type = TrajectoryOptimizerType::kFrenetPolynomial;
+    exhaustive_options.cost_options.progress_weight = 1.0;
+    exhaustive_options.cost_options.jerk_weight = 0.01;
+    exhaustive_options.cost_options.acceleration_weight = 0.1;
+    MotionPlanningOptions branch_and_bound_options{exhaustive_options};
+    branch_and_bound_options.evaluation_type = EvaluationType::kBranchAndBound;
+    auto exhaustive_motion_planning = MotionPlanning{data_source_, exhaustive_options};
+    auto branch_and_bound_motion_planning = MotionPlanning{data_source_, branch_and_bound_options};
+
+    // When
+    exhaustive_motion_planning.GenerateTrajectories();
+    branch_and_bound_motion_planning.GenerateTrajectories();
+
+    // Then
+    const auto expected = exhaustive_motion_planning.GetSelectedTrajectory();
+    const auto actual = branch_and_bound_motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+    ASSERT_EQ(actual.waypoints.size(), expected.waypoints.size());
+    EXPECT_FALSE(actual.waypoints.empty());
+    for (std::size_t idx = 0U; idx < actual.waypoints.size(); ++idx)
+    {
+        EXPECT_DOUBLE_EQ(actual.waypoints[idx].x, expected.waypoints[idx].x);
+        EXPECT_DOUBLE_EQ(actual.waypoints[idx].y, expected.waypoints[idx].y);
+    }
+    EXPECT_EQ(exhaustive_motion_planning.GetEvaluationStatistics().GetPruned(), 0U);
+    EXPECT_GT(branch_and_bound_motion_planning.GetEvaluationStatistics().GetPruned(), 0U);
+}
+
+TEST(MotionPlanningTest, GenerateTrajectories_GivenEgoInLeftLane_ExpectLeftManeuversPrunedBeforePlanning)
+{
+    // Given
+    const auto data_source = DataSourceBuilder()
+                                 .WithPreviousPath(PreviousPathGlobal{})
+                                 .WithMapCoordinates(kHighwayMap)
+                                 .WithGlobalLaneId(GlobalLaneId::kLeft)
+                                 .Build();
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    auto motion_planning = MotionPlanning{data_source, options};
+
+    // When
+    motion_planning.GenerateTrajectories();
+
+    // Then (one third of the lattice targets the left lane)
+    const auto statistics = motion_planning.GetManeuverPruningStatistics();
+    EXPECT_EQ(statistics.invalid_lane, statistics.maneuvers / 3U);
+    EXPECT_EQ(statistics.blocked_lane, 0U);
+    EXPECT_NE(motion_planning.GetSelectedTrajectory().lane_id, LaneInformation::LaneId::kLeft);
+}
+
+TEST_F(MotionPlanningFixture_WithHighwayMap, GenerateTrajectories_GivenConsecutiveFrames_ExpectFrameArenaReused)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    options.evaluation_type = EvaluationType::kBranchAndBound;
+    options.cost_options.progress_weight = 1.0;
+    options.frame_arena_capacity = 1024U;
+    auto motion_planning = MotionPlanning{data_source_, options};
+    motion_planning.GenerateTrajectories();
+    const auto used_bytes = motion_planning.GetFrameArena().GetUsedBytes();
+    const auto number_of_chunks = motion_planning.GetFrameArena().GetNumberOfChunks();
+
+    // When
+    motion_planning.GenerateTrajectories();
+
+    // Then (same frame, hence same usage without growing the arena)
+    EXPECT_GT(used_bytes, 0U);
+    EXPECT_EQ(motion_planning.GetFrameArena().GetUsedBytes(), used_bytes);
+    EXPECT_EQ(motion_planning.GetFrameArena().GetNumberOfChunks(), number_of_chunks);
+}
+
+TEST_F(MotionPlanningFixture_WithHighwayMap, GenerateTrajectories_GivenReset_ExpectSameResultAsFirstFrame)
+{
+    // Given
+    auto motion_planning = MotionPlanning{data_source_};
+    motion_planning.GenerateTrajectories();
+    const auto expected = motion_planning.GetSelectedTrajectory();
+    motion_planning.GenerateTrajectories();
+    motion_planning.GenerateTrajectories();
+
+    // When
+    motion_planning.Reset();
+    motion_planning.GenerateTrajectories();
+
+    // Then (target velocity ramps up again from its initial value)
+    const auto actual = motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    EXPECT_EQ(actual.velocity, expected.velocity);
+    EXPECT_EQ(actual.waypoints.size(), expected.waypoints.size());
+}
+
+TEST(MotionPlanningTest, GenerateTrajectories_GivenIncrementalReplanningInSteadyState_ExpectExtendedTrajectories)
+{
+    // Given
+    auto data_source = DataSourceBuilder()
+                           .WithPreviousPath(PreviousPathGlobal{})
+                           .WithMapCoordinates(kHighwayMap)
+                           .WithSpeedLimit(units::velocity::meters_per_second_t{1.0})
+                           .Build();
+    MotionPlanningOptions options{};
+    options.incremental_replanning = true;
+    auto motion_planning = MotionPlanning{data_source, options};
+
+    for (auto frame = 0; frame < 5; ++frame)
+    {
+        // When
+        motion_planning.GenerateTrajectories();
+
+        // Then
+        const auto actual = motion_planning.GetSelectedTrajectory();
+        ASSERT_EQ(GetPreviousPathSize(actual) + actual.waypoints.size(), 50U);
+
+        // simulator consumes 3 waypoints per frame
+        PreviousPathGlobal previous_path{};
+        ForEachWaypoint(actual, [&previous_path](const auto& waypoint) { previous_path.push_back(waypoint); });
+        previous_path.erase(previous_path.begin(), previous_path.begin() + 3);
+        data_source.SetPreviousPath(previous_path);
+    }
+    const auto statistics = motion_planning.GetIncrementalPlanningStatistics();
+    EXPECT_EQ(statistics.replanned_frames, 1U);
+    EXPECT_EQ(statistics.extended_frames, 4U);
+    EXPECT_EQ(statistics.triggers[static_cast<std::size_t>(ReplanningTrigger::kNoPreviousPlan)], 1U);
+}
+
+TEST_P(MotionPlanningFixture_WithNumberOfThreads, GenerateTrajectories_GivenSufficientBudget_ExpectUnboundedResult)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    options.number_of_threads = GetParam();
+    auto unbounded_motion_planning = MotionPlanning{data_source_, options};
+    auto anytime_motion_planning = MotionPlanning{data_source_, options};
+
+    // When
+    unbounded_motion_planning.GenerateTrajectories();
+    anytime_motion_planning.GenerateTrajectories(std::chrono::seconds{10});
+
+    // Then (candidates are planned in another order, hence unique ids may differ)
+    const auto expected = unbounded_motion_planning.GetSelectedTrajectory();
+    const auto actual = anytime_motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.lane_id, expected.lane_id);
+    EXPECT_EQ(actual.velocity, expected.velocity);
+    EXPECT_EQ(actual.horizon, expected.horizon);
+    EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+    EXPECT_FALSE(anytime_motion_planning.IsCutShort());
+    EXPECT_EQ(anytime_motion_planning.GetAnytimePlanningStatistics().frames, 1U);
+    EXPECT_EQ(anytime_motion_planning.GetAnytimePlanningStatistics().cut_short_frames, 0U);
+}
+
+TEST_P(MotionPlanningFixture_WithNumberOfThreads, GenerateTrajectories_GivenExpiredDeadline_ExpectEgoLaneCandidateOnly)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    options.number_of_threads = GetParam();
+    auto motion_planning = MotionPlanning{data_source_, options, std::make_unique<ExpiredTimer>()};
+
+    // When
+    motion_planning.GenerateTrajectories(std::chrono::milliseconds{5});
+
+    // Then
+    const auto actual = motion_planning.GetSelectedTrajectory();
+    const auto statistics = motion_planning.GetAnytimePlanningStatistics();
+    const auto pruning_statistics = motion_planning.GetManeuverPruningStatistics();
+    EXPECT_TRUE(motion_planning.IsCutShort());
+    EXPECT_EQ(actual.lane_id, LaneInformation::LaneId::kEgo);
+    EXPECT_EQ(actual.unique_id, 1);
+    EXPECT_GT(actual.waypoints.size(), 0U);
+    EXPECT_EQ(statistics.cut_short_frames, 1U);
+    EXPECT_EQ(statistics.skipped_candidates, pruning_statistics.maneuvers - pruning_statistics.GetRejected() - 1U);
+    EXPECT_DOUBLE_EQ(statistics.GetCutShortRate(), 1.0);
+}
+
+TEST_P(MotionPlanningFixture_WithNumberOfThreads, GenerateTrajectories_GivenUnboundedFrame_ExpectNotCutShort)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.number_of_threads = GetParam();
+    auto motion_planning = MotionPlanning{data_source_, options, std::make_unique<ExpiredTimer>()};
+    motion_planning.GenerateTrajectories(std::chrono::milliseconds{5});
+    ASSERT_TRUE(motion_planning.IsCutShort());
+
+    // When
+    motion_planning.GenerateTrajectories();
+
+    // Then
+    EXPECT_FALSE(motion_planning.IsCutShort());
+    EXPECT_EQ(motion_planning.GetAnytimePlanningStatistics().frames, 1U);
+}
+
 }  // namespace
 }  // namespace planning
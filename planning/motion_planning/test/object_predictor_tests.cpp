@@ -0,0 +1,151 @@
+///
+/// @file
+/// @brief Contains unit tests for Object Predictor.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/builders/object_fusion_builder.h"
+#include "planning/motion_planning/test/support/builders/sensor_fusion_builder.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <units.h>
+
+namespace planning
+{
+namespace
+{
+using namespace units::literals;
+
+/// @brief Sensor Fusion with a single object at given position and velocity
+SensorFusion GetSensorFusion(const std::int32_t idx,
+                             const FrenetCoordinates& frenet_coords,
+                             const units::velocity::meters_per_second_t velocity)
+{
+    return SensorFusionBuilder()
+        .WithObjectFusion(
+            ObjectFusionBuilder().WithIndex(idx).WithFrenetCoordinates(frenet_coords).WithVelocity(velocity).Build())
+        .Build();
+}
+
+TEST(ObjectPredictorTest, PredictObjects_GivenConstantVelocityModel_ExpectLinearlyPredictedStates)
+{
+    // Given
+    const auto data_source =
+        DataSourceBuilder().WithSensorFusion(GetSensorFusion(7, FrenetCoordinates{100.0, 6.0}, 10.0_mps)).Build();
+    ObjectPredictor object_predictor{data_source};
+
+    // When
+    object_predictor.PredictObjects();
+
+    // Then
+    const auto& predicted_objects = object_predictor.GetPredictedObjects();
+    ASSERT_EQ(predicted_objects.GetNumberOfObjects(), 1U);
+    ASSERT_EQ(predicted_objects.GetNumberOfSteps(), 51U);
+    EXPECT_EQ(predicted_objects.GetObjectId(0U), 7);
+    for (std::size_t step = 0U; step < predicted_objects.GetNumberOfSteps(); ++step)
+    {
+        const auto& state = predicted_objects.GetState(step, 0U);
+        EXPECT_DOUBLE_EQ(state.s, 100.0 + (static_cast<double>(step) * 0.02 * 10.0));
+        EXPECT_DOUBLE_EQ(state.d, 6.0);
+        EXPECT_DOUBLE_EQ(state.velocity, 10.0);
+    }
+}
+
+TEST(ObjectPredictorTest, PredictObjects_GivenMultipleObjects_ExpectTimeMajorLayout)
+{
+    // Given
+    const auto data_source =
+        DataSourceBuilder()
+            .WithSensorFusion(
+                SensorFusionBuilder()
+                    .WithObjectFusion(ObjectFusionBuilder().WithIndex(1).WithVelocity(10.0_mps).Build())
+                    .WithObjectFusion(ObjectFusionBuilder().WithIndex(2).WithVelocity(20.0_mps).Build())
+                    .Build())
+            .Build();
+    ObjectPredictor object_predictor{data_source};
+
+    // When
+    object_predictor.PredictObjects();
+
+    // Then
+    const auto& predicted_objects = object_predictor.GetPredictedObjects();
+    ASSERT_EQ(predicted_objects.GetNumberOfObjects(), 2U);
+    const auto* const states = predicted_objects.GetStates(10U);
+    EXPECT_EQ(&states[0U], &predicted_objects.GetState(10U, 0U));
+    EXPECT_EQ(&states[1U], &predicted_objects.GetState(10U, 1U));
+    EXPECT_EQ(&states[2U], &predicted_objects.GetState(11U, 0U));
+}
+
+TEST(ObjectPredictorTest, PredictObjects_GivenConstantAccelerationModel_ExpectAccelerationFromConsecutiveFrames)
+{
+    // Given
+    PredictionOptions options{};
+    options.model = PredictionModel::kConstantAcceleration;
+    auto data_source =
+        DataSourceBuilder().WithSensorFusion(GetSensorFusion(1, FrenetCoordinates{100.0, 6.0}, 10.0_mps)).Build();
+    ObjectPredictor object_predictor{data_source, options};
+    object_predictor.PredictObjects();
+
+    // When (10 waypoints consumed since previous frame, i.e. 0.2s)
+    data_source.SetPreviousPath(PreviousPathGlobal(40U, GlobalCoordinates{}));
+    data_source.SetSensorFusion(GetSensorFusion(1, FrenetCoordinates{102.0, 6.0}, 10.5_mps));
+    object_predictor.PredictObjects();
+
+    // Then (acceleration of 2.5 mps^2)
+    const auto& predicted_objects = object_predictor.GetPredictedObjects();
+    const auto& state = predicted_objects.GetState(50U, 0U);
+    EXPECT_NEAR(state.s, 102.0 + 10.5 + (0.5 * 2.5), 1e-9);
+    EXPECT_NEAR(state.velocity, 10.5 + 2.5, 1e-9);
+}
+
+TEST(ObjectPredictorTest, PredictObjects_GivenConstantAccelerationModelWithNewObject_ExpectConstantVelocity)
+{
+    // Given
+    PredictionOptions options{};
+    options.model = PredictionModel::kConstantAcceleration;
+    auto data_source =
+        DataSourceBuilder().WithSensorFusion(GetSensorFusion(1, FrenetCoordinates{100.0, 6.0}, 10.0_mps)).Build();
+    ObjectPredictor object_predictor{data_source, options};
+    object_predictor.PredictObjects();
+
+    // When
+    data_source.SetPreviousPath(PreviousPathGlobal(40U, GlobalCoordinates{}));
+    data_source.SetSensorFusion(GetSensorFusion(2, FrenetCoordinates{102.0, 6.0}, 15.0_mps));
+    object_predictor.PredictObjects();
+
+    // Then
+    const auto& state = object_predictor.GetPredictedObjects().GetState(50U, 0U);
+    EXPECT_NEAR(state.s, 102.0 + 15.0, 1e-9);
+    EXPECT_NEAR(state.velocity, 15.0, 1e-9);
+}
+
+TEST(ObjectPredictorTest, GetPredictedState_GivenDeceleration_ExpectObjectStopsAtStandstill)
+{
+    // Given
+    const auto object_fusion =
+        ObjectFusionBuilder().WithFrenetCoordinates(FrenetCoordinates{100.0, 2.0}).WithVelocity(2.0_mps).Build();
+
+    // When
+    const auto actual = ObjectPredictor::GetPredictedState(object_fusion, -4.0, 1.0);
+
+    // Then
+    EXPECT_DOUBLE_EQ(actual.s, 100.5);
+    EXPECT_DOUBLE_EQ(actual.velocity, 0.0);
+}
+
+TEST(ObjectPredictorTest, GetStep_GivenTimeBeyondHorizon_ExpectLastStep)
+{
+    // Given
+    PredictedObjects predicted_objects{};
+    predicted_objects.Resize(1U, 51U, 0.02_s);
+
+    // When / Then
+    EXPECT_EQ(predicted_objects.GetStep(-1.0_s), 0U);
+    EXPECT_EQ(predicted_objects.GetStep(0.5_s), 25U);
+    EXPECT_EQ(predicted_objects.GetStep(2.0_s), 50U);
+}
+
+}  // namespace
+}  // namespace planning
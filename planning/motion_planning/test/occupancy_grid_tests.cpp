@@ -0,0 +1,185 @@
+///
+/// @file
+/// @brief Contains unit tests for Occupancy Grid.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/occupancy_grid.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/builders/object_fusion_builder.h"
+#include "planning/motion_planning/test/support/builders/sensor_fusion_builder.h"
+#include "planning/motion_planning/test/support/builders/trajectory_builder.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <units.h>
+
+namespace planning
+{
+namespace
+{
+/// @brief Ego longitudinal position (in meters)
+constexpr double kEgoPosition{200.0};
+
+/// @brief Ego velocity (in meters per second)
+constexpr double kEgoVelocity{17.0};
+
+/// @brief DataSource with given objects (ego at kEgoPosition in center lane)
+DataSource GetDataSource(const SensorFusion& sensor_fusion)
+{
+    return DataSourceBuilder()
+        .WithDistance(units::length::meter_t{kEgoPosition})
+        .WithVelocity(units::velocity::meters_per_second_t{kEgoVelocity})
+        .WithSensorFusion(sensor_fusion)
+        .Build();
+}
+
+/// @brief Trajectory to given lane with ego velocity
+Trajectory GetTrajectory(const GlobalLaneId global_lane_id)
+{
+    return TrajectoryBuilder()
+        .WithGlobalLaneId(global_lane_id)
+        .WithTargetVelocity(units::velocity::meters_per_second_t{kEgoVelocity})
+        .Build();
+}
+
+struct TestCorridorParam
+{
+    // Given
+    double object_distance;
+    double object_lane;
+    double object_velocity;
+    GlobalLaneId target_lane;
+
+    // Then
+    bool is_corridor_free;
+};
+
+class OccupancyGridFixture : public ::testing::TestWithParam<TestCorridorParam>
+{
+};
+
+// clang-format off
+INSTANTIATE_TEST_SUITE_P(
+    OccupancyGrid,
+    OccupancyGridFixture,
+    ::testing::Values(
+        //                object_distance, object_lane, object_velocity,  target_lane, (expected) is_free?
+        TestCorridorParam{          10.0,         6.0,             0.0, GlobalLaneId::kCenter,  false},  // stopped
+        TestCorridorParam{          10.0,         6.0,            20.0, GlobalLaneId::kCenter,   true},  // ahead
+        TestCorridorParam{          60.0,         6.0,             0.0, GlobalLaneId::kCenter,   true},  // too far
+        TestCorridorParam{         -10.0,         6.0,            40.0, GlobalLaneId::kCenter,  false},  // overtaking
+        TestCorridorParam{         -10.0,         6.0,            17.0, GlobalLaneId::kCenter,   true},  // behind
+        TestCorridorParam{           0.0,         2.0,            17.0, GlobalLaneId::kCenter,   true},  // left
+        TestCorridorParam{           0.0,         2.0,            17.0,   GlobalLaneId::kLeft,  false},  // to left
+        TestCorridorParam{           0.0,        10.0,            17.0,   GlobalLaneId::kLeft,   true},  // right
+        TestCorridorParam{           5.0,         8.0,            17.0, GlobalLaneId::kCenter,  false}   // cut in
+));
+// clang-format on
+
+TEST_P(OccupancyGridFixture, IsCorridorFree_GivenPredictedObject_ExpectCorridorOccupancy)
+{
+    // Given
+    const auto param = GetParam();
+    const auto data_source = GetDataSource(
+        SensorFusionBuilder()
+            .WithObjectFusion(ObjectFusionBuilder()
+                                  .WithIndex(1)
+                                  .WithFrenetCoordinates({kEgoPosition + param.object_distance, param.object_lane})
+                                  .WithVelocity(units::velocity::meters_per_second_t{param.object_velocity})
+                                  .Build())
+            .Build());
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    OccupancyGrid occupancy_grid{data_source, object_predictor};
+    occupancy_grid.Update();
+
+    // When
+    const auto is_corridor_free = occupancy_grid.IsCorridorFree(GetTrajectory(param.target_lane));
+
+    // Then
+    EXPECT_EQ(is_corridor_free, param.is_corridor_free);
+}
+
+TEST(OccupancyGridTest, Update_GivenObject_ExpectFootprintOccupiedAtPredictedPositions)
+{
+    // Given
+    const auto data_source =
+        GetDataSource(SensorFusionBuilder()
+                          .WithObjectFusion(ObjectFusionBuilder()
+                                                .WithIndex(1)
+                                                .WithFrenetCoordinates({kEgoPosition + 20.0, 6.0})
+                                                .WithVelocity(units::velocity::meters_per_second_t{10.0})
+                                                .Build())
+                          .Build());
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    OccupancyGrid occupancy_grid{data_source, object_predictor};
+
+    // When
+    occupancy_grid.Update();
+
+    // Then (object moves 10 m within 50 steps of 0.02 s, footprint of 5 m)
+    EXPECT_TRUE(occupancy_grid.IsOccupied(0U, GlobalLaneId::kCenter, kEgoPosition + 20.0));
+    EXPECT_FALSE(occupancy_grid.IsOccupied(0U, GlobalLaneId::kCenter, kEgoPosition + 30.0));
+    EXPECT_FALSE(occupancy_grid.IsOccupied(0U, GlobalLaneId::kLeft, kEgoPosition + 20.0));
+    EXPECT_TRUE(occupancy_grid.IsOccupied(50U, GlobalLaneId::kCenter, kEgoPosition + 30.0));
+    EXPECT_FALSE(occupancy_grid.IsOccupied(50U, GlobalLaneId::kCenter, kEgoPosition + 20.0));
+    EXPECT_FALSE(occupancy_grid.IsOccupied(51U, GlobalLaneId::kCenter, kEgoPosition + 30.0));
+}
+
+TEST(OccupancyGridTest, Update_GivenDenseTraffic_ExpectBoundedMemory)
+{
+    // Given
+    const auto sparse_data_source = GetDataSource(SensorFusionBuilder().Build());
+    SensorFusionBuilder sensor_fusion_builder{};
+    for (std::int32_t idx = 0; idx < 1024; ++idx)
+    {
+        const auto lane = 2.0 + (4.0 * static_cast<double>(idx % 3));
+        sensor_fusion_builder.WithObjectFusion(
+            ObjectFusionBuilder()
+                .WithIndex(idx)
+                .WithFrenetCoordinates({kEgoPosition - 200.0 + (0.4 * static_cast<double>(idx)), lane})
+                .WithVelocity(units::velocity::meters_per_second_t{20.0})
+                .Build());
+    }
+    const auto dense_data_source = GetDataSource(sensor_fusion_builder.Build());
+    ObjectPredictor sparse_object_predictor{sparse_data_source};
+    sparse_object_predictor.PredictObjects();
+    ObjectPredictor dense_object_predictor{dense_data_source};
+    dense_object_predictor.PredictObjects();
+    OccupancyGrid sparse_occupancy_grid{sparse_data_source, sparse_object_predictor};
+    OccupancyGrid dense_occupancy_grid{dense_data_source, dense_object_predictor};
+
+    // When
+    sparse_occupancy_grid.Update();
+    dense_occupancy_grid.Update();
+
+    // Then (51 steps x 3 lanes x 3 words of 64 bit for 130 bins)
+    EXPECT_EQ(sparse_occupancy_grid.GetNumberOfOccupiedCells(), 0U);
+    EXPECT_GT(dense_occupancy_grid.GetNumberOfOccupiedCells(), 0U);
+    EXPECT_EQ(sparse_occupancy_grid.GetMemoryUsage(), 51U * 3U * 3U * sizeof(std::uint64_t));
+    EXPECT_EQ(dense_occupancy_grid.GetMemoryUsage(), sparse_occupancy_grid.GetMemoryUsage());
+    EXPECT_FALSE(dense_occupancy_grid.IsCorridorFree(GetTrajectory(GlobalLaneId::kCenter)));
+}
+
+TEST(OccupancyGridTest, GetNumberOfOccupiedCells_GivenNoObjects_ExpectFreeCorridors)
+{
+    // Given
+    const auto data_source = GetDataSource(SensorFusionBuilder().Build());
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    OccupancyGrid occupancy_grid{data_source, object_predictor};
+
+    // When
+    occupancy_grid.Update();
+
+    // Then
+    for (const auto global_lane_id : {GlobalLaneId::kLeft, GlobalLaneId::kCenter, GlobalLaneId::kRight})
+    {
+        EXPECT_EQ(occupancy_grid.GetNumberOfOccupiedCells(GetTrajectory(global_lane_id)), 0U);
+    }
+}
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,84 @@
+///
+/// @file
+/// @brief Contains unit tests for Planner Pool.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/planner_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+class PlannerPoolFixture_WithNumberOfThreads : public ::testing::TestWithParam<std::size_t>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(PlannerPool, PlannerPoolFixture_WithNumberOfThreads, ::testing::Values(0U, 1U, 4U));
+
+TEST_P(PlannerPoolFixture_WithNumberOfThreads, ForEach_GivenItems_ExpectEachItemOnceInOrderOfEachPlanner)
+{
+    // Given
+    PlannerPool planner_pool{MotionPlanningOptions{}, GetParam()};
+    constexpr std::size_t kNumberOfItems{50U};
+    std::mutex mutex{};
+    std::map<const PooledPlanner*, std::vector<std::size_t>> items_of_planner{};
+
+    // When
+    planner_pool.ForEach(kNumberOfItems,
+                         [&](PooledPlanner& planner, const std::size_t item)
+                         {
+                             std::lock_guard<std::mutex> lock{mutex};
+                             items_of_planner[&planner].push_back(item);
+                         });
+
+    // Then
+    std::vector<std::size_t> actual{};
+    for (const auto& planner_items : items_of_planner)
+    {
+        EXPECT_TRUE(std::is_sorted(planner_items.second.begin(), planner_items.second.end()));
+        actual.insert(actual.end(), planner_items.second.begin(), planner_items.second.end());
+    }
+    std::sort(actual.begin(), actual.end());
+    ASSERT_EQ(actual.size(), kNumberOfItems);
+    for (std::size_t item = 0U; item < kNumberOfItems; ++item)
+    {
+        EXPECT_EQ(actual[item], item);
+    }
+    EXPECT_LE(items_of_planner.size(), planner_pool.GetNumberOfPlanners());
+}
+
+TEST_P(PlannerPoolFixture_WithNumberOfThreads, GetNumberOfPlanners_ExpectOnePerThread)
+{
+    // Given
+    PlannerPool planner_pool{MotionPlanningOptions{}, GetParam()};
+
+    // When
+    const auto actual = planner_pool.GetNumberOfPlanners();
+
+    // Then
+    EXPECT_EQ(actual, std::max(GetParam(), std::size_t{1U}));
+}
+
+TEST(PlannerPool, ForEach_GivenNoItems_ExpectNoJob)
+{
+    // Given
+    PlannerPool planner_pool{MotionPlanningOptions{}, 2U};
+    std::size_t number_of_jobs{0U};
+
+    // When
+    planner_pool.ForEach(0U, [&number_of_jobs](PooledPlanner&, const std::size_t) { ++number_of_jobs; });
+
+    // Then
+    EXPECT_EQ(number_of_jobs, 0U);
+}
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,146 @@
+///
+/// @file
+/// @brief Contains unit tests for Planning Watchdog.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/planning_watchdog.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+
+namespace planning
+{
+namespace
+{
+/// @brief Distance between consecutive waypoints
+double GetDistance(const GlobalCoordinates& lhs, const GlobalCoordinates& rhs)
+{
+    return std::hypot(rhs.x - lhs.x, rhs.y - lhs.y);
+}
+
+class PlanningWatchdogFixture : public ::testing::Test
+{
+  protected:
+    const DataSource data_source_{DataSourceBuilder()
+                                      .WithPreviousPath(PreviousPathGlobal{})
+                                      .WithMapCoordinates(kHighwayMap)
+                                      .WithGlobalLaneId(GlobalLaneId::kCenter)
+                                      .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+                                      .Build()};
+};
+
+TEST_F(PlanningWatchdogFixture, GetTrajectory_GivenSufficientResponseTime_ExpectSelectedTrajectory)
+{
+    // Given
+    WatchdogOptions watchdog_options{};
+    watchdog_options.response_time = std::chrono::seconds{10};
+    PlanningWatchdog watchdog{MotionPlanningOptions{}, watchdog_options};
+    auto motion_planning = MotionPlanning{data_source_};
+    motion_planning.GenerateTrajectories();
+
+    // When
+    const auto actual = watchdog.GetTrajectory(data_source_);
+
+    // Then
+    const auto expected = motion_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    EXPECT_EQ(actual.lane_id, expected.lane_id);
+    ASSERT_EQ(actual.waypoints.size(), expected.waypoints.size());
+    for (std::size_t idx = 0U; idx < actual.waypoints.size(); ++idx)
+    {
+        EXPECT_DOUBLE_EQ(actual.waypoints[idx].x, expected.waypoints[idx].x);
+        EXPECT_DOUBLE_EQ(actual.waypoints[idx].y, expected.waypoints[idx].y);
+    }
+    const auto statistics = watchdog.GetStatistics();
+    EXPECT_EQ(statistics.frames, 1U);
+    EXPECT_EQ(statistics.overruns, 0U);
+}
+
+TEST_F(PlanningWatchdogFixture, GetTrajectory_GivenExceededResponseTime_ExpectFallbackTrajectory)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    options.lattice_options.number_of_velocities = 10U;
+    options.lattice_options.number_of_horizons = 12U;
+    options.trajectory_optimizer_type = TrajectoryOptimizerType::kFrenetPolynomial;
+    WatchdogOptions watchdog_options{};
+    watchdog_options.response_time = std::chrono::system_clock::duration::zero();
+    PlanningWatchdog watchdog{options, watchdog_options};
+
+    // When
+    const auto actual = watchdog.GetTrajectory(data_source_);
+
+    // Then
+    const auto expected = watchdog.GetFallbackTrajectory(data_source_);
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    EXPECT_EQ(actual.lane_id, LaneId::kEgo);
+    ASSERT_EQ(actual.waypoints.size(), expected.waypoints.size());
+    for (std::size_t idx = 0U; idx < actual.waypoints.size(); ++idx)
+    {
+        EXPECT_DOUBLE_EQ(actual.waypoints[idx].x, expected.waypoints[idx].x);
+        EXPECT_DOUBLE_EQ(actual.waypoints[idx].y, expected.waypoints[idx].y);
+    }
+    const auto statistics = watchdog.GetStatistics();
+    EXPECT_EQ(statistics.frames, 1U);
+    EXPECT_EQ(statistics.overruns, 1U);
+}
+
+TEST(PlanningWatchdog, GetFallbackTrajectory_GivenPreviousPath_ExpectDeceleratingExtension)
+{
+    // Given
+    const auto d = 6.0;
+    const auto spacing = 0.4;
+    FrenetToGlobalConverter to_global{kHighwayMap};
+    PreviousPathGlobal previous_path{};
+    for (std::size_t idx = 0U; idx < 20U; ++idx)
+    {
+        previous_path.push_back(to_global(100.0 + (spacing * static_cast<double>(idx)), d));
+    }
+    const auto data_source = DataSourceBuilder()
+                                 .WithMapCoordinates(kHighwayMap)
+                                 .WithPreviousPath(previous_path)
+                                 .WithPreviousPathEnd(FrenetCoordinates{100.0 + (spacing * 19.0), d, 0.0, 0.0})
+                                 .Build();
+    const PlanningWatchdog watchdog{MotionPlanningOptions{}, WatchdogOptions{}};
+
+    // When
+    const auto actual = watchdog.GetFallbackTrajectory(data_source);
+
+    // Then
+    EXPECT_EQ(GetPreviousPathSize(actual), 20U);
+    ASSERT_EQ(actual.waypoints.size(), 30U);
+    EXPECT_NEAR(actual.velocity.value(), spacing / 0.02, 0.1);
+    const auto first_spacing = GetDistance(previous_path.back(), actual.waypoints.front());
+    const auto last_spacing = GetDistance(actual.waypoints[28U], actual.waypoints[29U]);
+    EXPECT_NEAR(first_spacing, spacing, 0.01);
+    EXPECT_LT(last_spacing, first_spacing - 0.02);
+}
+
+TEST(PlanningWatchdog, GetFallbackTrajectory_GivenStandstill_ExpectStandstill)
+{
+    // Given
+    const auto data_source = DataSourceBuilder()
+                                 .WithMapCoordinates(kHighwayMap)
+                                 .WithPreviousPath(PreviousPathGlobal{})
+                                 .WithVelocity(units::velocity::meters_per_second_t{0.0})
+                                 .Build();
+    const PlanningWatchdog watchdog{MotionPlanningOptions{}, WatchdogOptions{}};
+
+    // When
+    const auto actual = watchdog.GetFallbackTrajectory(data_source);
+
+    // Then
+    ASSERT_EQ(actual.waypoints.size(), 50U);
+    EXPECT_DOUBLE_EQ(GetDistance(actual.waypoints.front(), actual.waypoints.back()), 0.0);
+}
+}  // namespace
+}  // namespace planning
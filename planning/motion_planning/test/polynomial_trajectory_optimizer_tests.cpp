@@ -0,0 +1,113 @@
+///
+/// @file
+/// @brief Contains unit tests for Polynomial Trajectory Optimizer.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/polynomial_trajectory_optimizer.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/builders/trajectory_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <units.h>
+
+#include <cmath>
+
+namespace planning
+{
+namespace
+{
+using GlobalLaneId = LaneInformation::GlobalLaneId;
+using LaneId = LaneInformation::LaneId;
+
+class PolynomialTrajectoryOptimizerFixture : public ::testing::TestWithParam<GlobalLaneId>
+{
+  protected:
+    const DataSource data_source_{DataSourceBuilder()
+                                      .WithPreviousPath(PreviousPathGlobal{})
+                                      .WithMapCoordinates(kHighwayMap)
+                                      .WithFrenetCoordinates(FrenetCoordinates{100.0, 6.0, 0.0, 0.0})
+                                      .WithVelocity(units::velocity::meters_per_second_t{20.0})
+                                      .Build()};
+    const units::velocity::meters_per_second_t target_velocity_{20.0};
+};
+
+INSTANTIATE_TEST_SUITE_P(PolynomialTrajectoryOptimizer,
+                         PolynomialTrajectoryOptimizerFixture,
+                         ::testing::Values(GlobalLaneId::kLeft, GlobalLaneId::kCenter, GlobalLaneId::kRight));
+
+TEST_P(PolynomialTrajectoryOptimizerFixture, GetOptimizedTrajectory_GivenTargetLane_ExpectWaypointsPerTick)
+{
+    // Given
+    const auto planned_trajectory =
+        TrajectoryBuilder().WithTargetVelocity(target_velocity_).WithGlobalLaneId(GetParam()).Build();
+    const auto unit = PolynomialTrajectoryOptimizer{data_source_};
+
+    // When
+    const auto actual = unit.GetOptimizedTrajectory(planned_trajectory);
+
+    // Then
+    ASSERT_EQ(actual.waypoints.size(), 50U);
+    for (std::size_t idx = 1U; idx < actual.waypoints.size(); ++idx)
+    {
+        const auto distance = std::hypot(actual.waypoints[idx].x - actual.waypoints[idx - 1U].x,
+                                         actual.waypoints[idx].y - actual.waypoints[idx - 1U].y);
+        // lateral motion adds a little to the travelled distance per tick (20 m/s => 0.4 m)
+        EXPECT_NEAR(distance, 0.4, 0.05);
+    }
+}
+
+TEST_F(PolynomialTrajectoryOptimizerFixture, GetOptimizedTrajectories_GivenUnknownHorizon_ExpectSameAsPreparedSolver)
+{
+    // Given
+    auto planned_trajectory =
+        TrajectoryBuilder().WithTargetVelocity(target_velocity_).WithGlobalLaneId(GlobalLaneId::kLeft).Build();
+    planned_trajectory.horizon = units::length::meter_t{50.0};
+    const auto prepared = PolynomialTrajectoryOptimizer{data_source_, {units::length::meter_t{50.0}}};
+    const auto unprepared = PolynomialTrajectoryOptimizer{data_source_};
+
+    // When
+    const auto expected = prepared.GetOptimizedTrajectories(Trajectories{planned_trajectory});
+    const auto actual = unprepared.GetOptimizedTrajectories(Trajectories{planned_trajectory});
+
+    // Then
+    ASSERT_EQ(actual.size(), 1U);
+    ASSERT_EQ(actual[0].waypoints.size(), expected[0].waypoints.size());
+    for (std::size_t idx = 0U; idx < actual[0].waypoints.size(); ++idx)
+    {
+        EXPECT_DOUBLE_EQ(actual[0].waypoints[idx].x, expected[0].waypoints[idx].x);
+        EXPECT_DOUBLE_EQ(actual[0].waypoints[idx].y, expected[0].waypoints[idx].y);
+    }
+}
+
+TEST(PolynomialTrajectoryOptimizerTest, GetOptimizedTrajectory_GivenPreviousPath_ExpectPreviousPathContinued)
+{
+    // Given
+    const auto previous_path = PreviousPathGlobal{GlobalCoordinates{1.0, 2.0}, GlobalCoordinates{2.0, 2.0}};
+    const auto data_source =
+        DataSourceBuilder().WithPreviousPath(previous_path).WithMapCoordinates(kHighwayMap).Build();
+    const auto planned_trajectory = TrajectoryBuilder().Build();
+
+    // When
+    const auto actual = PolynomialTrajectoryOptimizer{data_source}.GetOptimizedTrajectory(planned_trajectory);
+
+    // Then
+    EXPECT_EQ(actual.previous_path, data_source.GetSharedPreviousPath());
+    EXPECT_EQ(actual.waypoints.size(), 50U - previous_path.size());
+}
+
+TEST(PolynomialTrajectoryOptimizerTest, GetOptimizedTrajectory_GivenMapWithoutSegments_ExpectNoWaypoints)
+{
+    // Given
+    const auto data_source = DataSourceBuilder().WithPreviousPath(PreviousPathGlobal{}).Build();
+
+    // When
+    const auto actual = PolynomialTrajectoryOptimizer{data_source}.GetOptimizedTrajectory(TrajectoryBuilder().Build());
+
+    // Then
+    EXPECT_TRUE(actual.waypoints.empty());
+}
+
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,160 @@
+///
+/// @file
+/// @brief Contains unit tests for Replay Planning.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/replay_planning.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+class ReplayPlanningFixture_WithNumberOfThreads : public ::testing::TestWithParam<std::size_t>
+{
+  public:
+    ReplayPlanningFixture_WithNumberOfThreads() : options_{}, replay_options_{}, drives_{}
+    {
+        replay_options_.number_of_threads = GetParam();
+
+        // drives of different lengths, each ego lane following a slower object in the center lane
+        std::size_t number_of_frames{2U};
+        for (const auto ego_lane : {GlobalLaneId::kLeft, GlobalLaneId::kCenter, GlobalLaneId::kRight})
+        {
+            RecordedDrive drive{};
+            for (std::size_t frame = 0U; frame < number_of_frames; ++frame)
+            {
+                drive.push_back(DataSourceBuilder()
+                                    .WithPreviousPath(PreviousPathGlobal{})
+                                    .WithMapCoordinates(kHighwayMap)
+                                    .WithDistance(units::length::meter_t{24.0 + static_cast<double>(frame)})
+                                    .WithGlobalLaneId(ego_lane)
+                                    .WithObjectInLane(GlobalLaneId::kCenter, units::velocity::meters_per_second_t{5.0})
+                                    .Build());
+            }
+            drives_.push_back(drive);
+            number_of_frames += 2U;
+        }
+    }
+
+  protected:
+    /// @brief Summary of a freshly constructed Motion Planning planning all the frames of given drive in order
+    ReplaySummary GetExpectedSummary(const RecordedDrive& drive) const
+    {
+        ReplaySummary expected{};
+        DataSource data_source{};
+        auto motion_planning = MotionPlanning{data_source, options_};
+        for (const auto& frame : drive)
+        {
+            data_source = frame;
+            motion_planning.GenerateTrajectories();
+            const auto selected_trajectory = motion_planning.GetSelectedTrajectory();
+            ++expected.frames;
+            expected.velocity_sum += selected_trajectory.velocity.value();
+            expected.lane_change_frames += (selected_trajectory.lane_id != LaneId::kEgo) ? 1U : 0U;
+            expected.empty_frames += selected_trajectory.waypoints.empty() ? 1U : 0U;
+        }
+        return expected;
+    }
+
+    MotionPlanningOptions options_;
+    ReplayOptions replay_options_;
+    std::vector<RecordedDrive> drives_;
+};
+
+INSTANTIATE_TEST_SUITE_P(ReplayPlanning, ReplayPlanningFixture_WithNumberOfThreads, ::testing::Values(0U, 1U, 4U));
+
+TEST_P(ReplayPlanningFixture_WithNumberOfThreads, Replay_GivenDrives_ExpectSameAsSequentialPlanningOfEachDrive)
+{
+    // Given
+    ReplayPlanning replay_planning{options_, replay_options_};
+
+    // When
+    replay_planning.Replay(drives_);
+
+    // Then
+    const auto& actual = replay_planning.GetDriveSummaries();
+    ASSERT_EQ(actual.size(), drives_.size());
+    for (std::size_t drive = 0U; drive < drives_.size(); ++drive)
+    {
+        const auto expected = GetExpectedSummary(drives_[drive]);
+        EXPECT_EQ(actual[drive].drives, 1U) << "drive: " << drive;
+        EXPECT_EQ(actual[drive].frames, expected.frames) << "drive: " << drive;
+        EXPECT_EQ(actual[drive].lane_change_frames, expected.lane_change_frames) << "drive: " << drive;
+        EXPECT_EQ(actual[drive].empty_frames, expected.empty_frames) << "drive: " << drive;
+        EXPECT_DOUBLE_EQ(actual[drive].velocity_sum, expected.velocity_sum) << "drive: " << drive;
+        EXPECT_EQ(actual[drive].latency.GetCount(), expected.frames) << "drive: " << drive;
+    }
+}
+
+TEST_P(ReplayPlanningFixture_WithNumberOfThreads, Replay_GivenDrives_ExpectMergedSummaryOfAllDrives)
+{
+    // Given
+    ReplayPlanning replay_planning{options_, replay_options_};
+
+    // When
+    const auto actual = replay_planning.Replay(drives_);
+
+    // Then
+    std::size_t number_of_frames{0U};
+    double velocity_sum{0.0};
+    for (const auto& drive_summary : replay_planning.GetDriveSummaries())
+    {
+        number_of_frames += drive_summary.frames;
+        velocity_sum += drive_summary.velocity_sum;
+    }
+    EXPECT_EQ(actual.drives, drives_.size());
+    EXPECT_EQ(actual.frames, number_of_frames);
+    EXPECT_EQ(actual.latency.GetCount(), number_of_frames);
+    EXPECT_DOUBLE_EQ(actual.velocity_sum, velocity_sum);
+    EXPECT_GT(actual.GetMeanVelocity(), 0.0);
+}
+
+TEST_P(ReplayPlanningFixture_WithNumberOfThreads, Replay_GivenReversedDrives_ExpectSameSummaryOfEachDrive)
+{
+    // Given
+    ReplayPlanning replay_planning{options_, replay_options_};
+    replay_planning.Replay(drives_);
+    const auto expected = replay_planning.GetDriveSummaries();
+    std::reverse(drives_.begin(), drives_.end());
+
+    // When
+    replay_planning.Replay(drives_);
+
+    // Then
+    auto actual = replay_planning.GetDriveSummaries();
+    std::reverse(actual.begin(), actual.end());
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t drive = 0U; drive < actual.size(); ++drive)
+    {
+        EXPECT_EQ(actual[drive].lane_change_frames, expected[drive].lane_change_frames) << "drive: " << drive;
+        EXPECT_DOUBLE_EQ(actual[drive].velocity_sum, expected[drive].velocity_sum) << "drive: " << drive;
+    }
+}
+
+TEST_P(ReplayPlanningFixture_WithNumberOfThreads, Replay_GivenNoDrives_ExpectEmptySummary)
+{
+    // Given
+    ReplayPlanning replay_planning{options_, replay_options_};
+
+    // When
+    const auto actual = replay_planning.Replay(std::vector<RecordedDrive>{});
+
+    // Then
+    EXPECT_EQ(actual.drives, 0U);
+    EXPECT_EQ(actual.frames, 0U);
+    EXPECT_TRUE(replay_planning.GetDriveSummaries().empty());
+    EXPECT_EQ(replay_planning.GetNumberOfShards(), std::max(GetParam(), std::size_t{1U}));
+}
+
+}  // namespace
+}  // namespace planning
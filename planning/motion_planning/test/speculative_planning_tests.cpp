@@ -0,0 +1,192 @@
+///
+/// @file
+/// @brief Contains unit tests for Speculative Planning.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/speculative_planning.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+namespace
+{
+/// @brief Number of waypoints consumed by the simulator between consecutive frames
+constexpr std::size_t kConsumedWaypoints{5U};
+
+/// @brief Ego in the center lane, localized consistently on the map (global and Frenet Coordinates)
+VehicleDynamics GetVehicleDynamics()
+{
+    VehicleDynamics vehicle_dynamics{};
+    vehicle_dynamics.frenet_coords = FrenetCoordinates{24.0, 6.0, 0.0, 0.0};
+    vehicle_dynamics.global_coords = FrenetToGlobalConverter{kHighwayMap}(24.0, 6.0);
+    vehicle_dynamics.velocity = units::velocity::meters_per_second_t{17.0};
+    vehicle_dynamics.yaw = units::angle::radian_t{std::atan2(1134.93 - 1135.571, 815.2679 - 784.6001)};
+    return vehicle_dynamics;
+}
+
+class SpeculativePlanningFixture : public ::testing::Test
+{
+  protected:
+    /// @brief Expect same waypoints as Motion Planning (without speculation) planning given sequence of frames
+    static void ExpectSelectedTrajectory(const Trajectory& actual, const std::vector<DataSource>& frames)
+    {
+        DataSource data_source{};
+        auto motion_planning = MotionPlanning{data_source};
+        for (const auto& frame : frames)
+        {
+            data_source = frame;
+            motion_planning.GenerateTrajectories();
+        }
+        const auto expected = motion_planning.GetSelectedTrajectory();
+        EXPECT_EQ(actual.unique_id, expected.unique_id);
+        EXPECT_EQ(actual.velocity, expected.velocity);
+        EXPECT_EQ(GetPreviousPathSize(actual), GetPreviousPathSize(expected));
+        ASSERT_EQ(actual.waypoints.size(), expected.waypoints.size());
+        for (std::size_t idx = 0U; idx < actual.waypoints.size(); ++idx)
+        {
+            EXPECT_DOUBLE_EQ(actual.waypoints[idx].x, expected.waypoints[idx].x);
+            EXPECT_DOUBLE_EQ(actual.waypoints[idx].y, expected.waypoints[idx].y);
+        }
+    }
+
+    const DataSource data_source_{DataSourceBuilder()
+                                      .WithPreviousPath(PreviousPathGlobal{})
+                                      .WithMapCoordinates(kHighwayMap)
+                                      .WithVehicleDynamics(GetVehicleDynamics())
+                                      .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+                                      .Build()};
+};
+
+TEST_F(SpeculativePlanningFixture, GetPredictedDataSource_GivenSentTrajectory_ExpectRemainingWaypoints)
+{
+    // Given
+    auto motion_planning = MotionPlanning{data_source_};
+    motion_planning.GenerateTrajectories();
+    const auto sent_trajectory = motion_planning.GetSelectedTrajectory();
+    ASSERT_GT(sent_trajectory.waypoints.size(), kConsumedWaypoints + 1U);
+
+    // When
+    const auto actual =
+        SpeculativePlanning::GetPredictedDataSource(data_source_, sent_trajectory, kConsumedWaypoints);
+
+    // Then
+    const auto previous_path = actual.GetPreviousPathInGlobalCoords();
+    ASSERT_EQ(previous_path.size(), sent_trajectory.waypoints.size() - kConsumedWaypoints);
+    EXPECT_DOUBLE_EQ(previous_path.front().x, sent_trajectory.waypoints[kConsumedWaypoints].x);
+    EXPECT_DOUBLE_EQ(previous_path.back().y, sent_trajectory.waypoints.back().y);
+    const auto vehicle_dynamics = actual.GetVehicleDynamics();
+    EXPECT_DOUBLE_EQ(vehicle_dynamics.global_coords.x, sent_trajectory.waypoints[kConsumedWaypoints - 1U].x);
+    EXPECT_DOUBLE_EQ(vehicle_dynamics.frenet_coords.s, actual.GetPreviousPathEnd().s);
+    const auto object = actual.GetSensorFusion().objs.front();
+    const auto received_object = data_source_.GetSensorFusion().objs.front();
+    EXPECT_NEAR(object.frenet_coords.s - received_object.frenet_coords.s, 10.0 * 0.02 * kConsumedWaypoints, 1e-9);
+}
+
+TEST_F(SpeculativePlanningFixture, GetTrajectory_GivenPredictedFrame_ExpectSpeculativeResult)
+{
+    // Given
+    SpeculativePlanning speculative_planning{MotionPlanningOptions{}, SpeculationOptions{}};
+    const auto first_trajectory = speculative_planning.GetTrajectory(data_source_);
+    const auto second_frame =
+        SpeculativePlanning::GetPredictedDataSource(data_source_, first_trajectory, kConsumedWaypoints);
+    const auto second_trajectory = speculative_planning.GetTrajectory(second_frame);
+    const auto third_frame =
+        SpeculativePlanning::GetPredictedDataSource(second_frame, second_trajectory, kConsumedWaypoints);
+
+    // When
+    const auto actual = speculative_planning.GetTrajectory(third_frame);
+
+    // Then
+    ExpectSelectedTrajectory(actual, {data_source_, second_frame, third_frame});
+    const auto statistics = speculative_planning.GetStatistics();
+    EXPECT_EQ(statistics.frames, 3U);
+    EXPECT_EQ(statistics.speculations, 2U);
+    EXPECT_EQ(statistics.hits, 1U);
+    EXPECT_EQ(statistics.misses, 0U);
+}
+
+TEST_F(SpeculativePlanningFixture, GetTrajectory_GivenDeviatingFrame_ExpectPlannedAgain)
+{
+    // Given
+    SpeculativePlanning speculative_planning{MotionPlanningOptions{}, SpeculationOptions{}};
+    const auto first_trajectory = speculative_planning.GetTrajectory(data_source_);
+    const auto second_frame =
+        SpeculativePlanning::GetPredictedDataSource(data_source_, first_trajectory, kConsumedWaypoints);
+    const auto second_trajectory = speculative_planning.GetTrajectory(second_frame);
+    const auto predicted_frame =
+        SpeculativePlanning::GetPredictedDataSource(second_frame, second_trajectory, kConsumedWaypoints);
+    auto third_frame = predicted_frame;
+    auto sensor_fusion = third_frame.GetSensorFusion();
+    sensor_fusion.objs.front().frenet_coords.s += 5.0;
+    third_frame.SetSensorFusion(sensor_fusion);
+
+    // When
+    const auto actual = speculative_planning.GetTrajectory(third_frame);
+
+    // Then (predicted frame leaves no trace)
+    ExpectSelectedTrajectory(actual, {data_source_, second_frame, third_frame});
+    const auto statistics = speculative_planning.GetStatistics();
+    EXPECT_EQ(statistics.hits, 0U);
+    EXPECT_EQ(statistics.misses, 1U);
+}
+
+TEST_F(SpeculativePlanningFixture, GetTrajectory_GivenConsecutiveMisses_ExpectTargetVelocityWithoutSpeculation)
+{
+    // Given
+    SpeculativePlanning speculative_planning{MotionPlanningOptions{}, SpeculationOptions{}};
+    DataSource data_source{};
+    auto motion_planning = MotionPlanning{data_source};
+    auto frame = data_source_;
+    Trajectory actual{};
+    Trajectory expected{};
+
+    // When (object deviates from its prediction in every frame)
+    for (std::size_t idx = 0U; idx < 5U; ++idx)
+    {
+        actual = speculative_planning.GetTrajectory(frame);
+        data_source = frame;
+        motion_planning.GenerateTrajectories();
+        expected = motion_planning.GetSelectedTrajectory();
+
+        frame = SpeculativePlanning::GetPredictedDataSource(frame, actual, kConsumedWaypoints);
+        auto sensor_fusion = frame.GetSensorFusion();
+        sensor_fusion.objs.front().frenet_coords.s += 5.0;
+        frame.SetSensorFusion(sensor_fusion);
+    }
+
+    // Then
+    EXPECT_EQ(actual.velocity, expected.velocity);
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    const auto statistics = speculative_planning.GetStatistics();
+    EXPECT_EQ(statistics.hits, 0U);
+    EXPECT_GT(statistics.misses, 0U);
+}
+
+TEST_F(SpeculativePlanningFixture, IsPredicted_GivenDifferentConsumedWaypoints_ExpectNotPredicted)
+{
+    // Given
+    auto motion_planning = MotionPlanning{data_source_};
+    motion_planning.GenerateTrajectories();
+    const auto sent_trajectory = motion_planning.GetSelectedTrajectory();
+    const auto predicted = SpeculativePlanning::GetPredictedDataSource(data_source_, sent_trajectory, 5U);
+    const auto received = SpeculativePlanning::GetPredictedDataSource(data_source_, sent_trajectory, 6U);
+
+    // When
+    const auto actual = SpeculativePlanning::IsPredicted(received, predicted, SpeculationOptions{});
+
+    // Then
+    EXPECT_FALSE(actual);
+    EXPECT_TRUE(SpeculativePlanning::IsPredicted(predicted, predicted, SpeculationOptions{}));
+}
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,105 @@
+///
+/// @file
+/// @brief Contains component tests for Static Motion Planning.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/static_motion_planning.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace planning
+{
+namespace
+{
+class StaticMotionPlanningFixture : public ::testing::Test
+{
+  protected:
+    /// @brief Plan consecutive frames with both variants and expect the same selected trajectories
+    template <typename StaticMotionPlanningT>
+    void ExpectSameResultAsMotionPlanning(const MotionPlanningOptions& options) const
+    {
+        auto motion_planning = MotionPlanning{data_source_, options};
+        StaticMotionPlanningT static_motion_planning{data_source_, options};
+
+        for (auto frame = 0; frame < 3; ++frame)
+        {
+            motion_planning.GenerateTrajectories();
+            static_motion_planning.GenerateTrajectories();
+
+            const auto expected = motion_planning.GetSelectedTrajectory();
+            const auto actual = static_motion_planning.GetSelectedTrajectory();
+            EXPECT_EQ(actual.unique_id, expected.unique_id);
+            EXPECT_EQ(actual.lane_id, expected.lane_id);
+            EXPECT_EQ(actual.velocity, expected.velocity);
+            EXPECT_DOUBLE_EQ(actual.cost, expected.cost);
+            ASSERT_EQ(actual.waypoints.size(), expected.waypoints.size());
+            for (std::size_t idx = 0U; idx < actual.waypoints.size(); ++idx)
+            {
+                EXPECT_DOUBLE_EQ(actual.waypoints[idx].x, expected.waypoints[idx].x);
+                EXPECT_DOUBLE_EQ(actual.waypoints[idx].y, expected.waypoints[idx].y);
+            }
+        }
+        EXPECT_EQ(static_motion_planning.GetEvaluationStatistics().evaluated,
+                  motion_planning.GetEvaluationStatistics().evaluated);
+        EXPECT_EQ(static_motion_planning.GetManeuverPruningStatistics().GetRejected(),
+                  motion_planning.GetManeuverPruningStatistics().GetRejected());
+    }
+
+    const DataSource data_source_{DataSourceBuilder()
+                                      .WithPreviousPath(PreviousPathGlobal{})
+                                      .WithMapCoordinates(kHighwayMap)
+                                      .WithGlobalLaneId(GlobalLaneId::kCenter)
+                                      .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+                                      .Build()};
+};
+
+TEST_F(StaticMotionPlanningFixture, GenerateTrajectories_GivenDefaultStages_ExpectSameResultAsMotionPlanning)
+{
+    ExpectSameResultAsMotionPlanning<StaticMotionPlanning<>>(MotionPlanningOptions{});
+}
+
+TEST_F(StaticMotionPlanningFixture, GenerateTrajectories_GivenLatticeAndPolynomials_ExpectSameResultAsMotionPlanning)
+{
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    options.trajectory_optimizer_type = TrajectoryOptimizerType::kFrenetPolynomial;
+    options.cost_options.progress_weight = 1.0;
+    options.cost_options.jerk_weight = 0.01;
+    options.evaluation_type = EvaluationType::kBranchAndBound;
+
+    ExpectSameResultAsMotionPlanning<StaticMotionPlanning<VelocityPlanner,
+                                                          LatticeManeuverGenerator,
+                                                          TrajectoryPlanner,
+                                                          PolynomialTrajectoryOptimizer>>(options);
+}
+
+TEST_F(StaticMotionPlanningFixture, GenerateTrajectories_GivenCollisionCheckingAndGrid_ExpectSameResultAsMotionPlanning)
+{
+    MotionPlanningOptions options{};
+    options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+    options.collision_checking = true;
+    options.occupancy_evaluation_type = OccupancyEvaluationType::kOccupancyGrid;
+
+    ExpectSameResultAsMotionPlanning<StaticMotionPlanning<VelocityPlanner, LatticeManeuverGenerator>>(options);
+}
+
+TEST_F(StaticMotionPlanningFixture, GenerateTrajectories_GivenConsecutiveFrames_ExpectFrameArenaReused)
+{
+    // Given
+    StaticMotionPlanning<> static_motion_planning{data_source_};
+    static_motion_planning.GenerateTrajectories();
+    const auto capacity = static_motion_planning.GetFrameArena().GetCapacity();
+
+    // When
+    static_motion_planning.GenerateTrajectories();
+
+    // Then
+    EXPECT_EQ(static_motion_planning.GetFrameArena().GetCapacity(), capacity);
+    EXPECT_GT(static_motion_planning.GetSelectedTrajectory().waypoints.size(), 0U);
+}
+}  // namespace
+}  // namespace planning
@@ -0,0 +1,40 @@
+///
+/// @file
+/// @brief Contains Sensor Fusion of typical traffic (any number of objects) for benchmarks.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_TEST_SUPPORT_SENSOR_FUSION_H
+#define PLANNING_MOTION_PLANNING_TEST_SUPPORT_SENSOR_FUSION_H
+
+#include "planning/datatypes/sensor_fusion.h"
+#include "planning/motion_planning/test/support/builders/object_fusion_builder.h"
+#include "planning/motion_planning/test/support/builders/sensor_fusion_builder.h"
+
+#include <units.h>
+
+#include <cstdint>
+
+namespace planning
+{
+
+/// @brief Sensor Fusion with given number of objects spread over all lanes, from s=100 over given longitudinal range
+/// (in meters, at least 1), 15 to 19 m/s
+inline SensorFusion GetSensorFusion(const std::int64_t number_of_objects, const std::int64_t longitudinal_range)
+{
+    SensorFusionBuilder sensor_fusion_builder{};
+    for (std::int64_t idx = 0; idx < number_of_objects; ++idx)
+    {
+        const auto s = 100.0 + static_cast<double>((idx * 7) % longitudinal_range);
+        const auto d = 2.0 + (4.0 * static_cast<double>(idx % 3));
+        sensor_fusion_builder.WithObjectFusion(
+            ObjectFusionBuilder()
+                .WithIndex(static_cast<std::int32_t>(idx))
+                .WithFrenetCoordinates(FrenetCoordinates{s, d})
+                .WithVelocity(units::velocity::meters_per_second_t{15.0 + static_cast<double>(idx % 5)})
+                .Build());
+    }
+    return sensor_fusion_builder.Build();
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_TEST_SUPPORT_SENSOR_FUSION_H
@@ -0,0 +1,226 @@
+///
+/// @file
+/// @brief Contains unit tests for Trajectory Cost Function.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/builders/object_fusion_builder.h"
+#include "planning/motion_planning/test/support/builders/sensor_fusion_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+#include "planning/motion_planning/trajectory_cost_function.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <units.h>
+
+#include <cmath>
+#include <limits>
+
+namespace planning
+{
+namespace
+{
+/// @brief Number of waypoints of the test trajectories
+constexpr std::size_t kNumberOfWaypoints{100U};
+
+/// @brief Trajectory along the x axis, x(t) = velocity * t + 0.5 * acceleration * t^2 (one waypoint per tick)
+Trajectory GetStraightTrajectory(const double velocity, const double acceleration, const LaneId lane_id)
+{
+    Trajectory trajectory{};
+    trajectory.lane_id = lane_id;
+    for (std::size_t tick = 1U; tick <= kNumberOfWaypoints; ++tick)
+    {
+        const auto time = static_cast<double>(tick) * kWaypointSamplingTime;
+        trajectory.waypoints.push_back(
+            GlobalCoordinates{(velocity * time) + (0.5 * acceleration * time * time), 0.0});
+    }
+    return trajectory;
+}
+
+/// @brief Trajectory along a circle of given radius (starting at origin, along the x axis)
+Trajectory GetCircularTrajectory(const double velocity, const double radius)
+{
+    Trajectory trajectory{};
+    trajectory.lane_id = LaneId::kEgo;
+    for (std::size_t tick = 1U; tick <= kNumberOfWaypoints; ++tick)
+    {
+        const auto angle = velocity * static_cast<double>(tick) * kWaypointSamplingTime / radius;
+        trajectory.waypoints.push_back(GlobalCoordinates{radius * std::sin(angle), radius * (1.0 - std::cos(angle))});
+    }
+    return trajectory;
+}
+
+/// @brief Cost options with all the terms enabled (unit weights)
+CostOptions GetAllTermsOptions()
+{
+    CostOptions options{};
+    options.progress_weight = 1.0;
+    options.lateral_offset_weight = 1.0;
+    options.jerk_weight = 1.0;
+    options.acceleration_weight = 1.0;
+    options.curvature_weight = 1.0;
+    options.proximity_weight = 1.0;
+    options.lane_change_weight = 1.0;
+    return options;
+}
+
+class TrajectoryCostFunctionFixture : public ::testing::Test
+{
+  public:
+    TrajectoryCostFunctionFixture()
+        : data_source_{DataSourceBuilder().WithSpeedLimit(units::velocity::meters_per_second_t{20.0}).Build()},
+          object_predictor_{data_source_}
+    {
+        object_predictor_.PredictObjects();
+    }
+
+  protected:
+    const DataSource data_source_;
+    ObjectPredictor object_predictor_;
+};
+
+TEST_F(TrajectoryCostFunctionFixture, Evaluate_GivenDefaultOptions_ExpectLaneChangePenaltyOnly)
+{
+    // Given
+    const TrajectoryCostFunction cost_function{data_source_};
+    const Trajectories candidates{GetStraightTrajectory(10.0, 0.0, LaneId::kEgo),
+                                  GetStraightTrajectory(10.0, 0.0, LaneId::kLeft),
+                                  GetStraightTrajectory(10.0, 0.0, LaneId::kRight)};
+
+    // When
+    const auto actual = cost_function.Evaluate(candidates);
+
+    // Then
+    EXPECT_THAT(actual.costs, ::testing::ElementsAre(0.0, 1.0, 1.0));
+    EXPECT_TRUE(cost_function.IsEnabled(CostTerm::kLaneChange));
+    EXPECT_FALSE(cost_function.IsEnabled(CostTerm::kJerk));
+    EXPECT_TRUE(actual.terms[static_cast<std::size_t>(CostTerm::kJerk)].empty());
+    EXPECT_EQ(actual.GetDuration(CostTerm::kJerk).count(), 0);
+}
+
+TEST_F(TrajectoryCostFunctionFixture, Evaluate_GivenConstantVelocityAlongHeading_ExpectOnlyMissingProgress)
+{
+    // Given
+    const TrajectoryCostFunction cost_function{data_source_, &object_predictor_, GetAllTermsOptions()};
+
+    // When
+    const auto actual = cost_function.Evaluate({GetStraightTrajectory(10.0, 0.0, LaneId::kEgo)});
+
+    // Then (half of the speed limit)
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kProgress, 0U), 0.5, 1e-9);
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kLateralOffset, 0U), 0.0, 1e-9);
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kJerk, 0U), 0.0, 1e-3);
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kAcceleration, 0U), 0.0, 1e-3);
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kCurvature, 0U), 0.0, 1e-9);
+    EXPECT_DOUBLE_EQ(actual.GetTerm(CostTerm::kProximity, 0U), 0.0);
+    EXPECT_DOUBLE_EQ(actual.GetTerm(CostTerm::kLaneChange, 0U), 0.0);
+    EXPECT_NEAR(actual.costs[0U], 0.5, 1e-3);
+}
+
+TEST_F(TrajectoryCostFunctionFixture, Evaluate_GivenConstantAcceleration_ExpectSquaredAcceleration)
+{
+    // Given
+    CostOptions options{};
+    options.acceleration_weight = 2.0;
+    options.jerk_weight = 1.0;
+    const TrajectoryCostFunction cost_function{data_source_, &object_predictor_, options};
+
+    // When
+    const auto actual = cost_function.Evaluate({GetStraightTrajectory(10.0, 3.0, LaneId::kEgo)});
+
+    // Then
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kAcceleration, 0U), 9.0, 1e-3);
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kJerk, 0U), 0.0, 1e-3);
+    EXPECT_NEAR(actual.costs[0U], 18.0, 1e-2);
+}
+
+TEST_F(TrajectoryCostFunctionFixture, Evaluate_GivenCircularTrajectory_ExpectSquaredCurvatureAndLateralOffset)
+{
+    // Given
+    CostOptions options{};
+    options.curvature_weight = 1.0;
+    options.lateral_offset_weight = 1.0;
+    options.acceleration_weight = 1.0;
+    const TrajectoryCostFunction cost_function{data_source_, &object_predictor_, options};
+
+    // When
+    const auto actual = cost_function.Evaluate({GetCircularTrajectory(10.0, 50.0)});
+
+    // Then (centripetal acceleration v^2 / r)
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kCurvature, 0U), 1.0 / (50.0 * 50.0), 1e-6);
+    EXPECT_NEAR(actual.GetTerm(CostTerm::kAcceleration, 0U), 4.0, 1e-2);
+    EXPECT_GT(actual.GetTerm(CostTerm::kLateralOffset, 0U), 0.0);
+}
+
+TEST(TrajectoryCostFunctionTest, Evaluate_GivenObjectsNearAndFar_ExpectProximityOfNearObjectOnly)
+{
+    // Given (ego at s=200 in center lane, along the lane at 20 m/s)
+    const auto get_data_source = [](const double object_distance)
+    {
+        return DataSourceBuilder()
+            .WithPreviousPath(PreviousPathGlobal{})
+            .WithMapCoordinates(kHighwayMap)
+            .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+            .WithSensorFusion(SensorFusionBuilder()
+                                  .WithObjectFusion(ObjectFusionBuilder()
+                                                        .WithIndex(1)
+                                                        .WithFrenetCoordinates({200.0 + object_distance, 10.0})
+                                                        .WithVelocity(units::velocity::meters_per_second_t{20.0})
+                                                        .Build())
+                                  .Build())
+            .Build();
+    };
+    Trajectory trajectory{};
+    trajectory.lane_id = LaneId::kEgo;
+    FrenetToGlobalConverter to_global{kHighwayMap};
+    for (std::size_t tick = 1U; tick <= 50U; ++tick)
+    {
+        trajectory.waypoints.push_back(to_global(200.0 + (20.0 * 0.02 * static_cast<double>(tick)), 6.0));
+    }
+    CostOptions options{};
+    options.proximity_weight = 1.0;
+    const auto near_data_source = get_data_source(0.0);
+    const auto far_data_source = get_data_source(100.0);
+    ObjectPredictor near_object_predictor{near_data_source};
+    near_object_predictor.PredictObjects();
+    ObjectPredictor far_object_predictor{far_data_source};
+    far_object_predictor.PredictObjects();
+
+    const TrajectoryCostFunction near_cost_function{near_data_source, &near_object_predictor, options};
+
+    // When
+    const auto near = near_cost_function.GetCost(trajectory);
+    const auto far = TrajectoryCostFunction{far_data_source, &far_object_predictor, options}.GetCost(trajectory);
+    const auto near_packed_once = near_cost_function.GetCost(
+        trajectory, std::numeric_limits<double>::infinity(), near_cost_function.GetPackedObjects(nullptr), nullptr);
+
+    // Then (neighbor lane at 4 m, i.e. 1 - (4 / 10)^2)
+    EXPECT_NEAR(near, 0.84, 1e-2);
+    EXPECT_DOUBLE_EQ(far, 0.0);
+    EXPECT_DOUBLE_EQ(near_packed_once, near);
+}
+
+TEST_F(TrajectoryCostFunctionFixture, GetCost_GivenCandidates_ExpectSameCostAsBatch)
+{
+    // Given
+    const TrajectoryCostFunction cost_function{data_source_, &object_predictor_, GetAllTermsOptions()};
+    const Trajectories candidates{GetStraightTrajectory(10.0, 1.0, LaneId::kEgo),
+                                  GetCircularTrajectory(15.0, 80.0),
+                                  GetStraightTrajectory(20.0, -2.0, LaneId::kRight)};
+
+    // When
+    const auto batch = cost_function.Evaluate(candidates);
+
+    // Then
+    ASSERT_EQ(batch.costs.size(), candidates.size());
+    for (std::size_t idx = 0U; idx < candidates.size(); ++idx)
+    {
+        EXPECT_DOUBLE_EQ(cost_function.GetCost(candidates[idx]), batch.costs[idx]);
+    }
+}
+
+}  // namespace
+}  // namespace planning
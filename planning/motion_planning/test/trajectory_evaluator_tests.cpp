@@ -4,14 +4,21 @@
 /// @copyright Copyright (c) 2021. All Rights Reserved.
 ///
 #include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/object_predictor.h"
+#include "planning/motion_planning/occupancy_grid.h"
 #include "planning/motion_planning/test/support/builders/data_source_builder.h"
 #include "planning/motion_planning/test/support/builders/trajectory_builder.h"
 #include "planning/motion_planning/trajectory_evaluator.h"
+#include "planning/motion_planning/trajectory_prioritizer.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <units.h>
 
+#include <algorithm>
+#include <iterator>
+#include <new>
+
 namespace planning
 {
 namespace
@@ -65,6 +72,49 @@ TEST_F(TrajectoryEvaluatorFixture, GetRatedTrajectories_GivenTypicalPlannedTraje
     EXPECT_EQ(actual.size(), planned_trajectories_.size());
 }
 
+TEST_F(TrajectoryEvaluatorFixture, RateTrajectories_GivenEvaluatedLanes_ExpectSameAsGetRatedTrajectories)
+{
+    // Given
+    const auto data_source = DataSourceBuilder().Build();
+    const TrajectoryEvaluator trajectory_evaluator{data_source};
+    const auto lane_evaluation = trajectory_evaluator.GetLaneEvaluation();
+    auto actual = planned_trajectories_;
+    EvaluationStatistics statistics{};
+
+    // When
+    trajectory_evaluator.RateTrajectories(actual, lane_evaluation, statistics);
+
+    // Then
+    const auto expected = trajectory_evaluator.GetRatedTrajectories(planned_trajectories_);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t idx = 0U; idx < expected.size(); ++idx)
+    {
+        EXPECT_EQ(actual[idx].lane_id, expected[idx].lane_id);
+        EXPECT_EQ(actual[idx].drivable, expected[idx].drivable);
+        EXPECT_DOUBLE_EQ(actual[idx].cost, expected[idx].cost);
+    }
+    EXPECT_EQ(statistics.evaluated, expected.size());
+}
+
+TEST_F(TrajectoryEvaluatorFixture, GetRatedTrajectories_GivenDataSourceOnlyOnDirtyStorage_ExpectExhaustiveWithoutArena)
+{
+    // Given (evaluator constructed over non zeroed storage, i.e. each member must be initialized by the constructor)
+    const auto data_source = DataSourceBuilder().Build();
+    alignas(TrajectoryEvaluator) unsigned char storage[sizeof(TrajectoryEvaluator)];
+    std::fill(std::begin(storage), std::end(storage), static_cast<unsigned char>(0xA5U));
+    const auto* trajectory_evaluator = new (storage) TrajectoryEvaluator{data_source};
+    EvaluationStatistics statistics{};
+
+    // When
+    const auto actual = trajectory_evaluator->GetRatedTrajectories(planned_trajectories_, statistics);
+    trajectory_evaluator->~TrajectoryEvaluator();
+
+    // Then
+    EXPECT_EQ(actual.size(), planned_trajectories_.size());
+    EXPECT_EQ(statistics.evaluated, planned_trajectories_.size());
+    EXPECT_EQ(statistics.GetPruned(), 0U);
+}
+
 TEST_F(TrajectoryEvaluatorFixture,
        GetRatedTrajectories_GivenTypicalPlannedTrajectoriesWithNoObjects_ExpectSameCostTrajectories)
 {
@@ -150,5 +200,125 @@ TEST_P(TrajectoryEvaluatorFixture_WithEgoGlobalLaneId,
     std::for_each(actual.begin(), actual.end(), expected_cost);
 }
 
+/// @brief Collision Checker reporting every trajectory as colliding
+class CollidingCollisionChecker : public ICollisionChecker
+{
+  public:
+    void Update() override {}
+    bool IsCollisionFree(const Trajectory& /*trajectory*/) const override { return false; }
+};
+
+TEST_F(TrajectoryEvaluatorFixture, GetRatedTrajectories_GivenCollidingTrajectories_ExpectNotDrivable)
+{
+    // Given
+    const auto data_source = DataSourceBuilder().Build();
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    const CollidingCollisionChecker collision_checker{};
+    TrajectoryEvaluatorOptions options{};
+    options.collision_checker = &collision_checker;
+    const TrajectoryEvaluator trajectory_evaluator{data_source, object_predictor, options};
+
+    // When
+    const auto actual = trajectory_evaluator.GetRatedTrajectories(planned_trajectories_);
+
+    // Then
+    ASSERT_FALSE(actual.empty());
+    for (const auto& trajectory : actual)
+    {
+        EXPECT_FALSE(trajectory.drivable);
+        EXPECT_DOUBLE_EQ(trajectory.cost, std::numeric_limits<double>::infinity());
+    }
+}
+
+TEST_F(TrajectoryEvaluatorFixture, GetRatedTrajectories_GivenOccupancyGridAndObjectAlongside_ExpectLeftNotDrivable)
+{
+    // Given
+    const auto data_source =
+        DataSourceBuilder().WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{0.0}).Build();
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    OccupancyGrid occupancy_grid{data_source, object_predictor};
+    occupancy_grid.Update();
+    TrajectoryEvaluatorOptions options{};
+    options.occupancy_grid = &occupancy_grid;
+    const TrajectoryEvaluator trajectory_evaluator{data_source, object_predictor, options};
+
+    // When
+    const auto actual = trajectory_evaluator.GetRatedTrajectories(planned_trajectories_);
+
+    // Then
+    ASSERT_EQ(actual.size(), 3U);
+    EXPECT_TRUE(actual[0].drivable);
+    EXPECT_DOUBLE_EQ(actual[0].cost, 0.0);
+    EXPECT_FALSE(actual[1].drivable);
+    EXPECT_DOUBLE_EQ(actual[1].cost, std::numeric_limits<double>::infinity());
+    EXPECT_TRUE(actual[2].drivable);
+    EXPECT_DOUBLE_EQ(actual[2].cost, 1.0);
+}
+
+TEST_F(TrajectoryEvaluatorFixture, GetRatedTrajectories_GivenBranchAndBound_ExpectSameBestTrajectoryAsExhaustive)
+{
+    // Given (candidates on all the lanes with different velocities and accelerations)
+    const auto data_source = DataSourceBuilder().Build();
+    ObjectPredictor object_predictor{data_source};
+    object_predictor.PredictObjects();
+    CostOptions cost_options{};
+    cost_options.progress_weight = 1.0;
+    cost_options.acceleration_weight = 0.1;
+    cost_options.jerk_weight = 0.1;
+    cost_options.curvature_weight = 1.0;
+    Trajectories candidates{};
+    for (const auto& lane : {planned_trajectories_[0], planned_trajectories_[1], planned_trajectories_[2]})
+    {
+        for (const auto velocity : {10.0, 14.0, 18.0})
+        {
+            for (const auto acceleration : {-2.0, -1.0, 0.0, 1.0, 2.0})
+            {
+                auto candidate = lane;
+                candidate.unique_id = static_cast<std::int32_t>(candidates.size() + 1U);
+                candidate.waypoints.clear();
+                for (std::size_t tick = 1U; tick <= 50U; ++tick)
+                {
+                    const auto time = static_cast<double>(tick) * 0.02;
+                    candidate.waypoints.push_back(
+                        GlobalCoordinates{(velocity * time) + (0.5 * acceleration * time * time), 0.0});
+                }
+                candidates.push_back(candidate);
+            }
+        }
+    }
+    TrajectoryEvaluatorOptions options{};
+    options.cost_options = cost_options;
+    const TrajectoryEvaluator exhaustive_evaluator{data_source, object_predictor, options};
+    options.evaluation_type = EvaluationType::kBranchAndBound;
+    const TrajectoryEvaluator branch_and_bound_evaluator{data_source, object_predictor, options};
+    EvaluationStatistics statistics{};
+
+    // When
+    const auto expected = exhaustive_evaluator.GetRatedTrajectories(candidates);
+    const auto actual = branch_and_bound_evaluator.GetRatedTrajectories(candidates, statistics);
+
+    // Then
+    EXPECT_EQ(statistics.candidates, candidates.size());
+    EXPECT_GT(statistics.GetPruned(), 0U);
+    EXPECT_EQ(statistics.evaluated + statistics.GetPruned(), statistics.candidates);
+    EXPECT_EQ(actual.size(), statistics.evaluated);
+    for (const auto& trajectory : actual)
+    {
+        const auto it = std::find_if(expected.begin(),
+                                     expected.end(),
+                                     [&trajectory](const auto& other)
+                                     { return other.unique_id == trajectory.unique_id; });
+        ASSERT_NE(it, expected.end());
+        EXPECT_DOUBLE_EQ(trajectory.cost, it->cost);
+    }
+    const TrajectoryPrioritizer trajectory_prioritizer{};
+    const auto expected_best = trajectory_prioritizer.GetPrioritizedTrajectories(expected).top();
+    const auto actual_best = trajectory_prioritizer.GetPrioritizedTrajectories(actual).top();
+    EXPECT_EQ(actual_best.unique_id, expected_best.unique_id);
+    EXPECT_DOUBLE_EQ(actual_best.cost, expected_best.cost);
+}
+
 }  // namespace
 }  // namespace planning
@@ -47,6 +47,101 @@ TEST_F(TrajectoryOptimizerFixture, GetOptimizedTrajectories_GivenPlannedTrajecto
     EXPECT_EQ(actual[0].global_lane_id, GlobalLaneId::kCenter);
 }
 
+TEST(TrajectoryOptimizerTest, GetOptimizedTrajectories_GivenSharedPreviousPath_ExpectPreviousPathContinued)
+{
+    // Given
+    const auto previous_path = PreviousPathGlobal{GlobalCoordinates{1.0, 2.0}, GlobalCoordinates{2.0, 2.0}};
+    const auto data_source = DataSourceBuilder().WithPreviousPath(previous_path).Build();
+    auto planned_trajectory =
+        TrajectoryBuilder().WithWaypoints({{-1.0, 0.0}, {0.0, 0.0}, {30.0, 0.0}, {60.0, 0.0}, {90.0, 0.0}}).Build();
+    planned_trajectory.previous_path = data_source.GetSharedPreviousPath();
+
+    // When
+    const auto actual = TrajectoryOptimizer{data_source}.GetOptimizedTrajectories(Trajectories{planned_trajectory});
+
+    // Then
+    ASSERT_EQ(actual.size(), 1U);
+    EXPECT_EQ(actual[0].previous_path, planned_trajectory.previous_path);
+    EXPECT_EQ(GetPreviousPathSize(actual[0]) + actual[0].waypoints.size(), 50U);
+}
+
+TEST_F(TrajectoryOptimizerFixture, GetOptimizedTrajectories_GivenAnchorWaypoints_ExpectSameResultForSplineTypes)
+{
+    // Given
+    const auto trajectories =
+        Trajectories{TrajectoryBuilder()
+                         .WithWaypoints({{-1.0, 0.0}, {0.0, 0.0}, {30.0, 1.5}, {60.0, 3.5}, {90.0, 4.0}})
+                         .WithTargetVelocity(units::velocity::meters_per_second_t{20.0})
+                         .Build()};
+
+    // When
+    const auto expected =
+        TrajectoryOptimizer{data_source_, SplineType::kDynamic}.GetOptimizedTrajectories(trajectories);
+    const auto actual =
+        TrajectoryOptimizer{data_source_, SplineType::kFixedSize}.GetOptimizedTrajectories(trajectories);
+
+    // Then
+    ASSERT_EQ(actual.size(), expected.size());
+    ASSERT_EQ(actual[0].waypoints.size(), expected[0].waypoints.size());
+    for (std::size_t idx = 0U; idx < actual[0].waypoints.size(); ++idx)
+    {
+        EXPECT_NEAR(actual[0].waypoints[idx].x, expected[0].waypoints[idx].x, 1e-9);
+        EXPECT_NEAR(actual[0].waypoints[idx].y, expected[0].waypoints[idx].y, 1e-9);
+    }
+}
+
+TEST_F(TrajectoryOptimizerFixture, OptimizeTrajectories_GivenPlannedTrajectories_ExpectSameAsOptimizedTrajectories)
+{
+    // Given
+    const auto planned_trajectories =
+        Trajectories{TrajectoryBuilder()
+                         .WithWaypoints({{-1.0, 0.0}, {0.0, 0.0}, {30.0, 1.5}, {60.0, 3.5}, {90.0, 4.0}})
+                         .WithTargetVelocity(units::velocity::meters_per_second_t{20.0})
+                         .Build()};
+    auto actual = planned_trajectories;
+    actual[0].waypoints.reserve(64U);
+    const auto* const buffer = actual[0].waypoints.data();
+
+    // When
+    const auto expected = trajectory_optimizer_.GetOptimizedTrajectories(planned_trajectories);
+    trajectory_optimizer_.OptimizeTrajectories(actual);
+
+    // Then
+    ASSERT_EQ(actual.size(), expected.size());
+    ASSERT_EQ(actual[0].waypoints.size(), expected[0].waypoints.size());
+    EXPECT_EQ(actual[0].waypoints.data(), buffer);
+    for (std::size_t idx = 0U; idx < actual[0].waypoints.size(); ++idx)
+    {
+        EXPECT_DOUBLE_EQ(actual[0].waypoints[idx].x, expected[0].waypoints[idx].x);
+        EXPECT_DOUBLE_EQ(actual[0].waypoints[idx].y, expected[0].waypoints[idx].y);
+    }
+}
+
+TEST_F(TrajectoryOptimizerFixture, GetOptimizedTrajectories_GivenArcLengthResampling_ExpectExactDistancePerTick)
+{
+    // Given
+    const auto velocity = units::velocity::meters_per_second_t{20.0};
+    const auto trajectories =
+        Trajectories{TrajectoryBuilder()
+                         .WithWaypoints({{-1.0, 0.0}, {0.0, 0.0}, {30.0, 4.0}, {60.0, 8.0}, {90.0, 8.0}})
+                         .WithTargetVelocity(velocity)
+                         .Build()};
+    const TrajectoryOptimizer trajectory_optimizer{data_source_, SplineType::kFixedSize, ResamplingType::kArcLength};
+
+    // When
+    const auto actual = trajectory_optimizer.GetOptimizedTrajectories(trajectories);
+
+    // Then
+    ASSERT_EQ(actual.size(), trajectories.size());
+    const auto& waypoints = actual[0].waypoints;
+    for (std::size_t idx = 1U; idx < waypoints.size(); ++idx)
+    {
+        const auto distance =
+            std::hypot(waypoints[idx].x - waypoints[idx - 1U].x, waypoints[idx].y - waypoints[idx - 1U].y);
+        EXPECT_NEAR(distance, velocity.value() * 0.02, 1e-3);
+    }
+}
+
 /// @todo Add Test confirming the curve for Trajectory is smooth enough
 
 }  // namespace
@@ -4,12 +4,15 @@
 /// @copyright Copyright (c) 2021. All Rights Reserved.
 ///
 #include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
 #include "planning/motion_planning/trajectory_planner.h"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <units.h>
 
+#include <cmath>
+
 namespace planning
 {
 namespace
@@ -62,5 +65,113 @@ TEST_P(TrajectoryPlannerFixture, GivenTypicalManeuvers_ExpectPlannedTrajectories
     EXPECT_EQ(actual[0].global_lane_id, GlobalLaneId::kCenter);
 }
 
+TEST_F(TrajectoryPlannerFixture, GetPlannedTrajectories_GivenMultipleManeuvers_ExpectSharedPreviousPath)
+{
+    // Given
+    const auto maneuvers = std::vector<Maneuver>{Maneuver{LaneId::kLeft, target_velocity_},
+                                                 Maneuver{LaneId::kEgo, target_velocity_},
+                                                 Maneuver{LaneId::kRight, target_velocity_}};
+    const auto previous_path = PreviousPathGlobal{GlobalCoordinates{1, 2}, GlobalCoordinates{2, 2}};
+    const auto data_source =
+        DataSourceBuilder().WithPreviousPath(previous_path).WithMapCoordinates(map_waypoints_).Build();
+
+    // When
+    const auto actual = TrajectoryPlanner(data_source).GetPlannedTrajectories(maneuvers);
+
+    // Then
+    ASSERT_EQ(actual.size(), maneuvers.size());
+    for (const auto& trajectory : actual)
+    {
+        EXPECT_EQ(trajectory.previous_path, data_source.GetSharedPreviousPath());
+        EXPECT_EQ(GetPreviousPathSize(trajectory), previous_path.size());
+    }
+}
+
+TEST_F(TrajectoryPlannerFixture, GetPlannedTrajectories_GivenLongerHorizon_ExpectFartherAnchorWaypoints)
+{
+    // Given
+    const auto maneuvers =
+        std::vector<Maneuver>{Maneuver{LaneId::kEgo, target_velocity_, units::length::meter_t{30.0}},
+                              Maneuver{LaneId::kEgo, target_velocity_, units::length::meter_t{60.0}}};
+    const auto data_source = DataSourceBuilder()
+                                 .WithPreviousPath(PreviousPathGlobal{})
+                                 .WithMapCoordinates(kHighwayMap)
+                                 .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+                                 .Build();
+
+    // When
+    const auto actual = TrajectoryPlanner(data_source).GetPlannedTrajectories(maneuvers);
+
+    // Then
+    ASSERT_EQ(actual.size(), maneuvers.size());
+    for (std::size_t idx = 0U; idx < actual.size(); ++idx)
+    {
+        // initial waypoints (2) followed by anchor waypoints (3) spaced by horizon
+        ASSERT_EQ(actual[idx].waypoints.size(), 5U);
+        const auto& anchors = actual[idx].waypoints;
+        const auto spacing = std::hypot(anchors[4].x - anchors[3].x, anchors[4].y - anchors[3].y);
+        EXPECT_NEAR(spacing, maneuvers[idx].GetHorizon().value(), 2.0);
+    }
+}
+
+TEST_F(TrajectoryPlannerFixture, PlanTrajectories_GivenReusedTrajectories_ExpectSameAsPlannedTrajectories)
+{
+    // Given
+    const auto maneuvers = std::vector<Maneuver>{Maneuver{LaneId::kLeft, target_velocity_},
+                                                 Maneuver{LaneId::kEgo, target_velocity_}};
+    const auto data_source = DataSourceBuilder()
+                                 .WithPreviousPath(PreviousPathGlobal{})
+                                 .WithMapCoordinates(kHighwayMap)
+                                 .WithFrenetCoordinates(FrenetCoordinates{200.0, 6.0, 0.0, 0.0})
+                                 .Build();
+    const TrajectoryPlanner trajectory_planner{data_source};
+    auto actual = Trajectories(3U);
+    actual[0].waypoints.reserve(64U);
+    actual[0].cost = 1.0;
+    actual[0].drivable = true;
+    const auto* const buffer = actual[0].waypoints.data();
+
+    // When
+    const auto expected = trajectory_planner.GetPlannedTrajectories(maneuvers);
+    trajectory_planner.PlanTrajectories(maneuvers, actual);
+
+    // Then
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_EQ(actual[0].waypoints.data(), buffer);
+    for (std::size_t idx = 0U; idx < actual.size(); ++idx)
+    {
+        EXPECT_EQ(actual[idx].unique_id, expected[idx].unique_id);
+        EXPECT_EQ(actual[idx].global_lane_id, expected[idx].global_lane_id);
+        EXPECT_EQ(actual[idx].cost, expected[idx].cost);
+        EXPECT_EQ(actual[idx].drivable, expected[idx].drivable);
+        ASSERT_EQ(actual[idx].waypoints.size(), expected[idx].waypoints.size());
+        for (std::size_t wp = 0U; wp < actual[idx].waypoints.size(); ++wp)
+        {
+            EXPECT_DOUBLE_EQ(actual[idx].waypoints[wp].x, expected[idx].waypoints[wp].x);
+            EXPECT_DOUBLE_EQ(actual[idx].waypoints[wp].y, expected[idx].waypoints[wp].y);
+        }
+    }
+}
+
+TEST_F(TrajectoryPlannerFixture, GetPlannedTrajectory_GivenPreviousPath_ExpectLocalFrameAtPreviousPathEnd)
+{
+    // Given
+    const auto previous_path = PreviousPathGlobal{GlobalCoordinates{1, 2}, GlobalCoordinates{2, 2}};
+    const auto data_source =
+        DataSourceBuilder().WithPreviousPath(previous_path).WithMapCoordinates(map_waypoints_).Build();
+    const auto maneuver = Maneuver{LaneId::kEgo, target_velocity_};
+
+    // When
+    const auto actual = TrajectoryPlanner(data_source).GetPlannedTrajectory(maneuver, 1);
+
+    // Then
+    EXPECT_DOUBLE_EQ(actual.position.x, previous_path.back().x);
+    EXPECT_DOUBLE_EQ(actual.position.y, previous_path.back().y);
+    EXPECT_DOUBLE_EQ(actual.yaw.value(), 0.0);
+    ASSERT_GE(actual.waypoints.size(), 2U);
+    EXPECT_DOUBLE_EQ(actual.waypoints[1].x, 0.0);
+    EXPECT_DOUBLE_EQ(actual.waypoints[1].y, 0.0);
+}
+
 }  // namespace
 }  // namespace planning
@@ -12,6 +12,9 @@
 #include <gtest/gtest.h>
 #include <units.h>
 
+#include <functional>
+#include <queue>
+
 namespace planning
 {
 namespace
@@ -69,5 +72,73 @@ TEST(TrajectoryPrioritizerTest,
     EXPECT_DOUBLE_EQ(actual.top().cost, left_trajectory.cost);
 }
 
+TEST(TrajectoryPrioritizerTest, GetPrioritizedTrajectories_GivenTopK_ExpectSameOrderAsPriorityQueue)
+{
+    // Given (costs with ties on all lanes, more trajectories than ordered at once)
+    Trajectories trajectories{};
+    for (std::int32_t idx = 0; idx < 40; ++idx)
+    {
+        auto trajectory = TrajectoryBuilder()
+                              .WithLaneId(static_cast<LaneId>(idx % 3))
+                              .WithCost(static_cast<double>((idx * 7) % 11))
+                              .Build();
+        trajectory.unique_id = idx;
+        trajectories.push_back(trajectory);
+    }
+    std::priority_queue<Trajectory, Trajectories, std::greater<Trajectory>> expected{};
+    for (const auto& trajectory : trajectories)
+    {
+        expected.push(trajectory);
+    }
+
+    // When
+    auto actual = TrajectoryPrioritizer{3U}.GetPrioritizedTrajectories(trajectories);
+
+    // Then
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_EQ(actual.GetOrderedHandles().size(), 3U);
+    while (!expected.empty())
+    {
+        ASSERT_FALSE(actual.empty());
+        EXPECT_EQ(actual.top().lane_id, expected.top().lane_id);
+        EXPECT_DOUBLE_EQ(actual.top().cost, expected.top().cost);
+        actual.pop();
+        expected.pop();
+    }
+    EXPECT_TRUE(actual.empty());
+}
+
+TEST(TrajectoryPrioritizerTest, GetPrioritizedTrajectories_GivenEqualKeys_ExpectFirstRatedTrajectoryOnTop)
+{
+    // Given
+    auto first_trajectory = TrajectoryBuilder().WithLaneId(LaneId::kEgo).WithCost(1.0).Build();
+    first_trajectory.unique_id = 1;
+    auto second_trajectory = first_trajectory;
+    second_trajectory.unique_id = 2;
+
+    // When
+    const auto actual = TrajectoryPrioritizer().GetPrioritizedTrajectories({second_trajectory, first_trajectory});
+
+    // Then
+    EXPECT_EQ(actual.top().unique_id, 2);
+}
+
+TEST(TrajectoryPrioritizerTest, TakeTop_GivenPrioritizedTrajectories_ExpectWaypointsMovedOut)
+{
+    // Given
+    const auto waypoints = std::vector<GlobalCoordinates>{{1.0, 2.0}, {3.0, 4.0}};
+    auto prioritized_trajectories = TrajectoryPrioritizer().GetPrioritizedTrajectories(
+        {TrajectoryBuilder().WithLaneId(LaneId::kEgo).WithCost(1.0).WithWaypoints(waypoints).Build(),
+         TrajectoryBuilder().WithLaneId(LaneId::kLeft).WithCost(2.0).WithWaypoints(waypoints).Build()});
+
+    // When
+    const auto actual = prioritized_trajectories.TakeTop();
+
+    // Then
+    EXPECT_EQ(actual.lane_id, LaneId::kEgo);
+    EXPECT_EQ(actual.waypoints.size(), waypoints.size());
+    EXPECT_EQ(prioritized_trajectories.size(), 2U);
+}
+
 }  // namespace
 }  // namespace planning
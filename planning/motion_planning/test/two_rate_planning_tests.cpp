@@ -0,0 +1,121 @@
+///
+/// @file
+/// @brief Contains unit tests for Two Rate Planning.
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/map_coordinates.h"
+#include "planning/motion_planning/two_rate_planning.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+
+namespace planning
+{
+namespace
+{
+class TwoRatePlanningFixture : public ::testing::Test
+{
+  public:
+    TwoRatePlanningFixture() : two_rate_options_{}
+    {
+        two_rate_options_.strategic_refresh_period = 2U;
+        two_rate_options_.strategic_options.maneuver_generator_type = ManeuverGeneratorType::kLattice;
+        two_rate_options_.strategic_options.lattice_options.min_horizon = units::length::meter_t{60.0};
+    }
+
+  protected:
+    const DataSource data_source_{DataSourceBuilder()
+                                      .WithPreviousPath(PreviousPathGlobal{})
+                                      .WithMapCoordinates(kHighwayMap)
+                                      .WithGlobalLaneId(GlobalLaneId::kCenter)
+                                      .WithObjectInLane(GlobalLaneId::kLeft, units::velocity::meters_per_second_t{10.0})
+                                      .Build()};
+    TwoRatePlanningOptions two_rate_options_;
+};
+
+TEST_F(TwoRatePlanningFixture, GenerateTrajectories_GivenFirstFrame_ExpectAllLanesPlanned)
+{
+    // Given
+    TwoRatePlanning two_rate_planning{data_source_, MotionPlanningOptions{}, two_rate_options_};
+    auto motion_planning = MotionPlanning{data_source_};
+    motion_planning.GenerateTrajectories();
+
+    // When
+    two_rate_planning.GenerateTrajectories();
+
+    // Then
+    const auto expected = motion_planning.GetSelectedTrajectory();
+    const auto actual = two_rate_planning.GetSelectedTrajectory();
+    EXPECT_EQ(actual.unique_id, expected.unique_id);
+    EXPECT_EQ(actual.lane_id, expected.lane_id);
+    EXPECT_EQ(actual.waypoints.size(), expected.waypoints.size());
+    EXPECT_EQ(two_rate_planning.GetTargetLane(), GlobalLaneId::kInvalid);
+    EXPECT_EQ(two_rate_planning.GetStatistics().refreshes, 1U);
+}
+
+TEST_F(TwoRatePlanningFixture, GenerateTrajectories_GivenCompletedRefresh_ExpectStrategicTargetLane)
+{
+    // Given
+    TwoRatePlanning two_rate_planning{data_source_, MotionPlanningOptions{}, two_rate_options_};
+    auto strategic_motion_planning = MotionPlanning{data_source_, two_rate_options_.strategic_options};
+    strategic_motion_planning.GenerateTrajectories();
+
+    // When
+    for (std::size_t frame = 0U; (frame < 1000U) && (two_rate_planning.GetStatistics().decisions == 0U); ++frame)
+    {
+        two_rate_planning.GenerateTrajectories();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    // Then
+    const auto expected = strategic_motion_planning.GetSelectedTrajectory().global_lane_id;
+    EXPECT_EQ(two_rate_planning.GetTargetLane(), expected);
+    const auto statistics = two_rate_planning.GetStatistics();
+    EXPECT_GE(statistics.decisions, 1U);
+    EXPECT_LE(statistics.decisions, statistics.refreshes);
+    EXPECT_LE(statistics.refreshes, (statistics.frames + 1U) / 2U);
+}
+
+TEST_F(TwoRatePlanningFixture, GenerateTrajectories_GivenSeveralRefreshes_ExpectTargetVelocityOfFastLoop)
+{
+    // Given
+    two_rate_options_.strategic_refresh_period = 5U;
+    TwoRatePlanning two_rate_planning{data_source_, MotionPlanningOptions{}, two_rate_options_};
+
+    // When
+    for (std::size_t frame = 0U; (frame < 1000U) && (two_rate_planning.GetStatistics().decisions < 3U); ++frame)
+    {
+        two_rate_planning.GenerateTrajectories();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    // Then (third refresh started after two periods, i.e. fast loop ramped by 0.2 m/s per frame since the 1 m/s floor)
+    ASSERT_GE(two_rate_planning.GetStatistics().decisions, 3U);
+    const auto actual = two_rate_planning.GetStrategicTargetVelocity();
+    EXPECT_GE(actual.value(), 1.0 + (0.2 * 2.0 * 5.0) - 1e-9);
+    EXPECT_LE(actual.value(), two_rate_planning.GetSelectedTrajectory().velocity.value() + 1e-9);
+}
+
+TEST_F(TwoRatePlanningFixture, GenerateTrajectories_GivenTargetLaneOfEgo_ExpectEgoLaneOnly)
+{
+    // Given
+    MotionPlanningOptions options{};
+    options.cost_options.lane_change_weight = -1.0;
+    auto motion_planning = MotionPlanning{data_source_, options};
+    motion_planning.SetTargetLane(GlobalLaneId::kCenter);
+
+    // When
+    motion_planning.GenerateTrajectories();
+
+    // Then
+    EXPECT_EQ(motion_planning.GetSelectedTrajectory().lane_id, LaneId::kEgo);
+    EXPECT_EQ(motion_planning.GetManeuverPruningStatistics().off_target_lane, 1U);
+}
+}  // namespace
+}  // namespace planning
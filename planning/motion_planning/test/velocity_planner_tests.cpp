@@ -5,6 +5,8 @@
 ///
 #include "planning/datatypes/lane.h"
 #include "planning/motion_planning/test/support/builders/data_source_builder.h"
+#include "planning/motion_planning/test/support/builders/object_fusion_builder.h"
+#include "planning/motion_planning/test/support/builders/sensor_fusion_builder.h"
 #include "planning/motion_planning/velocity_planner.h"
 
 #include <gmock/gmock.h>
@@ -101,10 +103,12 @@ TEST_P(VelocityPlannerFixture_WithDeceleration,
     // Given
     const auto object_velocity = std::get<0>(GetParam());
     const auto object_lane_id = std::get<1>(GetParam());
+    // previous path (50 waypoints) ends where ego arrives after 1s
     const auto data_source = DataSourceBuilder()
                                  .WithVelocity(velocity_)
                                  .WithGlobalLaneId(GlobalLaneId::kCenter)
                                  .WithDistance(0.0_m)
+                                 .WithPreviousPathEnd(FrenetCoordinates{17.0, 6.0})
                                  .WithObjectInLane(object_lane_id, object_velocity)
                                  .Build();
     VelocityPlanner velocity_planner{data_source, velocity_};
@@ -116,5 +120,30 @@ TEST_P(VelocityPlannerFixture_WithDeceleration,
     EXPECT_LT(velocity_planner.GetTargetVelocity(), velocity_);
 }
 
+TEST_F(VelocityPlannerFixture, CalculateTargetVelocity_GivenObjectBetweenEgoAndPreviousPathEnd_ExpectDecelerated)
+{
+    // Given (object behind previous path end now, but in front of ego once it reaches previous path end)
+    const auto data_source = DataSourceBuilder()
+                                 .WithVelocity(velocity_)
+                                 .WithGlobalLaneId(GlobalLaneId::kCenter)
+                                 .WithDistance(0.0_m)
+                                 .WithPreviousPathEnd(FrenetCoordinates{17.0, 6.0})
+                                 .WithSensorFusion(SensorFusionBuilder()
+                                                       .WithObjectFusion(ObjectFusionBuilder()
+                                                                             .WithIndex(1)
+                                                                             .WithFrenetCoordinates({10.0, 6.0})
+                                                                             .WithVelocity(15.0_mps)
+                                                                             .Build())
+                                                       .Build())
+                                 .Build();
+    VelocityPlanner velocity_planner{data_source, velocity_};
+
+    // When
+    velocity_planner.CalculateTargetVelocity();
+
+    // Then
+    EXPECT_LT(velocity_planner.GetTargetVelocity(), velocity_);
+}
+
 }  // namespace
 }  // namespace planning
@@ -0,0 +1,420 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/trajectory_cost_function.h"
+
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/frenet_to_global_converter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace planning
+{
+namespace
+{
+/// @brief Squared sampling time between consecutive waypoints (in s^2)
+constexpr double kSquaredSamplingTime{kWaypointSamplingTime * kWaypointSamplingTime};
+
+/// @brief Minimum cubed speed (per waypoint spacing) for the curvature, avoids division by zero while standing
+constexpr double kMinCubedDistance{1e-9};
+
+/// @brief Waypoints of all the candidates, structure of arrays (candidate `c` at [offsets[c], offsets[c + 1]))
+struct PackedWaypoints
+{
+    /// @brief Constructor. Buffers are drawn from given arena (nullptr uses the heap).
+    explicit PackedWaypoints(MonotonicArena* arena)
+        : x{ArenaAllocator<double>{arena}},
+          y{ArenaAllocator<double>{arena}},
+          offsets{ArenaAllocator<std::size_t>{arena}}
+    {
+    }
+
+    /// @brief Waypoint x positions
+    ArenaVector<double> x;
+
+    /// @brief Waypoint y positions
+    ArenaVector<double> y;
+
+    /// @brief First waypoint of each candidate (followed by the total number of waypoints)
+    ArenaVector<std::size_t> offsets;
+};
+
+/// @brief Length of the polyline through the waypoints
+inline double GetPathLength(const double* const x, const double* const y, const std::size_t count) noexcept
+{
+    double length = 0.0;
+    for (std::size_t idx = 1U; idx < count; ++idx)
+    {
+        const double dx = x[idx] - x[idx - 1U];
+        const double dy = y[idx] - y[idx - 1U];
+        length += std::sqrt((dx * dx) + (dy * dy));
+    }
+    return length;
+}
+
+/// @brief Sum of absolute lateral offsets of the waypoints from the line through (x0, y0) along (cos, sin)
+inline double GetLateralOffsetSum(const double* const x,
+                                  const double* const y,
+                                  const std::size_t count,
+                                  const double x0,
+                                  const double y0,
+                                  const double cos,
+                                  const double sin) noexcept
+{
+    double sum = 0.0;
+    for (std::size_t idx = 0U; idx < count; ++idx)
+    {
+        sum += std::fabs(((y[idx] - y0) * cos) - ((x[idx] - x0) * sin));
+    }
+    return sum;
+}
+
+/// @brief Sum of squared second differences of the waypoints (i.e. squared acceleration times dt^4)
+inline double GetSecondDifferenceSum(const double* const x, const double* const y, const std::size_t count) noexcept
+{
+    double sum = 0.0;
+    for (std::size_t idx = 2U; idx < count; ++idx)
+    {
+        const double ax = x[idx] - (2.0 * x[idx - 1U]) + x[idx - 2U];
+        const double ay = y[idx] - (2.0 * y[idx - 1U]) + y[idx - 2U];
+        sum += (ax * ax) + (ay * ay);
+    }
+    return sum;
+}
+
+/// @brief Sum of squared third differences of the waypoints (i.e. squared jerk times dt^6)
+inline double GetThirdDifferenceSum(const double* const x, const double* const y, const std::size_t count) noexcept
+{
+    double sum = 0.0;
+    for (std::size_t idx = 3U; idx < count; ++idx)
+    {
+        const double jx = x[idx] - (3.0 * x[idx - 1U]) + (3.0 * x[idx - 2U]) - x[idx - 3U];
+        const double jy = y[idx] - (3.0 * y[idx - 1U]) + (3.0 * y[idx - 2U]) - y[idx - 3U];
+        sum += (jx * jx) + (jy * jy);
+    }
+    return sum;
+}
+
+/// @brief Sum of squared curvatures of the waypoints (central differences, independent of the sampling time)
+inline double GetSquaredCurvatureSum(const double* const x, const double* const y, const std::size_t count) noexcept
+{
+    double sum = 0.0;
+    for (std::size_t idx = 2U; idx < count; ++idx)
+    {
+        const double vx = 0.5 * (x[idx] - x[idx - 2U]);
+        const double vy = 0.5 * (y[idx] - y[idx - 2U]);
+        const double ax = x[idx] - (2.0 * x[idx - 1U]) + x[idx - 2U];
+        const double ay = y[idx] - (2.0 * y[idx - 1U]) + y[idx - 2U];
+        const double speed = std::sqrt((vx * vx) + (vy * vy));
+        const double curvature = ((vx * ay) - (vy * ax)) / std::max(speed * speed * speed, kMinCubedDistance);
+        sum += curvature * curvature;
+    }
+    return sum;
+}
+
+/// @brief Maximum proximity, 1 - (distance / radius)^2 within radius, of the objects to a waypoint
+inline double GetMaxProximity(const double x,
+                              const double y,
+                              const double* const object_x,
+                              const double* const object_y,
+                              const std::size_t count,
+                              const double inverse_squared_radius) noexcept
+{
+    double proximity = 0.0;
+    for (std::size_t idx = 0U; idx < count; ++idx)
+    {
+        const double dx = object_x[idx] - x;
+        const double dy = object_y[idx] - y;
+        proximity = std::max(proximity, 1.0 - (((dx * dx) + (dy * dy)) * inverse_squared_radius));
+    }
+    return proximity;
+}
+
+/// @brief Pack the waypoints of all the candidates
+PackedWaypoints GetPackedWaypoints(const ArenaVector<const Trajectory*>& candidates, MonotonicArena* arena)
+{
+    PackedWaypoints packed{arena};
+    packed.offsets.reserve(candidates.size() + 1U);
+    std::size_t size = 0U;
+    for (const auto* const candidate : candidates)
+    {
+        packed.offsets.push_back(size);
+        size += GetPreviousPathSize(*candidate) + candidate->waypoints.size();
+    }
+    packed.offsets.push_back(size);
+
+    packed.x.reserve(size);
+    packed.y.reserve(size);
+    for (const auto* const candidate : candidates)
+    {
+        ForEachWaypoint(*candidate,
+                        [&packed](const GlobalCoordinates& waypoint)
+                        {
+                            packed.x.push_back(waypoint.x);
+                            packed.y.push_back(waypoint.y);
+                        });
+    }
+    return packed;
+}
+
+/// @brief Pack the predicted objects in Global Coordinates (no objects without map)
+PackedObjects PackObjects(const PredictedObjects& predicted_objects,
+                          const MapCoordinatesList& map_coordinates,
+                          MonotonicArena* arena)
+{
+    PackedObjects packed{arena};
+    packed.number_of_objects = (map_coordinates.size() < 2U) ? 0U : predicted_objects.GetNumberOfObjects();
+    packed.number_of_steps = predicted_objects.GetNumberOfSteps();
+    packed.time_step = predicted_objects.GetTimeStep().value();
+    packed.x.resize(packed.number_of_objects * packed.number_of_steps);
+    packed.y.resize(packed.number_of_objects * packed.number_of_steps);
+
+    // object by object, hence the map is searched forward along each object's (ascending) predicted positions
+    for (std::size_t object = 0U; object < packed.number_of_objects; ++object)
+    {
+        FrenetToGlobalConverter to_global{map_coordinates};
+        for (std::size_t step = 0U; step < packed.number_of_steps; ++step)
+        {
+            const auto& state = predicted_objects.GetState(step, object);
+            const auto position = to_global(state.s, state.d);
+            packed.x[(step * packed.number_of_objects) + object] = position.x;
+            packed.y[(step * packed.number_of_objects) + object] = position.y;
+        }
+    }
+    return packed;
+}
+
+/// @brief Duration since given start
+inline std::chrono::nanoseconds GetElapsedTime(const std::chrono::steady_clock::time_point start) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+}
+
+/// @brief Mean of a sum over count values (0 without values)
+inline double GetMean(const double sum, const std::size_t count) noexcept
+{
+    return (count > 0U) ? (sum / static_cast<double>(count)) : 0.0;
+}
+}  // namespace
+
+TrajectoryCostFunction::TrajectoryCostFunction(const IDataSource& data_source)
+    : TrajectoryCostFunction{data_source, nullptr, CostOptions{}}
+{
+}
+
+TrajectoryCostFunction::TrajectoryCostFunction(const IDataSource& data_source,
+                                               const IObjectPredictor* object_predictor,
+                                               const CostOptions& options)
+    : data_source_{data_source},
+      object_predictor_{object_predictor},
+      weights_{options.progress_weight,
+               options.lateral_offset_weight,
+               options.jerk_weight,
+               options.acceleration_weight,
+               options.curvature_weight,
+               (object_predictor != nullptr) ? options.proximity_weight : 0.0,
+               options.lane_change_weight},
+      proximity_radius_{options.proximity_radius.value()}
+{
+}
+
+CostEvaluation TrajectoryCostFunction::Evaluate(const Trajectories& candidates) const
+{
+    return Evaluate(candidates, nullptr);
+}
+
+CostEvaluation TrajectoryCostFunction::Evaluate(const Trajectories& candidates, MonotonicArena* arena) const
+{
+    return Evaluate(candidates, GetPackedObjects(arena), arena);
+}
+
+CostEvaluation TrajectoryCostFunction::Evaluate(const Trajectories& candidates,
+                                                const PackedObjects& objects,
+                                                MonotonicArena* arena) const
+{
+    ArenaVector<const Trajectory*> pointers{ArenaAllocator<const Trajectory*>{arena}};
+    pointers.reserve(candidates.size());
+    std::transform(candidates.begin(),
+                   candidates.end(),
+                   std::back_inserter(pointers),
+                   [](const auto& candidate) { return &candidate; });
+    return Evaluate(pointers, std::numeric_limits<double>::infinity(), objects, arena);
+}
+
+double TrajectoryCostFunction::GetCost(const Trajectory& candidate) const
+{
+    return GetCost(candidate, std::numeric_limits<double>::infinity());
+}
+
+double TrajectoryCostFunction::GetCost(const Trajectory& candidate, const double cost_limit) const
+{
+    return GetCost(candidate, cost_limit, GetPackedObjects(nullptr), nullptr);
+}
+
+double TrajectoryCostFunction::GetCost(const Trajectory& candidate,
+                                       const double cost_limit,
+                                       const PackedObjects& objects,
+                                       MonotonicArena* arena) const
+{
+    const ArenaVector<const Trajectory*> pointers{1U, &candidate, ArenaAllocator<const Trajectory*>{arena}};
+    return Evaluate(pointers, cost_limit, objects, arena).costs.front();
+}
+
+PackedObjects TrajectoryCostFunction::GetPackedObjects(MonotonicArena* arena) const
+{
+    if (!IsEnabled(CostTerm::kProximity))
+    {
+        return PackedObjects{arena};
+    }
+    return PackObjects(object_predictor_->GetPredictedObjects(), data_source_.GetMapCoordinates(), arena);
+}
+
+double TrajectoryCostFunction::GetLowerBound(const Trajectory& candidate) const
+{
+    const auto index = static_cast<std::size_t>(CostTerm::kLaneChange);
+    return (IsEnabled(CostTerm::kLaneChange) && (candidate.lane_id != LaneId::kEgo)) ? weights_[index] : 0.0;
+}
+
+bool TrajectoryCostFunction::HasNonNegativeWeights() const noexcept
+{
+    return std::all_of(weights_.begin(), weights_.end(), [](const auto weight) { return weight >= 0.0; });
+}
+
+bool TrajectoryCostFunction::IsEnabled(const CostTerm term) const noexcept
+{
+    return (weights_[static_cast<std::size_t>(term)] != 0.0);
+}
+
+CostEvaluation TrajectoryCostFunction::Evaluate(const ArenaVector<const Trajectory*>& candidates,
+                                                const double cost_limit,
+                                                const PackedObjects& objects,
+                                                MonotonicArena* arena) const
+{
+    using Clock = std::chrono::steady_clock;
+    const auto number_of_candidates = candidates.size();
+
+    CostEvaluation evaluation{};
+    evaluation.costs.assign(number_of_candidates, 0.0);
+
+    const auto packing_start = Clock::now();
+    const auto packed = GetPackedWaypoints(candidates, arena);
+    evaluation.packing_duration = GetElapsedTime(packing_start);
+
+    // evaluate a term (if enabled) for all the candidates, kernel(candidate, x, y, count) gives the unweighted term.
+    // Weighted terms are accumulated in evaluation order, which is the same for batched and single evaluation.
+    const auto evaluate_term = [&](const CostTerm term, const auto& kernel)
+    {
+        if (!IsEnabled(term) || !evaluation.is_complete)
+        {
+            return;
+        }
+        const auto index = static_cast<std::size_t>(term);
+        const auto start = Clock::now();
+        auto& values = evaluation.terms[index];
+        values.resize(number_of_candidates);
+        for (std::size_t candidate = 0U; candidate < number_of_candidates; ++candidate)
+        {
+            const auto offset = packed.offsets[candidate];
+            const auto count = packed.offsets[candidate + 1U] - offset;
+            values[candidate] = kernel(candidate, packed.x.data() + offset, packed.y.data() + offset, count);
+            evaluation.costs[candidate] += weights_[index] * values[candidate];
+        }
+        evaluation.durations[index] = GetElapsedTime(start);
+
+        // stop once no candidate can stay within the cost limit (terms are non negative)
+        bool is_exceeded = true;
+        for (std::size_t candidate = 0U; candidate < number_of_candidates; ++candidate)
+        {
+            is_exceeded &= ((candidates[candidate]->cost + evaluation.costs[candidate]) > cost_limit);
+        }
+        evaluation.is_complete = !is_exceeded;
+    };
+
+    // cheapest terms first, hence evaluation stopped at the cost limit skips the most expensive ones
+    evaluate_term(CostTerm::kLaneChange,
+                  [&candidates](const std::size_t candidate, const double*, const double*, const std::size_t)
+                  { return (candidates[candidate]->lane_id != LaneId::kEgo) ? 1.0 : 0.0; });
+
+    const auto speed_limit = data_source_.GetSpeedLimit().value();
+    evaluate_term(CostTerm::kProgress,
+                  [speed_limit](const std::size_t, const double* x, const double* y, const std::size_t count)
+                  {
+                      if (count < 2U)
+                      {
+                          return 0.0;
+                      }
+                      const auto reachable = speed_limit * static_cast<double>(count - 1U) * kWaypointSamplingTime;
+                      return (reachable > 0.0) ? (1.0 - std::min(GetPathLength(x, y, count) / reachable, 1.0)) : 0.0;
+                  });
+
+    evaluate_term(CostTerm::kLateralOffset,
+                  [&candidates](const std::size_t candidate, const double* x, const double* y, const std::size_t count)
+                  {
+                      const auto& trajectory = *candidates[candidate];
+                      const auto sum = GetLateralOffsetSum(x,
+                                                           y,
+                                                           count,
+                                                           trajectory.position.x,
+                                                           trajectory.position.y,
+                                                           std::cos(trajectory.yaw.value()),
+                                                           std::sin(trajectory.yaw.value()));
+                      return GetMean(sum, count);
+                  });
+
+    evaluate_term(CostTerm::kAcceleration,
+                  [](const std::size_t, const double* x, const double* y, const std::size_t count)
+                  {
+                      const auto sum = GetSecondDifferenceSum(x, y, count);
+                      return GetMean(sum, (count > 2U) ? (count - 2U) : 0U) /
+                             (kSquaredSamplingTime * kSquaredSamplingTime);
+                  });
+
+    evaluate_term(CostTerm::kJerk,
+                  [](const std::size_t, const double* x, const double* y, const std::size_t count)
+                  {
+                      const auto sum = GetThirdDifferenceSum(x, y, count);
+                      return GetMean(sum, (count > 3U) ? (count - 3U) : 0U) /
+                             (kSquaredSamplingTime * kSquaredSamplingTime * kSquaredSamplingTime);
+                  });
+
+    evaluate_term(CostTerm::kCurvature,
+                  [](const std::size_t, const double* x, const double* y, const std::size_t count)
+                  { return GetMean(GetSquaredCurvatureSum(x, y, count), (count > 2U) ? (count - 2U) : 0U); });
+
+    if (IsEnabled(CostTerm::kProximity) && evaluation.is_complete)
+    {
+        // objects are packed by the caller (once per frame, not included in the term's duration)
+        const auto inverse_squared_radius = 1.0 / (proximity_radius_ * proximity_radius_);
+        const auto proximity = [&objects, inverse_squared_radius](
+                                   const std::size_t, const double* x, const double* y, const std::size_t count)
+            {
+                // waypoint i (previous path followed by trajectory waypoints) is reached after (i + 1) ticks
+                if ((objects.number_of_objects == 0U) || (objects.number_of_steps == 0U))
+                {
+                    return 0.0;
+                }
+                double sum = 0.0;
+                for (std::size_t idx = 0U; idx < count; ++idx)
+                {
+                    const auto time = static_cast<double>(idx + 1U) * kWaypointSamplingTime;
+                    const auto step = std::min(static_cast<std::size_t>((time / objects.time_step) + 0.5),
+                                               objects.number_of_steps - 1U);
+                    const auto row = step * objects.number_of_objects;
+                    sum += GetMaxProximity(x[idx],
+                                           y[idx],
+                                           objects.x.data() + row,
+                                           objects.y.data() + row,
+                                           objects.number_of_objects,
+                                           inverse_squared_radius);
+                }
+                return GetMean(sum, count);
+            };
+        evaluate_term(CostTerm::kProximity, proximity);
+    }
+    return evaluation;
+}
+
+}  // namespace planning
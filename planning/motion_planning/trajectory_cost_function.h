@@ -0,0 +1,203 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_TRAJECTORY_COST_FUNCTION_H
+#define PLANNING_MOTION_PLANNING_TRAJECTORY_COST_FUNCTION_H
+
+#include "planning/common/monotonic_arena.h"
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/i_data_source.h"
+#include "planning/motion_planning/i_object_predictor.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace planning
+{
+/// @brief Cost terms (index into the per term results of CostEvaluation)
+enum class CostTerm : std::uint8_t
+{
+    kProgress = 0U,
+    kLateralOffset = 1U,
+    kJerk = 2U,
+    kAcceleration = 3U,
+    kCurvature = 4U,
+    kProximity = 5U,
+    kLaneChange = 6U
+};
+
+/// @brief Number of cost terms
+constexpr std::size_t kNumberOfCostTerms{7U};
+
+/// @brief Cost of a batch of candidates (per candidate, in order of the evaluated candidates)
+struct CostEvaluation
+{
+    /// @brief Weighted sum of the cost terms
+    std::vector<double> costs{};
+
+    /// @brief Unweighted cost terms (indexed by CostTerm, empty if the term is disabled)
+    std::array<std::vector<double>, kNumberOfCostTerms> terms{};
+
+    /// @brief Duration of each cost term's kernel for the whole batch (indexed by CostTerm, 0 if disabled)
+    std::array<std::chrono::nanoseconds, kNumberOfCostTerms> durations{};
+
+    /// @brief Duration of packing the waypoints of the batch into structure of arrays
+    std::chrono::nanoseconds packing_duration{0};
+
+    /// @brief All enabled terms evaluated (false if evaluation stopped once all candidates exceeded the cost limit,
+    /// i.e. costs are lower bounds)
+    bool is_complete{true};
+
+    /// @brief Unweighted cost term of given candidate (0 if the term is disabled)
+    double GetTerm(const CostTerm term, const std::size_t candidate) const noexcept
+    {
+        const auto& values = terms[static_cast<std::size_t>(term)];
+        return (candidate < values.size()) ? values[candidate] : 0.0;
+    }
+
+    /// @brief Duration of given cost term's kernel
+    std::chrono::nanoseconds GetDuration(const CostTerm term) const noexcept
+    {
+        return durations[static_cast<std::size_t>(term)];
+    }
+};
+
+/// @brief Predicted object positions in Global Coordinates, structure of arrays (time-major), packed once per frame
+/// for the proximity term
+struct PackedObjects
+{
+    /// @brief Constructor. Buffers are drawn from given arena (nullptr uses the heap).
+    explicit PackedObjects(MonotonicArena* arena) : x{ArenaAllocator<double>{arena}}, y{ArenaAllocator<double>{arena}}
+    {
+    }
+
+    /// @brief Object x positions
+    ArenaVector<double> x;
+
+    /// @brief Object y positions
+    ArenaVector<double> y;
+
+    /// @brief Number of objects (per time step)
+    std::size_t number_of_objects{0U};
+
+    /// @brief Number of time steps
+    std::size_t number_of_steps{0U};
+
+    /// @brief Duration between consecutive time steps (in seconds)
+    double time_step{0.0};
+};
+
+/// @brief Multi-criteria cost of trajectories (weighted sum of the cost terms).
+///
+/// @details Waypoints (previous path followed by trajectory waypoints) of all the candidates are packed once into
+/// structure of arrays (contiguous x and y per candidate). Each enabled cost term is then a kernel over all the
+/// candidates and their waypoints (branch free loop over contiguous waypoints, vectorized by the compiler) and is
+/// timed separately. Terms with zero weight are not evaluated.
+///
+/// Terms are evaluated cheapest first (lane change, progress, lateral offset, acceleration, jerk, curvature,
+/// proximity) and accumulated in that order, hence costs are identical whether evaluated in a batch or one by one,
+/// and evaluation against a cost limit skips the most expensive terms.
+///
+/// Predicted objects (and the map to place them) only change once per frame, hence callers evaluating several batches
+/// per frame (e.g. one candidate at a time) pack them once (GetPackedObjects) and pass them to each evaluation.
+class TrajectoryCostFunction
+{
+  public:
+    /// @brief Constructor. Initializes with DataSource and default weights (lane change penalty only).
+    explicit TrajectoryCostFunction(const IDataSource& data_source);
+
+    /// @brief Constructor. Initializes with DataSource, Object Predictor (nullptr disables proximity) and weights.
+    explicit TrajectoryCostFunction(const IDataSource& data_source,
+                                    const IObjectPredictor* object_predictor,
+                                    const CostOptions& options);
+
+    /// @brief Evaluate the cost terms of all the candidates (batched)
+    CostEvaluation Evaluate(const Trajectories& candidates) const;
+
+    /// @brief Evaluate the cost terms of all the candidates (batched), packing buffers are drawn from given arena
+    /// (nullptr uses the heap, the arena is not thread safe)
+    CostEvaluation Evaluate(const Trajectories& candidates, MonotonicArena* arena) const;
+
+    /// @brief Evaluate the cost terms of all the candidates (batched) with packed objects of this frame, packing
+    /// buffers are drawn from given arena (nullptr uses the heap, the arena is not thread safe)
+    CostEvaluation Evaluate(const Trajectories& candidates, const PackedObjects& objects, MonotonicArena* arena) const;
+
+    /// @brief Evaluate the weighted cost of a single candidate (batch of one)
+    double GetCost(const Trajectory& candidate) const;
+
+    /// @brief Evaluate the weighted cost of a single candidate until (candidate.cost + cost) exceeds cost_limit
+    /// @return weighted cost (partial, i.e. lower bound exceeding the limit, if evaluation stopped at the limit)
+    double GetCost(const Trajectory& candidate, const double cost_limit) const;
+
+    /// @brief Evaluate the weighted cost of a single candidate until (candidate.cost + cost) exceeds cost_limit with
+    /// packed objects of this frame, packing buffers are drawn from given arena (nullptr uses the heap, the arena is
+    /// not thread safe)
+    double GetCost(const Trajectory& candidate,
+                   const double cost_limit,
+                   const PackedObjects& objects,
+                   MonotonicArena* arena) const;
+
+    /// @brief Pack the predicted objects of this frame in Global Coordinates (no objects if proximity is disabled or
+    /// without map), buffers are drawn from given arena (nullptr uses the heap, the arena is not thread safe)
+    PackedObjects GetPackedObjects(MonotonicArena* arena) const;
+
+    /// @brief Cheap lower bound of the weighted cost (lane change penalty only, valid for non negative weights)
+    double GetLowerBound(const Trajectory& candidate) const;
+
+    /// @brief Check all the weights to be non negative (i.e. cost only grows with each evaluated term)
+    bool HasNonNegativeWeights() const noexcept;
+
+    /// @brief Check given cost term to be enabled (non zero weight)
+    bool IsEnabled(const CostTerm term) const noexcept;
+
+  private:
+    /// @brief Evaluate the cost terms of given candidates (batched) until all of them exceed the cost limit
+    CostEvaluation Evaluate(const ArenaVector<const Trajectory*>& candidates,
+                            const double cost_limit,
+                            const PackedObjects& objects,
+                            MonotonicArena* arena) const;
+
+    /// @brief DataSource (contains information on Map Points, Speed Limit etc.)
+    const IDataSource& data_source_;
+
+    /// @brief Object Predictor (predicted once per frame, nullptr disables proximity)
+    const IObjectPredictor* object_predictor_;
+
+    /// @brief Weights (indexed by CostTerm)
+    const std::array<double, kNumberOfCostTerms> weights_;
+
+    /// @brief Distance to predicted objects below which proximity is penalized
+    const double proximity_radius_;
+};
+
+/// @brief String Stream for Cost Term (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const CostTerm& term)
+{
+    switch (term)
+    {
+        case CostTerm::kProgress:
+            return out << "CostTerm::kProgress";
+        case CostTerm::kLateralOffset:
+            return out << "CostTerm::kLateralOffset";
+        case CostTerm::kJerk:
+            return out << "CostTerm::kJerk";
+        case CostTerm::kAcceleration:
+            return out << "CostTerm::kAcceleration";
+        case CostTerm::kCurvature:
+            return out << "CostTerm::kCurvature";
+        case CostTerm::kProximity:
+            return out << "CostTerm::kProximity";
+        case CostTerm::kLaneChange:
+            return out << "CostTerm::kLaneChange";
+    }
+    return out;
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_TRAJECTORY_COST_FUNCTION_H
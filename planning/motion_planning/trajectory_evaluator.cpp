@@ -6,13 +6,45 @@
 
 #include "planning/common/logging.h"
 
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 namespace planning
 {
-TrajectoryEvaluator::TrajectoryEvaluator(const IDataSource& data_source) : lane_evaluator_{data_source} {}
+TrajectoryEvaluator::TrajectoryEvaluator(const IDataSource& data_source)
+    : lane_evaluator_{data_source},
+      collision_checker_{nullptr},
+      occupancy_grid_{nullptr},
+      cost_function_{data_source},
+      evaluation_type_{EvaluationType::kExhaustive},
+      arena_{nullptr}
+{
+}
+
+TrajectoryEvaluator::TrajectoryEvaluator(const IDataSource& data_source,
+                                         const IObjectPredictor& object_predictor,
+                                         const TrajectoryEvaluatorOptions& options)
+    : lane_evaluator_{data_source, object_predictor},
+      collision_checker_{options.collision_checker},
+      occupancy_grid_{options.occupancy_grid},
+      cost_function_{data_source, &object_predictor, options.cost_options},
+      evaluation_type_{options.evaluation_type},
+      arena_{options.arena}
+{
+}
 
 Trajectories TrajectoryEvaluator::GetRatedTrajectories(const Trajectories& optimized_trajectories) const
+{
+    EvaluationStatistics statistics{};
+    return GetRatedTrajectories(optimized_trajectories, statistics);
+}
+
+Trajectories TrajectoryEvaluator::GetRatedTrajectories(const Trajectories& optimized_trajectories,
+                                                       EvaluationStatistics& statistics) const
 {
     Trajectories rated_trajectories{};
 
@@ -20,41 +52,214 @@ Trajectories TrajectoryEvaluator::GetRatedTrajectories(const Trajectories& optim
     std::copy_if(optimized_trajectories.begin(),
                  optimized_trajectories.end(),
                  std::back_inserter(rated_trajectories),
-                 [this](const auto& trajectory) {
-                     return (trajectory.global_lane_id != GlobalLaneId::kInvalid) &&
-                            lane_evaluator_.IsValidLane(trajectory.lane_id);
-                 });
-
-    /// @todo Improve Cost adjustment algorithm
-    // update costs for each trajectory
-    const auto adjust_costs = [this](const auto& trajectory)
-    {
-        auto rated_trajectory = trajectory;
-        rated_trajectory.drivable = lane_evaluator_.IsDrivableLane(trajectory.lane_id);
-        if (!rated_trajectory.drivable)
+                 [this](const auto& trajectory) { return IsValidTrajectory(trajectory); });
+    Rate(rated_trajectories, GetLaneEvaluation(), statistics);
+    return rated_trajectories;
+}
+
+void TrajectoryEvaluator::RateTrajectories(Trajectories& trajectories, EvaluationStatistics& statistics) const
+{
+    RateTrajectories(trajectories, GetLaneEvaluation(), statistics);
+}
+
+void TrajectoryEvaluator::RateTrajectories(Trajectories& trajectories,
+                                           const LaneEvaluation& lane_evaluation,
+                                           EvaluationStatistics& statistics) const
+{
+    // discard invalid lane trajectories (keeps order of the remaining ones)
+    trajectories.erase(std::remove_if(trajectories.begin(),
+                                      trajectories.end(),
+                                      [this](const auto& trajectory) { return !IsValidTrajectory(trajectory); }),
+                       trajectories.end());
+    Rate(trajectories, lane_evaluation, statistics);
+}
+
+void TrajectoryEvaluator::Rate(Trajectories& rated_trajectories,
+                               const LaneEvaluation& lane_evaluation,
+                               EvaluationStatistics& statistics) const
+{
+    statistics.candidates += rated_trajectories.size();
+
+    // pack the predicted objects once (shared by all candidates)
+    const auto objects = cost_function_.GetPackedObjects(arena_);
+
+    if ((evaluation_type_ == EvaluationType::kBranchAndBound) && cost_function_.HasNonNegativeWeights())
+    {
+        RateBranchAndBound(rated_trajectories, lane_evaluation, objects, statistics);
+    }
+    else
+    {
+        statistics.evaluated += rated_trajectories.size();
+        RateExhaustive(rated_trajectories, lane_evaluation, objects);
+    }
+
+    if (IsInfoLogged())
+    {
+        std::stringstream log_stream;
+        log_stream << "Evaluated trajectories: " << rated_trajectories.size() << " (pruned " << statistics.GetPruned()
+                   << " of " << statistics.candidates << " candidates so far)" << std::endl;
+        const auto n_logged = std::min(rated_trajectories.size(), kMaxLoggedTrajectories);
+        std::for_each(rated_trajectories.begin(),
+                      rated_trajectories.begin() + n_logged,
+                      [&log_stream](const auto& trajectory) { log_stream << " (+) " << trajectory << std::endl; });
+        log_stream << " (+) ... (more " << rated_trajectories.size() - n_logged << " trajectories)" << std::endl;
+        LOG(INFO) << log_stream.str();
+    }
+}
+
+void TrajectoryEvaluator::RateExhaustive(Trajectories& candidates,
+                                         const LaneEvaluation& lane_evaluation,
+                                         const PackedObjects& objects) const
+{
+    // rate drivability for each trajectory, then evaluate the cost terms of all the trajectories at once
+    for (auto& trajectory : candidates)
+    {
+        trajectory.drivable = IsDrivableTrajectory(trajectory, lane_evaluation);
+    }
+    const auto cost_evaluation = cost_function_.Evaluate(candidates, objects, arena_);
+    for (std::size_t idx = 0U; idx < candidates.size(); ++idx)
+    {
+        auto& trajectory = candidates[idx];
+        trajectory.cost = trajectory.drivable ? (trajectory.cost + cost_evaluation.costs[idx])
+                                              : std::numeric_limits<double>::infinity();
+    }
+
+    if (IsInfoLogged())
+    {
+        std::stringstream log_stream;
+        log_stream << "Cost terms packed in " << cost_evaluation.packing_duration.count() << " ns";
+        for (std::size_t term = 0U; term < kNumberOfCostTerms; ++term)
         {
-            rated_trajectory.cost = std::numeric_limits<double>::infinity();
+            if (cost_function_.IsEnabled(static_cast<CostTerm>(term)))
+            {
+                log_stream << ", " << static_cast<CostTerm>(term) << " " << cost_evaluation.durations[term].count()
+                           << " ns";
+            }
         }
-        else if (trajectory.lane_id != LaneId::kEgo)
+        LOG(INFO) << log_stream.str();
+    }
+}
+
+void TrajectoryEvaluator::RateBranchAndBound(Trajectories& candidates,
+                                             const LaneEvaluation& lane_evaluation,
+                                             const PackedObjects& objects,
+                                             EvaluationStatistics& statistics) const
+{
+    const auto infinity = std::numeric_limits<double>::infinity();
+
+    // candidates on not drivable lanes are rated without evaluating their cost terms (as exhaustive evaluation)
+    ArenaVector<std::size_t> order{ArenaAllocator<std::size_t>{arena_}};
+    order.reserve(candidates.size());
+    ArenaVector<double> lower_bounds(candidates.size(), 0.0, ArenaAllocator<double>{arena_});
+    for (std::size_t idx = 0U; idx < candidates.size(); ++idx)
+    {
+        auto& trajectory = candidates[idx];
+        if (lane_evaluation.IsDrivable(trajectory.lane_id))
         {
-            rated_trajectory.cost += 1;
+            lower_bounds[idx] = trajectory.cost + cost_function_.GetLowerBound(trajectory);
+            order.push_back(idx);
         }
         else
         {
-            // Ego Lane cost to minimal if drivable (i.e. cost=0)
+            trajectory.drivable = false;
+            trajectory.cost = infinity;
+            ++statistics.evaluated;
         }
+    }
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&lower_bounds](const auto lhs, const auto rhs) { return lower_bounds[lhs] < lower_bounds[rhs]; });
 
-        return rated_trajectory;
-    };
-    std::transform(rated_trajectories.begin(), rated_trajectories.end(), rated_trajectories.begin(), adjust_costs);
+    // ties with the best cost are kept, hence the prioritizer breaks them as with exhaustive evaluation
+    ArenaVector<std::uint8_t> is_pruned(candidates.size(), 0U, ArenaAllocator<std::uint8_t>{arena_});
+    auto best_cost = infinity;
+    for (auto it = order.begin(); it != order.end(); ++it)
+    {
+        auto& trajectory = candidates[*it];
+        if (lower_bounds[*it] > best_cost)
+        {
+            statistics.pruned_by_bound += static_cast<std::size_t>(std::distance(it, order.end()));
+            std::for_each(it, order.end(), [&is_pruned](const auto idx) { is_pruned[idx] = 1U; });
+            break;
+        }
 
-    std::stringstream log_stream;
-    log_stream << "Evaluated trajectories: " << rated_trajectories.size() << std::endl;
-    std::for_each(rated_trajectories.begin(),
-                  rated_trajectories.end(),
-                  [&log_stream](const auto& trajectory) { log_stream << " (+) " << trajectory << std::endl; });
-    LOG(INFO) << log_stream.str();
-    return rated_trajectories;
+        const auto cost = trajectory.cost + cost_function_.GetCost(trajectory, best_cost, objects, arena_);
+        if (cost > best_cost)
+        {
+            ++statistics.pruned_by_partial_cost;
+            is_pruned[*it] = 1U;
+            continue;
+        }
+
+        ++statistics.evaluated;
+        trajectory.drivable = IsDrivableTrajectory(trajectory, lane_evaluation);
+        trajectory.cost = trajectory.drivable ? cost : infinity;
+        best_cost = std::min(best_cost, trajectory.cost);
+    }
+
+    // remove pruned candidates (keeps order of the remaining ones, kept candidates are never moved onto themselves)
+    std::size_t number_of_rated{0U};
+    for (std::size_t idx = 0U; idx < candidates.size(); ++idx)
+    {
+        if (is_pruned[idx] == 0U)
+        {
+            if (idx != number_of_rated)
+            {
+                candidates[number_of_rated] = std::move(candidates[idx]);
+            }
+            ++number_of_rated;
+        }
+    }
+    candidates.resize(number_of_rated);
+}
+
+bool TrajectoryEvaluator::IsValidTrajectory(const Trajectory& optimized_trajectory) const
+{
+    return (optimized_trajectory.global_lane_id != GlobalLaneId::kInvalid) &&
+           lane_evaluator_.IsValidLane(optimized_trajectory.lane_id);
+}
+
+Trajectory TrajectoryEvaluator::GetRatedTrajectory(const Trajectory& optimized_trajectory) const
+{
+    return GetRatedTrajectory(optimized_trajectory, GetLaneEvaluation());
+}
+
+LaneEvaluation TrajectoryEvaluator::GetLaneEvaluation() const
+{
+    // with occupancy grid, occupancy is evaluated per trajectory (corridor) instead of per lane
+    return (occupancy_grid_ != nullptr) ? lane_evaluator_.GetLaneValidity() : lane_evaluator_.GetLaneEvaluation();
+}
+
+Trajectory TrajectoryEvaluator::GetRatedTrajectory(const Trajectory& optimized_trajectory,
+                                                   const LaneEvaluation& lane_evaluation) const
+{
+    auto rated_trajectory = optimized_trajectory;
+    rated_trajectory.drivable = IsDrivableTrajectory(optimized_trajectory, lane_evaluation);
+    if (!rated_trajectory.drivable)
+    {
+        rated_trajectory.cost = std::numeric_limits<double>::infinity();
+    }
+    else
+    {
+        rated_trajectory.cost += cost_function_.GetCost(optimized_trajectory);
+    }
+
+    return rated_trajectory;
+}
+
+bool TrajectoryEvaluator::IsDrivableTrajectory(const Trajectory& optimized_trajectory,
+                                               const LaneEvaluation& lane_evaluation) const
+{
+    auto drivable = lane_evaluation.IsDrivable(optimized_trajectory.lane_id);
+    if (drivable && (occupancy_grid_ != nullptr))
+    {
+        drivable = occupancy_grid_->IsCorridorFree(optimized_trajectory);
+    }
+    if (drivable && (collision_checker_ != nullptr))
+    {
+        drivable = collision_checker_->IsCollisionFree(optimized_trajectory);
+    }
+    return drivable;
 }
 
 }  // namespace planning
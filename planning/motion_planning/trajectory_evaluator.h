@@ -5,15 +5,43 @@
 #ifndef PLANNING_MOTION_PLANNING_TRAJECTORY_EVALUATOR_H
 #define PLANNING_MOTION_PLANNING_TRAJECTORY_EVALUATOR_H
 
+#include "planning/common/monotonic_arena.h"
 #include "planning/datatypes/sensor_fusion.h"
 #include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/i_collision_checker.h"
+#include "planning/motion_planning/i_occupancy_grid.h"
 #include "planning/motion_planning/i_trajectory_evaluator.h"
 #include "planning/motion_planning/lane_evaluator.h"
+#include "planning/motion_planning/motion_planning_options.h"
+#include "planning/motion_planning/trajectory_cost_function.h"
 
 #include <algorithm>
 
 namespace planning
 {
+/// @brief Optional collaborators and evaluation options of the Trajectory Evaluator
+struct TrajectoryEvaluatorOptions
+{
+    /// @brief Collision Checker, colliding trajectories are not drivable even on a drivable lane (nullptr if only
+    /// lanes are evaluated)
+    const ICollisionChecker* collision_checker{nullptr};
+
+    /// @brief Occupancy Grid, corridor of each trajectory is queried instead of evaluating lane level occupancy
+    /// (nullptr if not used)
+    const IOccupancyGrid* occupancy_grid{nullptr};
+
+    /// @brief Cost terms of drivable trajectories
+    CostOptions cost_options{};
+
+    /// @brief Evaluation of the cost terms (exhaustive or branch and bound)
+    EvaluationType evaluation_type{EvaluationType::kExhaustive};
+
+    /// @brief Per frame arena for scratch buffers (nullptr uses the heap)
+    /// @note The arena is used by GetRatedTrajectories/RateTrajectories only (single threaded), rating single
+    /// trajectories (e.g. from multiple threads) always uses the heap.
+    MonotonicArena* arena{nullptr};
+};
+
 /// @brief Trajectory Evaluator
 class TrajectoryEvaluator : public ITrajectoryEvaluator
 {
@@ -21,12 +49,85 @@ class TrajectoryEvaluator : public ITrajectoryEvaluator
     /// @brief Constructor. Initializes with provided DataSource
     explicit TrajectoryEvaluator(const IDataSource& data_source);
 
+    /// @brief Constructor. Initializes with provided DataSource, Object Predictor (predicted once per frame) and
+    /// options
+    explicit TrajectoryEvaluator(const IDataSource& data_source,
+                                 const IObjectPredictor& object_predictor,
+                                 const TrajectoryEvaluatorOptions& options);
+
     /// @brief Get Rated Trajectories for provided optimized trajectories.
     Trajectories GetRatedTrajectories(const Trajectories& optimized_trajectories) const override;
 
+    /// @brief Get Rated Trajectories for provided optimized trajectories and accumulate evaluation counters.
+    Trajectories GetRatedTrajectories(const Trajectories& optimized_trajectories,
+                                      EvaluationStatistics& statistics) const override;
+
+    /// @brief Rate provided optimized trajectories in place (invalid and pruned ones are removed) and accumulate
+    /// evaluation counters.
+    void RateTrajectories(Trajectories& trajectories, EvaluationStatistics& statistics) const override;
+
+    /// @brief Rate provided optimized trajectories in place with evaluated lanes (invalid and pruned ones are removed)
+    /// and accumulate evaluation counters.
+    void RateTrajectories(Trajectories& trajectories,
+                          const LaneEvaluation& lane_evaluation,
+                          EvaluationStatistics& statistics) const override;
+
+    /// @brief Check whether optimized trajectory is on a valid lane.
+    bool IsValidTrajectory(const Trajectory& optimized_trajectory) const override;
+
+    /// @brief Get Rated Trajectory (drivability and cost) for a single optimized trajectory.
+    Trajectory GetRatedTrajectory(const Trajectory& optimized_trajectory) const override;
+
+    /// @brief Evaluate all the lanes once (single pass over the objects, validity only with Occupancy Grid).
+    LaneEvaluation GetLaneEvaluation() const override;
+
+    /// @brief Get Rated Trajectory (drivability and cost) for a single optimized trajectory with evaluated lanes.
+    Trajectory GetRatedTrajectory(const Trajectory& optimized_trajectory,
+                                  const LaneEvaluation& lane_evaluation) const override;
+
   private:
+    /// @brief Rate the valid candidates (exhaustive or branch and bound) with evaluated lanes and log the rated ones
+    void Rate(Trajectories& rated_trajectories,
+              const LaneEvaluation& lane_evaluation,
+              EvaluationStatistics& statistics) const;
+
+    /// @brief Rate all the valid candidates (drivability, then all cost terms of the drivable ones)
+    void RateExhaustive(Trajectories& candidates,
+                        const LaneEvaluation& lane_evaluation,
+                        const PackedObjects& objects) const;
+
+    /// @brief Rate the valid candidates by branch and bound, candidates which can't be the best one are removed.
+    ///
+    /// @details Candidates on drivable lanes are visited in order of their lower bound (cost so far plus cheap cost
+    /// terms). Cost terms are evaluated (cheapest first) only until the partial cost exceeds the best cost so far,
+    /// then occupancy and collisions are checked for the remaining ones. Once a lower bound exceeds the best cost, all
+    /// the remaining candidates are pruned. Costs only grow with each term (non negative weights), hence pruned
+    /// candidates would have been rated worse than the best one, which is rated identically to exhaustive evaluation.
+    void RateBranchAndBound(Trajectories& candidates,
+                            const LaneEvaluation& lane_evaluation,
+                            const PackedObjects& objects,
+                            EvaluationStatistics& statistics) const;
+
+    /// @brief Drivability of a single optimized trajectory with evaluated lanes (lanes, occupancy and collisions)
+    bool IsDrivableTrajectory(const Trajectory& optimized_trajectory, const LaneEvaluation& lane_evaluation) const;
+
     /// @brief Lane Evaluator
     LaneEvaluator lane_evaluator_;
+
+    /// @brief Collision Checker (nullptr if only lanes are evaluated)
+    const ICollisionChecker* collision_checker_;
+
+    /// @brief Occupancy Grid (nullptr if lane level occupancy is evaluated)
+    const IOccupancyGrid* occupancy_grid_;
+
+    /// @brief Cost terms of drivable trajectories
+    TrajectoryCostFunction cost_function_;
+
+    /// @brief Evaluation of the cost terms (branch and bound requires non negative weights)
+    EvaluationType evaluation_type_;
+
+    /// @brief Per frame arena for scratch buffers of GetRatedTrajectories (nullptr uses the heap)
+    MonotonicArena* arena_;
 };
 }  // namespace planning
 
@@ -5,28 +5,110 @@
 #include "planning/motion_planning/trajectory_optimizer.h"
 
 #include "planning/common/logging.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/fixed_size_spline.h"
 
 #include <algorithm>
+#include <array>
 #include <sstream>
 #include <vector>
 
 namespace planning
 {
-TrajectoryOptimizer::TrajectoryOptimizer(const IDataSource& data_source) : data_source_{data_source} {}
+namespace
+{
+/// @brief Samples waypoints (in global coordinates) along provided spline, spaced by the straight line
+/// approximation of the distance travelled for the trajectory's target velocity
+///
+/// @tparam Spline - spline type providing `double operator()(double x) const`
+///
+/// @param spline [in] - spline through trajectory waypoints (in local coordinates)
+/// @param n_waypoints [in] - number of waypoints to be sampled
+/// @param trajectory [in,out] - trajectory to append sampled waypoints to
+template <typename Spline>
+void AppendLinearApproximatedWaypoints(const Spline& spline, const std::size_t n_waypoints, Trajectory& trajectory)
+{
+    // spline waypoints at 30m intervals
+    const auto target_position = GlobalCoordinates{30.0, spline(30.0)};
+    const auto target_distance =
+        std::sqrt((target_position.x * target_position.x) + (target_position.y * target_position.y));
+    double x_add_on = 0.0;
 
-Trajectories TrajectoryOptimizer::GetOptimizedTrajectories(const Trajectories& planned_trajectories) const
+    const auto yaw = trajectory.yaw;
+    const auto position = trajectory.position;
+    const auto target_velocity = trajectory.velocity.value();
+    for (std::size_t i = 1; i <= n_waypoints; i++)
+    {
+        const double N = (target_distance / (0.02 * target_velocity));
+        double x_point = x_add_on + (target_position.x / N);
+        double y_point = spline(x_point);
+
+        x_add_on = x_point;
+
+        double x_ref = x_point;
+        double y_ref = y_point;
+
+        x_point = (x_ref * units::math::cos(yaw) - y_ref * units::math::sin(yaw));
+        y_point = (x_ref * units::math::sin(yaw) + y_ref * units::math::cos(yaw));
+
+        x_point += position.x;
+        y_point += position.y;
+
+        trajectory.waypoints.push_back(GlobalCoordinates{x_point, y_point});
+    }
+}
+
+/// @brief Samples waypoints (in global coordinates) along provided spline, spaced by the exact arc length
+/// travelled each tick for the trajectory's target velocity
+///
+/// @tparam Spline - spline type providing `double operator()(double x) const`
+///
+/// @param spline [in] - spline through trajectory waypoints (in local coordinates)
+/// @param n_waypoints [in] - number of waypoints to be sampled
+/// @param trajectory [in,out] - trajectory to append sampled waypoints to
+template <typename Spline>
+void AppendArcLengthWaypoints(const Spline& spline, const std::size_t n_waypoints, Trajectory& trajectory)
 {
-    auto optimized_trajectories = Trajectories{};
+    VelocityProfile velocity_profile{};
+    velocity_profile.fill(trajectory.velocity.value());
 
-    std::transform(planned_trajectories.begin(),
-                   planned_trajectories.end(),
-                   std::back_inserter(optimized_trajectories),
-                   [this](const auto& trajectory) { return GetOptimizedTrajectory(trajectory); });
+    const auto count = std::min(n_waypoints, kTotalWaypoints);
+    std::array<GlobalCoordinates, kTotalWaypoints> waypoints{};
+    ResampleByArcLength(spline, velocity_profile, count, trajectory.position, trajectory.yaw, waypoints);
+
+    trajectory.waypoints.insert(trajectory.waypoints.end(), waypoints.begin(), waypoints.begin() + count);
+}
+
+/// @brief Samples waypoints (in global coordinates) along provided spline with given resampling strategy
+template <typename Spline>
+void AppendSampledWaypoints(const Spline& spline,
+                            const std::size_t n_waypoints,
+                            const ResamplingType resampling_type,
+                            Trajectory& trajectory)
+{
+    if (resampling_type == ResamplingType::kArcLength)
+    {
+        AppendArcLengthWaypoints(spline, n_waypoints, trajectory);
+    }
+    else
+    {
+        AppendLinearApproximatedWaypoints(spline, n_waypoints, trajectory);
+    }
+}
+
+/// @brief Log optimized trajectories (verbose information)
+void LogOptimizedTrajectories(const Trajectories& optimized_trajectories)
+{
+    if (!IsInfoLogged())
+    {
+        return;
+    }
 
     std::stringstream log_stream;
     log_stream << "Optimized trajectories: " << optimized_trajectories.size() << std::endl;
+    const auto n_logged = std::min(optimized_trajectories.size(), kMaxLoggedTrajectories);
     std::for_each(optimized_trajectories.begin(),
-                  optimized_trajectories.end(),
+                  optimized_trajectories.begin() + n_logged,
                   [&log_stream](const auto& trajectory)
                   {
                       log_stream << " (+) " << trajectory << std::endl;
@@ -38,64 +120,98 @@ Trajectories TrajectoryOptimizer::GetOptimizedTrajectories(const Trajectories& p
                       log_stream << "     => ... (more " << trajectory.waypoints.size() - n_samples << " waypoints)"
                                  << std::endl;
                   });
+    log_stream << " (+) ... (more " << optimized_trajectories.size() - n_logged << " trajectories)" << std::endl;
     LOG(INFO) << log_stream.str();
-    return optimized_trajectories;
 }
+}  // namespace
 
-Trajectory TrajectoryOptimizer::GetOptimizedTrajectory(const Trajectory& planned_trajectory) const
+TrajectoryOptimizer::TrajectoryOptimizer(const IDataSource& data_source)
+    : TrajectoryOptimizer{data_source, SplineType::kFixedSize}
 {
-    auto optimized_trajectory = planned_trajectory;
-    const auto previous_path_global = data_source_.GetPreviousPathInGlobalCoords();
-
-    // keep only calculated waypoints from copied version of planned trajectory
-    // erase preserve previous path waypoints
-    optimized_trajectory.waypoints.erase(optimized_trajectory.waypoints.begin(),
-                                         optimized_trajectory.waypoints.begin() + previous_path_global.size());
-
-    // split waypoints to points_x and points_y for spline utility
-    std::vector<double> points_x;
-    std::vector<double> points_y;
-    for (const auto& waypoint : optimized_trajectory.waypoints)
-    {
-        points_x.push_back(waypoint.x);
-        points_y.push_back(waypoint.y);
-    }
-
-    tk::spline spline;
+}
 
-    spline.set_points(points_x, points_y);
+TrajectoryOptimizer::TrajectoryOptimizer(const IDataSource& data_source, const SplineType spline_type)
+    : TrajectoryOptimizer{data_source, spline_type, ResamplingType::kArcLength}
+{
+}
 
-    // spline waypoints at 30m intervals
-    const auto target_position = GlobalCoordinates{30.0, spline(30.0)};
-    const auto target_distance =
-        std::sqrt((target_position.x * target_position.x) + (target_position.y * target_position.y));
-    double x_add_on = 0.0;
+TrajectoryOptimizer::TrajectoryOptimizer(const IDataSource& data_source,
+                                         const SplineType spline_type,
+                                         const ResamplingType resampling_type)
+    : data_source_{data_source}, spline_type_{spline_type}, resampling_type_{resampling_type}
+{
+}
 
-    const auto yaw = optimized_trajectory.yaw;
-    const auto position = optimized_trajectory.position;
-    const auto target_velocity = optimized_trajectory.velocity.value();
-    constexpr auto kTotalWaypoints = 50U;
-    for (std::size_t i = 1; i <= kTotalWaypoints - previous_path_global.size(); i++)
-    {
-        const double N = (target_distance / (0.02 * target_velocity));
-        double x_point = x_add_on + (target_position.x / N);
-        double y_point = spline(x_point);
+Trajectories TrajectoryOptimizer::GetOptimizedTrajectories(const Trajectories& planned_trajectories) const
+{
+    auto optimized_trajectories = Trajectories{};
 
-        x_add_on = x_point;
+    std::transform(planned_trajectories.begin(),
+                   planned_trajectories.end(),
+                   std::back_inserter(optimized_trajectories),
+                   [this](const auto& trajectory) { return GetOptimizedTrajectory(trajectory); });
 
-        double x_ref = x_point;
-        double y_ref = y_point;
+    LogOptimizedTrajectories(optimized_trajectories);
+    return optimized_trajectories;
+}
 
-        x_point = (x_ref * units::math::cos(yaw) - y_ref * units::math::sin(yaw));
-        y_point = (x_ref * units::math::sin(yaw) + y_ref * units::math::cos(yaw));
+void TrajectoryOptimizer::OptimizeTrajectories(Trajectories& trajectories) const
+{
+    std::for_each(trajectories.begin(), trajectories.end(), [this](auto& trajectory) { Optimize(trajectory); });
+    LogOptimizedTrajectories(trajectories);
+}
 
-        x_point += position.x;
-        y_point += position.y;
+Trajectory TrajectoryOptimizer::GetOptimizedTrajectory(const Trajectory& planned_trajectory) const
+{
+    auto optimized_trajectory = planned_trajectory;
+    Optimize(optimized_trajectory);
+    return optimized_trajectory;
+}
 
-        optimized_trajectory.waypoints.push_back(GlobalCoordinates{x_point, y_point});
+void TrajectoryOptimizer::Optimize(Trajectory& trajectory) const
+{
+    // planned waypoints are the anchors (in local coordinates), optimized waypoints continue the previous path
+    if (trajectory.previous_path == nullptr)
+    {
+        trajectory.previous_path = data_source_.GetSharedPreviousPath();
     }
 
-    return optimized_trajectory;
+    const auto previous_path_size = GetPreviousPathSize(trajectory);
+    const auto n_waypoints = (previous_path_size < kTotalWaypoints) ? (kTotalWaypoints - previous_path_size) : 0U;
+    if ((spline_type_ == SplineType::kFixedSize) && (trajectory.waypoints.size() == kTrajectoryAnchorPoints))
+    {
+        FixedSizeSpline<kTrajectoryAnchorPoints>::Points points_x{};
+        FixedSizeSpline<kTrajectoryAnchorPoints>::Points points_y{};
+        for (std::size_t idx = 0U; idx < kTrajectoryAnchorPoints; ++idx)
+        {
+            points_x[idx] = trajectory.waypoints[idx].x;
+            points_y[idx] = trajectory.waypoints[idx].y;
+        }
+        const FixedSizeSpline<kTrajectoryAnchorPoints> spline{points_x, points_y};
+
+        // anchors are consumed by the spline, waypoints' capacity is reused for the optimized waypoints
+        trajectory.waypoints.clear();
+        trajectory.waypoints.reserve(n_waypoints);
+        AppendSampledWaypoints(spline, n_waypoints, resampling_type_, trajectory);
+    }
+    else
+    {
+        // split waypoints to points_x and points_y for spline utility
+        std::vector<double> points_x;
+        std::vector<double> points_y;
+        for (const auto& waypoint : trajectory.waypoints)
+        {
+            points_x.push_back(waypoint.x);
+            points_y.push_back(waypoint.y);
+        }
+
+        tk::spline spline;
+        spline.set_points(points_x, points_y);
+
+        trajectory.waypoints.clear();
+        trajectory.waypoints.reserve(n_waypoints);
+        AppendSampledWaypoints(spline, n_waypoints, resampling_type_, trajectory);
+    }
 }
 
 }  // namespace planning
@@ -10,10 +10,28 @@
 
 #include <spline.h>
 
+#include <cstdint>
 #include <memory>
 
 namespace planning
 {
+/// @brief Number of anchor waypoints produced by Trajectory Planner (2x previous path, 3x further along the lane)
+constexpr std::size_t kTrajectoryAnchorPoints{5U};
+
+/// @brief Spline implementation used for smoothing the trajectory
+enum class SplineType : std::uint8_t
+{
+    kDynamic = 0U,    ///< tk::spline (heap allocated, any number of points)
+    kFixedSize = 1U,  ///< FixedSizeSpline (stack allocated, kTrajectoryAnchorPoints points)
+};
+
+/// @brief Resampling strategy for waypoints along the smoothened trajectory
+enum class ResamplingType : std::uint8_t
+{
+    kLinearApproximation = 0U,  ///< spacing based on straight line distance to x = 30m
+    kArcLength = 1U,            ///< spacing based on precomputed arc length table (exact distance per tick)
+};
+
 /// @brief Trajectory Optimizer
 class TrajectoryOptimizer : public ITrajectoryOptimizer
 {
@@ -21,15 +39,35 @@ class TrajectoryOptimizer : public ITrajectoryOptimizer
     /// @brief Constructor. Initializes with provided DataSource
     explicit TrajectoryOptimizer(const IDataSource& data_source);
 
+    /// @brief Constructor. Initializes with provided DataSource and Spline implementation
+    explicit TrajectoryOptimizer(const IDataSource& data_source, const SplineType spline_type);
+
+    /// @brief Constructor. Initializes with provided DataSource, Spline implementation and Resampling strategy
+    explicit TrajectoryOptimizer(const IDataSource& data_source,
+                                 const SplineType spline_type,
+                                 const ResamplingType resampling_type);
+
     /// @brief Provide Optimized Trajectories set using Spline Equations
     Trajectories GetOptimizedTrajectories(const Trajectories& planned_trajectories) const override;
 
-  private:
     /// @brief Smoothen/Optimize Trajectory with Spline for target_velocity
-    Trajectory GetOptimizedTrajectory(const Trajectory& planned_trajectory) const;
+    Trajectory GetOptimizedTrajectory(const Trajectory& planned_trajectory) const override;
+
+    /// @brief Replace the anchor waypoints of all planned trajectories with their optimized waypoints (in place)
+    void OptimizeTrajectories(Trajectories& trajectories) const override;
+
+  private:
+    /// @brief Smoothen/Optimize Trajectory with Spline for target_velocity (anchors are replaced in place)
+    void Optimize(Trajectory& trajectory) const;
 
     /// @brief DataSource (contains information on VehicleDynamics, SensorFusion, Map Points etc.)
     const IDataSource& data_source_;
+
+    /// @brief Spline implementation
+    const SplineType spline_type_;
+
+    /// @brief Resampling strategy
+    const ResamplingType resampling_type_;
 };
 
 }  // namespace planning
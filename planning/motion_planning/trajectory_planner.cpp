@@ -6,13 +6,60 @@
 
 #include "planning/common/logging.h"
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 namespace planning
 {
+namespace
+{
+/// @brief Log previous path and planned trajectories (verbose information)
+void LogPlannedTrajectories(const PreviousPathGlobal& previous_path_global, const Trajectories& trajectories)
+{
+    if (!IsInfoLogged())
+    {
+        return;
+    }
+
+    std::stringstream log_stream;
+    log_stream << "Previous Path size: " << previous_path_global.size() << std::endl;
+    if (!previous_path_global.empty())
+    {
+        const auto n_samples =
+            std::min(static_cast<std::size_t>(previous_path_global.size()), static_cast<std::size_t>(10));
+        std::for_each(previous_path_global.begin(),
+                      previous_path_global.begin() + n_samples,
+                      [&log_stream](const auto& wp) { log_stream << "     => " << wp << std::endl; });
+        log_stream << "     => ... (more " << previous_path_global.size() - n_samples << " waypoints)" << std::endl;
+    }
+
+    log_stream << "Planned trajectories: " << trajectories.size() << std::endl;
+    const auto n_logged = std::min(trajectories.size(), kMaxLoggedTrajectories);
+    std::for_each(trajectories.begin(),
+                  trajectories.begin() + n_logged,
+                  [&log_stream](const auto& trajectory)
+                  {
+                      log_stream << " (+) " << trajectory << std::endl;
+                      const auto n_samples =
+                          std::min(static_cast<std::size_t>(trajectory.waypoints.size()), static_cast<std::size_t>(10));
+                      std::for_each(trajectory.waypoints.begin(),
+                                    trajectory.waypoints.begin() + n_samples,
+                                    [&log_stream](const auto& wp) { log_stream << "     => " << wp << std::endl; });
+                      log_stream << "     => ... (more " << trajectory.waypoints.size() - n_samples << " waypoints)"
+                                 << std::endl;
+                  });
+    log_stream << " (+) ... (more " << trajectories.size() - n_logged << " trajectories)" << std::endl;
+    LOG(INFO) << log_stream.str();
+}
+}  // namespace
+
 TrajectoryPlanner::TrajectoryPlanner(const IDataSource& data_source) : data_source_{data_source} {}
 
 Trajectories TrajectoryPlanner::GetPlannedTrajectories(const std::vector<Maneuver>& maneuvers) const
 {
-    const auto trajectories = GetTrajectories(maneuvers);
+    Trajectories trajectories{};
+    PlanTrajectories(maneuvers, trajectories);
     return trajectories;
 }
 
@@ -21,8 +68,9 @@ Trajectory TrajectoryPlanner::GetInitialTrajectory() const
     Trajectory trajectory{};
 
     const auto vehicle_dynamics = data_source_.GetVehicleDynamics();
-    const auto previous_path_global = data_source_.GetPreviousPathInGlobalCoords();
-    const auto previous_path_size = data_source_.GetPreviousPathInGlobalCoords().size();
+    const auto previous_path = data_source_.GetSharedPreviousPath();
+    const auto& previous_path_global = *previous_path;
+    const auto previous_path_size = previous_path_global.size();
     // no previous waypoints, initialize current waypoints
     if (previous_path_size < 2)
     {
@@ -52,20 +100,24 @@ Trajectory TrajectoryPlanner::GetInitialTrajectory() const
     return trajectory;
 }
 
-Trajectory TrajectoryPlanner::GetCalculatedTrajectory(const LaneId lane_id) const
+Trajectory TrajectoryPlanner::GetCalculatedTrajectory(const LaneId lane_id,
+                                                      const units::length::meter_t horizon,
+                                                      const Trajectory& initial_trajectory,
+                                                      const MapCoordinatesList& map_coordinates) const
 {
     // Waypoints based on previous path
-    auto trajectory = GetInitialTrajectory();
+    auto trajectory = initial_trajectory;
     const auto vehicle_dynamics = data_source_.GetVehicleDynamics();
 
     // Set further waypoints based on going further along highway in desired lane
     const auto lane = static_cast<std::int32_t>(lane_id);
-    trajectory.waypoints.push_back(
-        GetGlobalCoordinates(FrenetCoordinates{vehicle_dynamics.frenet_coords.s + 30.0, 2.0 + (4.0 * lane), 0.0, 0.0}));
-    trajectory.waypoints.push_back(
-        GetGlobalCoordinates(FrenetCoordinates{vehicle_dynamics.frenet_coords.s + 60.0, 2.0 + (4.0 * lane), 0.0, 0.0}));
-    trajectory.waypoints.push_back(
-        GetGlobalCoordinates(FrenetCoordinates{vehicle_dynamics.frenet_coords.s + 90.0, 2.0 + (4.0 * lane), 0.0, 0.0}));
+    const auto spacing = horizon.value();
+    for (const auto n_spacings : {1.0, 2.0, 3.0})
+    {
+        trajectory.waypoints.push_back(GetGlobalCoordinates(
+            FrenetCoordinates{vehicle_dynamics.frenet_coords.s + (n_spacings * spacing), 2.0 + (4.0 * lane), 0.0, 0.0},
+            map_coordinates));
+    }
 
     // Shift and rotate points to local coordinates
     const auto shift_rotate_waypoints = [&position = trajectory.position, &yaw = trajectory.yaw](const auto& waypoint)
@@ -99,73 +151,94 @@ GlobalLaneId TrajectoryPlanner::GetGlobalLaneId(const LaneId lane_id) const
     }
 }
 
-Trajectories TrajectoryPlanner::GetTrajectories(const std::vector<Maneuver>& maneuvers) const
+void TrajectoryPlanner::PlanTrajectories(const std::vector<Maneuver>& maneuvers, Trajectories& trajectories) const
 {
-    Trajectories trajectories{};
-    const auto previous_path_global = data_source_.GetPreviousPathInGlobalCoords();
-    const auto vehicle_dynamics = data_source_.GetVehicleDynamics();
-    std::int32_t unique_id = 0;
-    for (const auto& maneuver : maneuvers)
-    {
-        Trajectory trajectory{};
-        const auto lane_id = maneuver.GetLaneId();
+    // existing trajectories (and their waypoints' capacity) are reused
+    trajectories.resize(maneuvers.size());
+    const auto previous_path = data_source_.GetSharedPreviousPath();
+    const auto& previous_path_global = *previous_path;
 
-        /// update waypoints with old path inputs
-        trajectory.waypoints.insert(
-            trajectory.waypoints.end(), previous_path_global.begin(), previous_path_global.end());
-        trajectory.position = vehicle_dynamics.global_coords;
-        trajectory.yaw = vehicle_dynamics.yaw;
-        trajectory.velocity = maneuver.GetVelocity();
-        trajectory.unique_id = ++unique_id;
-        trajectory.lane_id = lane_id;
-        trajectory.global_lane_id = GetGlobalLaneId(lane_id);
-
-        /// calculate further waypoints for next path
-        const auto calculated_trajectory = GetCalculatedTrajectory(lane_id);
-
-        /// update waypoints
-        trajectory.waypoints.insert(
-            trajectory.waypoints.end(), calculated_trajectory.waypoints.begin(), calculated_trajectory.waypoints.end());
-
-        /// append to trajectories
-        trajectories.push_back(trajectory);
-    }
+    // query per frame inputs once for all maneuvers
+    const auto initial_trajectory = GetInitialTrajectory();
+    const auto map_coordinates = data_source_.GetMapCoordinates();
 
-    std::stringstream log_stream;
-    log_stream << "Previous Path size: " << previous_path_global.size() << std::endl;
-    if (!previous_path_global.empty())
+    // anchor waypoints only depend on lane and horizon, share them between maneuvers (i.e. velocity samples)
+    std::vector<std::pair<Maneuver, Trajectory>> calculated_trajectories{};
+    for (std::size_t idx = 0U; idx < maneuvers.size(); ++idx)
     {
-        const auto n_samples =
-            std::min(static_cast<std::size_t>(previous_path_global.size()), static_cast<std::size_t>(10));
-        std::for_each(previous_path_global.begin(),
-                      previous_path_global.begin() + n_samples,
-                      [&log_stream](const auto& wp) { log_stream << "     => " << wp << std::endl; });
-        log_stream << "     => ... (more " << previous_path_global.size() - n_samples << " waypoints)" << std::endl;
+        const auto& maneuver = maneuvers[idx];
+        auto calculated_trajectory =
+            std::find_if(calculated_trajectories.begin(),
+                         calculated_trajectories.end(),
+                         [&maneuver](const auto& entry)
+                         {
+                             return (entry.first.GetLaneId() == maneuver.GetLaneId()) &&
+                                    (entry.first.GetHorizon() == maneuver.GetHorizon());
+                         });
+        if (calculated_trajectory == calculated_trajectories.end())
+        {
+            calculated_trajectories.emplace_back(
+                maneuver,
+                GetCalculatedTrajectory(
+                    maneuver.GetLaneId(), maneuver.GetHorizon(), initial_trajectory, map_coordinates));
+            calculated_trajectory = std::prev(calculated_trajectories.end());
+        }
+
+        /// fill trajectory in place
+        const auto unique_id = static_cast<std::int32_t>(idx + 1U);
+        SetPlannedTrajectory(maneuver, unique_id, calculated_trajectory->second, trajectories[idx]);
     }
 
-    log_stream << "Planned trajectories: " << trajectories.size() << std::endl;
-    std::for_each(trajectories.begin(),
-                  trajectories.end(),
-                  [&log_stream](const auto& trajectory)
-                  {
-                      log_stream << " (+) " << trajectory << std::endl;
-                      const auto n_samples =
-                          std::min(static_cast<std::size_t>(trajectory.waypoints.size()), static_cast<std::size_t>(10));
-                      std::for_each(trajectory.waypoints.begin(),
-                                    trajectory.waypoints.begin() + n_samples,
-                                    [&log_stream](const auto& wp) { log_stream << "     => " << wp << std::endl; });
-                      log_stream << "     => ... (more " << trajectory.waypoints.size() - n_samples << " waypoints)"
-                                 << std::endl;
-                  });
+    LogPlannedTrajectories(previous_path_global, trajectories);
+}
 
-    LOG(INFO) << log_stream.str();
-    return trajectories;
+Trajectory TrajectoryPlanner::GetPlannedTrajectory(const Maneuver& maneuver, const std::int32_t unique_id) const
+{
+    const auto map_coordinates = data_source_.GetMapCoordinates();
+    const auto calculated_trajectory = GetCalculatedTrajectory(
+        maneuver.GetLaneId(), maneuver.GetHorizon(), GetInitialTrajectory(), map_coordinates);
+    return GetPlannedTrajectory(maneuver, unique_id, calculated_trajectory);
+}
+
+Trajectory TrajectoryPlanner::GetPlannedTrajectory(const Maneuver& maneuver,
+                                                   const std::int32_t unique_id,
+                                                   const Trajectory& calculated_trajectory) const
+{
+    Trajectory trajectory{};
+    SetPlannedTrajectory(maneuver, unique_id, calculated_trajectory, trajectory);
+    return trajectory;
 }
 
-GlobalCoordinates TrajectoryPlanner::GetGlobalCoordinates(const FrenetCoordinates& frenet_coords) const
+void TrajectoryPlanner::SetPlannedTrajectory(const Maneuver& maneuver,
+                                             const std::int32_t unique_id,
+                                             const Trajectory& calculated_trajectory,
+                                             Trajectory& trajectory) const
+{
+    // reset all properties of a reused trajectory, but keep its waypoints' capacity
+    auto waypoints = std::move(trajectory.waypoints);
+    trajectory = Trajectory{};
+    trajectory.waypoints = std::move(waypoints);
+    const auto lane_id = maneuver.GetLaneId();
+
+    /// share old path inputs (stored once per frame)
+    trajectory.previous_path = data_source_.GetSharedPreviousPath();
+    /// anchor waypoints are local to the previous path end, hence optimizer transforms back with the same frame
+    trajectory.position = calculated_trajectory.position;
+    trajectory.yaw = calculated_trajectory.yaw;
+    trajectory.velocity = maneuver.GetVelocity();
+    trajectory.horizon = maneuver.GetHorizon();
+    trajectory.unique_id = unique_id;
+    trajectory.lane_id = lane_id;
+    trajectory.global_lane_id = GetGlobalLaneId(lane_id);
+
+    /// update waypoints
+    trajectory.waypoints.assign(calculated_trajectory.waypoints.begin(), calculated_trajectory.waypoints.end());
+}
+
+GlobalCoordinates TrajectoryPlanner::GetGlobalCoordinates(const FrenetCoordinates& frenet_coords,
+                                                          const MapCoordinatesList& map_coordinates)
 {
     std::int32_t prev_wp = -1;
-    const auto map_coordinates = data_source_.GetMapCoordinates();
     while (frenet_coords.s > map_coordinates[prev_wp + 1].frenet_coords.s &&
            (prev_wp < static_cast<std::int32_t>(map_coordinates.size() - 1)))
     {
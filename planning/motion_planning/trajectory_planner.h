@@ -27,18 +27,45 @@ class TrajectoryPlanner : public ITrajectoryPlanner
     /// @brief Get Planned Trajectories for each maneuvers provided.
     Trajectories GetPlannedTrajectories(const std::vector<Maneuver>& maneuvers) const override;
 
+    /// @brief Plan Trajectories for each maneuver into provided trajectories (reused, resized to the maneuvers).
+    /// @note Initial trajectory and map are queried once per batch, anchor waypoints are shared between maneuvers
+    /// with the same lane and horizon (i.e. lattice velocity samples).
+    void PlanTrajectories(const std::vector<Maneuver>& maneuvers, Trajectories& trajectories) const override;
+
+    /// @brief Get Planned Trajectory for a single maneuver (with provided unique id).
+    Trajectory GetPlannedTrajectory(const Maneuver& maneuver, const std::int32_t unique_id) const override;
+
   private:
     /// @brief Calculates initial waypoints for trajectory based on previous path/waypoints
     Trajectory GetInitialTrajectory() const;
 
-    /// @brief Calculate Trajectory for given lane_id, target velocity
-    Trajectory GetCalculatedTrajectory(const LaneId lane_id) const;
+    /// @brief Calculate anchor waypoints (in local coordinates of initial trajectory) for given lane and horizon
+    ///
+    /// @param lane_id [in] - lane to be followed
+    /// @param horizon [in] - longitudinal spacing of anchor waypoints
+    /// @param initial_trajectory [in] - initial trajectory (previous path end, in global coordinates)
+    /// @param map_coordinates [in] - map waypoints
+    ///
+    /// @return trajectory with anchor waypoints, position and yaw of the local coordinates
+    Trajectory GetCalculatedTrajectory(const LaneId lane_id,
+                                       const units::length::meter_t horizon,
+                                       const Trajectory& initial_trajectory,
+                                       const MapCoordinatesList& map_coordinates) const;
+
+    /// @brief Fills planned trajectory (maneuver properties, ids) around already calculated anchor waypoints
+    Trajectory GetPlannedTrajectory(const Maneuver& maneuver,
+                                    const std::int32_t unique_id,
+                                    const Trajectory& calculated_trajectory) const;
 
-    /// @brief Produces trajectories and optimizes for each maneuver
-    Trajectories GetTrajectories(const std::vector<Maneuver>& maneuvers) const;
+    /// @brief Fills given (reused) trajectory with maneuver properties, ids and calculated anchor waypoints
+    void SetPlannedTrajectory(const Maneuver& maneuver,
+                              const std::int32_t unique_id,
+                              const Trajectory& calculated_trajectory,
+                              Trajectory& trajectory) const;
 
     /// @brief Converts Frenet Coordinates to Global Coordinates (using map)
-    GlobalCoordinates GetGlobalCoordinates(const FrenetCoordinates& frenet_coords) const;
+    static GlobalCoordinates GetGlobalCoordinates(const FrenetCoordinates& frenet_coords,
+                                                  const MapCoordinatesList& map_coordinates);
 
     /// @brief Converts Local Lane Id to Global Lane Id (using ego's global lane)
     GlobalLaneId GetGlobalLaneId(const LaneId lane_id) const;
@@ -6,33 +6,50 @@
 
 #include "planning/common/logging.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace planning
 {
 namespace internal
 {
-template <typename T>
-void PrintQueue(T q)
+void PrintPrioritizedTrajectories(const PrioritizedTrajectories& prioritized_trajectories)
 {
+    if (!IsInfoLogged())
+    {
+        return;
+    }
+
     std::stringstream log_stream;
-    log_stream << "Prioritized trajectories: " << q.size() << std::endl;
-    std::int32_t idx = 1;
-    while (!q.empty())
+    log_stream << "Prioritized trajectories: " << prioritized_trajectories.size() << std::endl;
+    const auto handles = prioritized_trajectories.GetOrderedHandles();
+    const auto n_logged = std::min(handles.size(), kMaxLoggedTrajectories);
+    for (std::size_t idx = 0U; idx < n_logged; ++idx)
     {
-        log_stream << "  " << (idx++) << ". " << q.top() << std::endl;
-        q.pop();
+        log_stream << "  " << (idx + 1U) << ". TrajectoryHandle{index: " << handles[idx].index
+                   << ", lane: " << handles[idx].lane_id << ", cost: " << handles[idx].cost << "}" << std::endl;
     }
+    log_stream << "  ... (more " << prioritized_trajectories.size() - n_logged << " trajectories)" << std::endl;
     LOG(INFO) << log_stream.str();
 }
 }  // namespace internal
 
-PrioritizedTrajectories TrajectoryPrioritizer::GetPrioritizedTrajectories(const Trajectories& trajectories) const
+TrajectoryPrioritizer::TrajectoryPrioritizer() : TrajectoryPrioritizer{kMaxLoggedTrajectories} {}
+
+TrajectoryPrioritizer::TrajectoryPrioritizer(const std::size_t number_of_sorted)
+    : TrajectoryPrioritizer{number_of_sorted, nullptr}
 {
-    PrioritizedTrajectories prioritized_trajectories;
-    for (const auto& trajectory : trajectories)
-    {
-        prioritized_trajectories.push(trajectory);
-    }
-    internal::PrintQueue(prioritized_trajectories);
+}
+
+TrajectoryPrioritizer::TrajectoryPrioritizer(const std::size_t number_of_sorted, MonotonicArena* arena)
+    : number_of_sorted_{number_of_sorted}, arena_{arena}
+{
+}
+
+PrioritizedTrajectories TrajectoryPrioritizer::GetPrioritizedTrajectories(Trajectories trajectories) const
+{
+    PrioritizedTrajectories prioritized_trajectories{std::move(trajectories), number_of_sorted_, arena_};
+    internal::PrintPrioritizedTrajectories(prioritized_trajectories);
     return prioritized_trajectories;
 }
 
@@ -7,14 +7,33 @@
 
 #include "planning/motion_planning/i_trajectory_prioritizer.h"
 
+#include <cstddef>
+
 namespace planning
 {
 /// @brief Trajectory Prioritizer
 class TrajectoryPrioritizer : public ITrajectoryPrioritizer
 {
   public:
+    /// @brief Constructor. Orders the top kMaxLoggedTrajectories trajectories at once.
+    TrajectoryPrioritizer();
+
+    /// @brief Constructor. Orders the top number_of_sorted trajectories at once (top-K, further ones on demand).
+    explicit TrajectoryPrioritizer(const std::size_t number_of_sorted);
+
+    /// @brief Constructor. Orders the top number_of_sorted trajectories at once, handles are drawn from given per frame
+    /// arena (nullptr uses the heap).
+    explicit TrajectoryPrioritizer(const std::size_t number_of_sorted, MonotonicArena* arena);
+
     /// @brief Get Prioritized Trajectories for provided trajectories.
-    PrioritizedTrajectories GetPrioritizedTrajectories(const Trajectories& trajectories) const override;
+    PrioritizedTrajectories GetPrioritizedTrajectories(Trajectories trajectories) const override;
+
+  private:
+    /// @brief Number of trajectories ordered at once
+    std::size_t number_of_sorted_;
+
+    /// @brief Per frame arena for the handles (nullptr uses the heap)
+    MonotonicArena* arena_;
 };
 }  // namespace planning
 
@@ -8,15 +8,35 @@
 
 namespace planning
 {
-Trajectory TrajectorySelector::GetSelectedTrajectory(const PrioritizedTrajectories& prioritized_trajectories) const
+namespace
 {
-    const auto& selected_trajectory = prioritized_trajectories.top();
+/// @brief Log selected trajectory (verbose information)
+void LogSelectedTrajectory(const Trajectory& selected_trajectory)
+{
+    if (!IsInfoLogged())
+    {
+        return;
+    }
 
     std::stringstream log_stream;
     log_stream << "Selected trajectory (lane_id): " << selected_trajectory.global_lane_id << std::endl;
     log_stream << " (+) " << selected_trajectory << std::endl;
     LOG(INFO) << log_stream.str();
+}
+}  // namespace
+
+Trajectory TrajectorySelector::GetSelectedTrajectory(PrioritizedTrajectories prioritized_trajectories) const
+{
+    auto selected_trajectory = prioritized_trajectories.TakeTop();
+    LogSelectedTrajectory(selected_trajectory);
     return selected_trajectory;
 };
 
+void TrajectorySelector::SelectTrajectory(const PrioritizedTrajectories& prioritized_trajectories,
+                                          Trajectory& selected_trajectory) const
+{
+    selected_trajectory = prioritized_trajectories.top();
+    LogSelectedTrajectory(selected_trajectory);
+}
+
 }  // namespace planning
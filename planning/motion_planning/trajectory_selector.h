@@ -14,7 +14,11 @@ class TrajectorySelector : public ITrajectorySelector
 {
   public:
     /// @brief Get Selected Trajectory from provided prioritized trajectories. (Selects top prioritized trajectory)
-    Trajectory GetSelectedTrajectory(const PrioritizedTrajectories& prioritized_trajectories) const override;
+    Trajectory GetSelectedTrajectory(PrioritizedTrajectories prioritized_trajectories) const override;
+
+    /// @brief Select top prioritized trajectory into provided selected trajectory (reusing its waypoints' capacity).
+    void SelectTrajectory(const PrioritizedTrajectories& prioritized_trajectories,
+                          Trajectory& selected_trajectory) const override;
 };
 }  // namespace planning
 
@@ -0,0 +1,111 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#include "planning/motion_planning/two_rate_planning.h"
+
+#include "planning/common/logging.h"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+
+namespace planning
+{
+TwoRatePlanning::TwoRatePlanning(const DataSource& data_source,
+                                 const MotionPlanningOptions& options,
+                                 const TwoRatePlanningOptions& two_rate_options)
+    : two_rate_options_{two_rate_options},
+      data_source_{data_source},
+      strategic_data_source_{},
+      motion_planning_{std::make_unique<MotionPlanning>(data_source_, options)},
+      strategic_motion_planning_{
+          std::make_unique<MotionPlanning>(strategic_data_source_, two_rate_options_.strategic_options)},
+      target_global_lane_id_{GlobalLaneId::kInvalid},
+      strategic_target_velocity_{0.0},
+      frames_since_refresh_{0U},
+      statistics_{},
+      refresh_{},
+      thread_pool_{1U}
+{
+}
+
+TwoRatePlanning::~TwoRatePlanning()
+{
+    if (refresh_.valid())
+    {
+        refresh_.wait();
+    }
+}
+
+void TwoRatePlanning::GenerateTrajectories()
+{
+    ++statistics_.frames;
+
+    UpdateTargetLane();
+    RefreshTargetLane();
+
+    motion_planning_->SetTargetLane(target_global_lane_id_);
+    motion_planning_->GenerateTrajectories();
+}
+
+void TwoRatePlanning::UpdateTargetLane()
+{
+    if (!refresh_.valid() || (refresh_.wait_for(std::chrono::seconds{0}) != std::future_status::ready))
+    {
+        return;
+    }
+    refresh_.get();
+    target_global_lane_id_ = strategic_motion_planning_->GetSelectedTrajectory().global_lane_id;
+    strategic_target_velocity_ = strategic_motion_planning_->GetState().target_velocity;
+    ++statistics_.decisions;
+    LOG(INFO) << "Strategic target lane: " << target_global_lane_id_ << " (" << statistics_ << ")";
+}
+
+void TwoRatePlanning::RefreshTargetLane()
+{
+    // first frame starts a refresh, further ones once the period elapsed
+    const auto refresh_period = std::max(two_rate_options_.strategic_refresh_period, std::size_t{1U});
+    const auto is_due = (statistics_.frames == 1U) || (++frames_since_refresh_ >= refresh_period);
+    if (!is_due)
+    {
+        return;
+    }
+    if (refresh_.valid())
+    {
+        ++statistics_.postponed_refreshes;
+        return;
+    }
+
+    // slow loop plans on a copy, hence the fast loop's DataSource may be updated for the next frame meanwhile
+    strategic_data_source_ = data_source_;
+    strategic_motion_planning_->SetState(motion_planning_->GetState());
+    auto task =
+        std::make_shared<std::packaged_task<void()>>([this] { strategic_motion_planning_->GenerateTrajectories(); });
+    refresh_ = task->get_future();
+    thread_pool_.Submit([task] { (*task)(); });
+    frames_since_refresh_ = 0U;
+    ++statistics_.refreshes;
+}
+
+Trajectory TwoRatePlanning::GetSelectedTrajectory() const
+{
+    return motion_planning_->GetSelectedTrajectory();
+}
+
+GlobalLaneId TwoRatePlanning::GetTargetLane() const
+{
+    return target_global_lane_id_;
+}
+
+units::velocity::meters_per_second_t TwoRatePlanning::GetStrategicTargetVelocity() const
+{
+    return strategic_target_velocity_;
+}
+
+TwoRatePlanningStatistics TwoRatePlanning::GetStatistics() const
+{
+    return statistics_;
+}
+}  // namespace planning
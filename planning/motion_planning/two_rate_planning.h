@@ -0,0 +1,126 @@
+///
+/// @file
+/// @copyright Copyright (c) 2021. All Rights Reserved.
+///
+#ifndef PLANNING_MOTION_PLANNING_TWO_RATE_PLANNING_H
+#define PLANNING_MOTION_PLANNING_TWO_RATE_PLANNING_H
+
+#include "planning/common/thread_pool.h"
+#include "planning/datatypes/trajectory.h"
+#include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/motion_planning.h"
+#include "planning/motion_planning/motion_planning_options.h"
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <ostream>
+
+namespace planning
+{
+/// @brief Two Rate Planning counters
+struct TwoRatePlanningStatistics
+{
+    /// @brief Number of fast loop frames
+    std::size_t frames{0U};
+
+    /// @brief Number of started strategic refreshes
+    std::size_t refreshes{0U};
+
+    /// @brief Number of strategic decisions consumed by the fast loop (i.e. completed refreshes)
+    std::size_t decisions{0U};
+
+    /// @brief Number of frames a due refresh was postponed (previous refresh still running)
+    std::size_t postponed_refreshes{0U};
+};
+
+/// @brief Two Rate Planning. Fast loop plans every frame (e.g. short horizon lanes), slow loop refreshes the strategic
+/// target lane (e.g. long horizon lattice) asynchronously at a lower rate.
+///
+/// @details Every strategic_refresh_period frames, the current frame is copied and planned by the strategic Motion
+/// Planning on a worker thread. Its selected lane becomes the target lane of the fast loop once the refresh completed.
+/// The fast loop never waits for the slow loop, it uses the latest completed decision (none until the first refresh
+/// completed, i.e. all the lanes are planned). Ego lane is always planned by the fast loop.
+///
+/// @note Each refresh starts from the fast loop's state (e.g. target velocity), i.e. the slow loop doesn't ramp its
+/// own target velocity once per refresh.
+class TwoRatePlanning
+{
+  public:
+    /// @brief Constructor. Initialize fast loop with DataSource instance and provided options.
+    explicit TwoRatePlanning(const DataSource& data_source,
+                             const MotionPlanningOptions& options,
+                             const TwoRatePlanningOptions& two_rate_options);
+
+    /// @brief Destructor. Waits for the running refresh.
+    ~TwoRatePlanning();
+
+    TwoRatePlanning(const TwoRatePlanning&) = delete;
+    TwoRatePlanning& operator=(const TwoRatePlanning&) = delete;
+
+    /// @brief Generate Trajectories based on the provided DataSource (fast loop), start strategic refresh if due
+    void GenerateTrajectories();
+
+    /// @brief Get Selected Trajectory of the fast loop
+    Trajectory GetSelectedTrajectory() const;
+
+    /// @brief Get latest strategic target lane (kInvalid until the first refresh completed)
+    GlobalLaneId GetTargetLane() const;
+
+    /// @brief Get target velocity the latest strategic target lane was planned for (0 until the first refresh
+    /// completed)
+    units::velocity::meters_per_second_t GetStrategicTargetVelocity() const;
+
+    /// @brief Get two rate planning counters
+    TwoRatePlanningStatistics GetStatistics() const;
+
+  private:
+    /// @brief Consume the strategic decision (if the refresh completed)
+    void UpdateTargetLane();
+
+    /// @brief Start strategic refresh for the current frame (unless a refresh is running)
+    void RefreshTargetLane();
+
+    /// @brief Two Rate Planning options
+    const TwoRatePlanningOptions two_rate_options_;
+
+    /// @brief DataSource of the fast loop (current frame)
+    const DataSource& data_source_;
+
+    /// @brief DataSource of the slow loop (copy of the frame the refresh started for)
+    DataSource strategic_data_source_;
+
+    /// @brief Fast loop Motion Planning
+    std::unique_ptr<MotionPlanning> motion_planning_;
+
+    /// @brief Slow loop Motion Planning (used by the worker while a refresh is running)
+    std::unique_ptr<MotionPlanning> strategic_motion_planning_;
+
+    /// @brief Latest strategic target lane
+    GlobalLaneId target_global_lane_id_;
+
+    /// @brief Target velocity of the latest strategic decision
+    units::velocity::meters_per_second_t strategic_target_velocity_;
+
+    /// @brief Number of frames since the last refresh started
+    std::size_t frames_since_refresh_;
+
+    /// @brief Two rate planning counters
+    TwoRatePlanningStatistics statistics_;
+
+    /// @brief Completion of the running refresh (invalid if no refresh is running)
+    std::future<void> refresh_;
+
+    /// @brief Worker thread for strategic refreshes (destroyed first, i.e. finishes the running refresh)
+    ThreadPool thread_pool_;
+};
+
+/// @brief String Stream for Two Rate Planning counters (used for printing verbose information)
+inline std::ostream& operator<<(std::ostream& out, const TwoRatePlanningStatistics& statistics)
+{
+    return out << "TwoRatePlanning{frames: " << statistics.frames << ", refreshes: " << statistics.refreshes
+               << ", decisions: " << statistics.decisions << ", postponed: " << statistics.postponed_refreshes << "}";
+}
+}  // namespace planning
+
+#endif  /// PLANNING_MOTION_PLANNING_TWO_RATE_PLANNING_H
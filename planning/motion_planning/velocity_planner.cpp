@@ -5,6 +5,8 @@
 #include "planning/motion_planning/velocity_planner.h"
 
 #include "planning/common/logging.h"
+#include "planning/motion_planning/arc_length_resampler.h"
+#include "planning/motion_planning/object_predictor.h"
 
 namespace planning
 {
@@ -18,11 +20,19 @@ VelocityPlanner::VelocityPlanner(const IDataSource& data_source,
     : frequency_{25.0},
       deceleration_{-5.0},
       acceleration_{5.0},
+      initial_target_velocity_{target_velocity},
       target_velocity_{target_velocity},
-      data_source_{data_source}
+      data_source_{data_source},
+      object_predictor_{nullptr}
 {
 }
 
+VelocityPlanner::VelocityPlanner(const IDataSource& data_source, const IObjectPredictor& object_predictor)
+    : VelocityPlanner{data_source, units::velocity::meters_per_second_t{0.0}}
+{
+    object_predictor_ = &object_predictor;
+}
+
 void VelocityPlanner::CalculateTargetVelocity()
 {
     const auto sensor_fusion = data_source_.GetSensorFusion();
@@ -39,12 +49,15 @@ void VelocityPlanner::CalculateTargetVelocity()
     const auto min_velocity = units::velocity::meters_per_second_t{1.0};
     target_velocity_ = units::math::max(target_velocity_, min_velocity);
 
-    std::stringstream log_stream;
-    log_stream << "Calculated target velocity: " << target_velocity_ << std::endl;
-    log_stream << " (+) delta_velocity: " << delta_velocity << std::endl;
-    log_stream << " (+) speed_limit: " << speed_limit << std::endl;
-    log_stream << " (+) " << data_source_.GetVehicleDynamics() << std::endl;
-    LOG(INFO) << log_stream.str();
+    if (IsInfoLogged())
+    {
+        std::stringstream log_stream;
+        log_stream << "Calculated target velocity: " << target_velocity_ << std::endl;
+        log_stream << " (+) delta_velocity: " << delta_velocity << std::endl;
+        log_stream << " (+) speed_limit: " << speed_limit << std::endl;
+        log_stream << " (+) " << data_source_.GetVehicleDynamics() << std::endl;
+        LOG(INFO) << log_stream.str();
+    }
 }
 
 units::velocity::meters_per_second_t VelocityPlanner::GetTargetVelocity() const
@@ -52,15 +65,25 @@ units::velocity::meters_per_second_t VelocityPlanner::GetTargetVelocity() const
     return target_velocity_;
 }
 
-bool VelocityPlanner::IsClosestInPathVehicleInFront(const ObjectFusion& object_fusion) const
+void VelocityPlanner::Reset()
+{
+    target_velocity_ = initial_target_velocity_;
+}
+
+void VelocityPlanner::SetTargetVelocity(const units::velocity::meters_per_second_t target_velocity)
+{
+    target_velocity_ = target_velocity;
+}
+
+bool VelocityPlanner::IsClosestInPathVehicleInFront(const PredictedObjectState& predicted_state) const
 {
     const auto ego_lane_id = data_source_.GetGlobalLaneId();
     const auto ego_position = data_source_.GetPreviousPathEnd();
     const auto ego_velocity = data_source_.GetVehicleDynamics().velocity;
 
-    const auto obj_position = object_fusion.frenet_coords;
-    const auto obj_lane_id = data_source_.GetGlobalLaneId(object_fusion.frenet_coords);
-    const auto obj_velocity = object_fusion.velocity;
+    const auto obj_position = FrenetCoordinates{predicted_state.s, predicted_state.d};
+    const auto obj_lane_id = data_source_.GetGlobalLaneId(obj_position);
+    const auto obj_velocity = units::velocity::meters_per_second_t{predicted_state.velocity};
 
     const auto distance = units::length::meter_t{obj_position.s - ego_position.s};
     const auto is_near = units::math::abs(distance) < gkFarDistanceThreshold;
@@ -72,13 +95,31 @@ bool VelocityPlanner::IsClosestInPathVehicleInFront(const ObjectFusion& object_f
 }
 
 units::velocity::meters_per_second_t VelocityPlanner::GetDeltaVelocity() const
+{
+    if (object_predictor_ != nullptr)
+    {
+        return GetDeltaVelocity(object_predictor_->GetPredictedObjects());
+    }
+
+    ObjectPredictor object_predictor{data_source_};
+    object_predictor.PredictObjects();
+    return GetDeltaVelocity(object_predictor.GetPredictedObjects());
+}
+
+units::velocity::meters_per_second_t VelocityPlanner::GetDeltaVelocity(const PredictedObjects& predicted_objects) const
 {
     auto delta_velocity = units::velocity::meters_per_second_t{0.0};
-    const auto sensor_fusion = data_source_.GetSensorFusion();
 
-    const auto is_cipv_in_front = std::any_of(sensor_fusion.objs.begin(),
-                                              sensor_fusion.objs.end(),
-                                              [this](const auto& obj) { return IsClosestInPathVehicleInFront(obj); });
+    // objects at the time ego reaches previous path end
+    const auto previous_path_size = data_source_.GetSharedPreviousPath()->size();
+    const auto step = predicted_objects.GetStep(
+        units::time::second_t{static_cast<double>(previous_path_size) * kWaypointSamplingTime});
+    const auto* const predicted_states = predicted_objects.GetStates(step);
+
+    const auto is_cipv_in_front =
+        std::any_of(predicted_states,
+                    predicted_states + predicted_objects.GetNumberOfObjects(),
+                    [this](const auto& predicted_state) { return IsClosestInPathVehicleInFront(predicted_state); });
     if (is_cipv_in_front)
     {
         delta_velocity = (deceleration_ / frequency_);
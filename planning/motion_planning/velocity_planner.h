@@ -6,6 +6,7 @@
 #define PLANNING_MOTION_PLANNING_VELOCITY_PLANNER_H
 
 #include "planning/motion_planning/data_source.h"
+#include "planning/motion_planning/i_object_predictor.h"
 #include "planning/motion_planning/i_velocity_planner.h"
 
 #include <units.h>
@@ -27,19 +28,32 @@ class VelocityPlanner : public IVelocityPlanner
     explicit VelocityPlanner(const IDataSource& data_source,
                              const units::velocity::meters_per_second_t target_velocity);
 
+    /// @brief Constructor. Initialize with DataSource and Object Predictor (predicted once per frame).
+    explicit VelocityPlanner(const IDataSource& data_source, const IObjectPredictor& object_predictor);
+
     /// @brief Calculate Target Velocity based on DataSource.
     void CalculateTargetVelocity() override;
 
     /// @brief Get calculated target velocity.
     units::velocity::meters_per_second_t GetTargetVelocity() const override;
 
+    /// @brief Reset Target Velocity to its initial value (i.e. forget previous frames).
+    void Reset() override;
+
+    /// @brief Set Target Velocity carried to the next frame.
+    void SetTargetVelocity(const units::velocity::meters_per_second_t target_velocity) override;
+
   private:
     /// @brief Validate if vehicle/object in front (in same lane) within safe distance?
-    bool IsClosestInPathVehicleInFront(const ObjectFusion& object_fusion) const;
+    /// @note Object is predicted to the time ego reaches previous path end.
+    bool IsClosestInPathVehicleInFront(const PredictedObjectState& predicted_state) const;
 
     /// @brief Get Delta Velocity between Ego and Object Velocity.
     units::velocity::meters_per_second_t GetDeltaVelocity() const;
 
+    /// @brief Get Delta Velocity between Ego and predicted Object Velocity.
+    units::velocity::meters_per_second_t GetDeltaVelocity(const PredictedObjects& predicted_objects) const;
+
     /// @brief Vehicle Dynamics Refresh rate
     const units::frequency::hertz_t frequency_;
 
@@ -49,11 +63,17 @@ class VelocityPlanner : public IVelocityPlanner
     /// @brief Jerk free acceleration rate
     const units::acceleration::meters_per_second_squared_t acceleration_;
 
+    /// @brief Initial Target Velocity (before the first frame)
+    const units::velocity::meters_per_second_t initial_target_velocity_;
+
     /// @brief Target Velocity
     units::velocity::meters_per_second_t target_velocity_;
 
     /// @brief DataSource (contains information on VehicleDynamics, SensorFusion, Map Points etc.)
     const IDataSource& data_source_;
+
+    /// @brief Object Predictor shared with other stages (nullptr if objects are predicted on each calculation)
+    const IObjectPredictor* object_predictor_;
 };
 }  // namespace planning
 